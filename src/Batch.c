@@ -0,0 +1,472 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* Required for clock_gettime and pthread */
+#define _POSIX_C_SOURCE 200809L
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <Emu.h>
+#include <Batch.h>
+#include <State.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Default number of emulated frame per instance */
+#define BATCH_FRAME_COUNT   1
+
+/** FNV-1a 32 bit offset basis */
+#define BATCH_FNV_BASIS     0x811C9DC5
+
+/** FNV-1a 32 bit prime */
+#define BATCH_FNV_PRIME     0x01000193
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Final state of one instance */
+typedef struct tagBatch_Result_t
+{
+    char const * File;              /**< Loaded binary file */
+    int Status;                     /**< 0 if the instance ran, otherwise -1 */
+    char const * Error;             /**< Reason of the failure */
+    uint64_t Cycle;                 /**< Number of cycle executed */
+    uint32_t Hash;                  /**< FNV-1a hash of the 16 bit memory space */
+    uint64_t Frame;                 /**< Number of frame completed */
+    uint32_t FrameHash;             /**< FNV-1a hash of the framebuffer */
+    uint16_t Reg[CPU_REG_NUM];      /**< CPU register */
+} Batch_Result_t;
+
+/**
+ * Job deque of a worker
+ * @note Jobs are known up front: the deque is the job index range [Top, Bottom)
+ */
+typedef struct tagBatch_Queue_t
+{
+    pthread_mutex_t Lock;           /**< Deque lock */
+    int Top;                        /**< Next job to steal */
+    int Bottom;                     /**< One past the next job to pop */
+} Batch_Queue_t;
+
+/* Forward declaration for Batch_Worker_t definition */
+typedef struct tagBatch_Pool_t Batch_Pool_t;
+
+/** Pool worker */
+typedef struct tagBatch_Worker_t
+{
+    pthread_t Thread;               /**< Worker thread */
+    int Id;                         /**< Worker index in the pool */
+    Batch_Pool_t * Pool;            /**< Owning pool */
+    Batch_Queue_t Queue;            /**< Own job deque */
+} Batch_Worker_t;
+
+/** Work-stealing thread pool */
+typedef struct tagBatch_Pool_t
+{
+    int WorkerCount;                /**< Number of worker */
+    Batch_Worker_t * Worker;        /**< Worker list */
+    Batch_Result_t * Result;        /**< Result of each job */
+    uint64_t Cycle;                 /**< Cycle budget of each job */
+    uint32_t Render;                /**< Render interval of each job */
+    void const * State;             /**< Savestate each job start from (NULL: reset) */
+    size_t StateSize;               /**< Savestate size */
+} Batch_Pool_t;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static void * Batch_Worker(void * arg);
+static int Batch_Pop(Batch_Queue_t * queue);
+static int Batch_Steal(Batch_Pool_t * pool, int thief);
+static void Batch_Execute(Emu_Context_t * ctx, Batch_Pool_t const * pool, Batch_Result_t * result);
+static int Batch_GetCoreCount(void);
+static double Batch_GetTime(void);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+int Batch_Run(int argc, char const * argv[])
+{
+    uint64_t cycles = (uint64_t)BATCH_FRAME_COUNT * BATCH_FRAME_CYCLE;
+    uint32_t render = PPU_RENDER_ALL;
+    int threads = Batch_GetCoreCount();
+    int count = 0;
+    char const * state = NULL;
+
+    Batch_Result_t * result = calloc(argc > 0 ? argc : 1, sizeof(Batch_Result_t));
+    if(result == NULL)
+    {
+        DEBUGGER_ERROR("Batch Error: out of memory\n");
+        return 1;
+    }
+
+    /* Parse option and file list */
+    for(int i=0; i<argc; i++)
+    {
+        if((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            cycles = strtoull(argv[++ i], NULL, 0);
+        }
+        else if((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+        {
+            cycles = strtoull(argv[++ i], NULL, 0) * BATCH_FRAME_CYCLE;
+        }
+        else if((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            render = strtoul(argv[++ i], NULL, 0);
+        }
+        else if((strcmp(argv[i], "-j") == 0) && (i + 1 < argc))
+        {
+            threads = strtol(argv[++ i], NULL, 0);
+        }
+        else if((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+        {
+            state = argv[++ i];
+        }
+        else
+        {
+            result[count ++].File = argv[i];
+        }
+    }
+
+    if(count == 0)
+    {
+        printf("Usage: --batch [-c cycle] [-f frame] [-r render] [-j thread] [-s state] file...\n");
+        free(result);
+        return 1;
+    }
+
+    /* No more worker than job */
+    if(threads > count)
+    {
+        threads = count;
+    }
+    if(threads < 1)
+    {
+        threads = 1;
+    }
+
+    Batch_Pool_t pool;
+    pool.WorkerCount = threads;
+    pool.Result = result;
+    pool.Cycle = cycles;
+    pool.Render = render;
+    pool.State = NULL;
+    pool.StateSize = 0;
+    pool.Worker = calloc(threads, sizeof(Batch_Worker_t));
+    if(pool.Worker == NULL)
+    {
+        DEBUGGER_ERROR("Batch Error: out of memory\n");
+        free(result);
+        return 1;
+    }
+
+    /* The checkpoint is read once and shared by every job */
+    if(state != NULL)
+    {
+        pool.State = State_ReadFile(state, &pool.StateSize);
+        if(pool.State == NULL)
+        {
+            free(pool.Worker);
+            free(result);
+            return 1;
+        }
+    }
+
+    /* Give each worker a contiguous slice of the job list */
+    for(int i=0; i<threads; i++)
+    {
+        Batch_Worker_t * worker = &pool.Worker[i];
+        worker->Id = i;
+        worker->Pool = &pool;
+        worker->Queue.Top = (int)((int64_t)count * i / threads);
+        worker->Queue.Bottom = (int)((int64_t)count * (i + 1) / threads);
+        pthread_mutex_init(&worker->Queue.Lock, NULL);
+    }
+
+    /* Run the pool, the calling thread is worker 0 */
+    double const start = Batch_GetTime();
+    for(int i=1; i<threads; i++)
+    {
+        if(pthread_create(&pool.Worker[i].Thread, NULL, Batch_Worker, &pool.Worker[i]) != 0)
+        {
+            /* Its jobs are stolen by the other worker */
+            pool.Worker[i].Id = -1;
+        }
+    }
+    Batch_Worker(&pool.Worker[0]);
+    for(int i=1; i<threads; i++)
+    {
+        if(pool.Worker[i].Id >= 0)
+        {
+            pthread_join(pool.Worker[i].Thread, NULL);
+        }
+    }
+    double const elapsed = Batch_GetTime() - start;
+
+    /* Print result in the command line order */
+    int status = 0;
+    uint64_t total = 0;
+    for(int i=0; i<count; i++)
+    {
+        Batch_Result_t const * res = &result[i];
+        if(res->Status != 0)
+        {
+            printf("%s: error: %s\n", res->File, res->Error);
+            status = 1;
+            continue;
+        }
+
+        printf("%s: cycle=%" PRIu64 " hash=0x%08" PRIx32, res->File, res->Cycle, res->Hash);
+        printf(" frame=%" PRIu64 " screen=0x%08" PRIx32, res->Frame, res->FrameHash);
+        printf(" AF=0x%04x BC=0x%04x DE=0x%04x HL=0x%04x SP=0x%04x PC=0x%04x\n",
+               res->Reg[CPU_R_AF], res->Reg[CPU_R_BC], res->Reg[CPU_R_DE],
+               res->Reg[CPU_R_HL], res->Reg[CPU_R_SP], res->Reg[CPU_R_PC]);
+        total += res->Cycle;
+    }
+    printf("Batch: %d instance, %d thread, %.3f s, %.2f MHz\n",
+           count, threads, elapsed, (elapsed > 0) ? (double)total / elapsed / 1e6 : 0.0);
+
+    for(int i=0; i<threads; i++)
+    {
+        pthread_mutex_destroy(&pool.Worker[i].Queue.Lock);
+    }
+    free((void *)pool.State);
+    free(pool.Worker);
+    free(result);
+
+    return status;
+}
+
+
+/**
+ * Worker loop: run own jobs first, then steal from the other worker
+ * @param arg The Batch_Worker_t of the thread
+ * @return NULL
+ */
+static void * Batch_Worker(void * arg)
+{
+    Batch_Worker_t * worker = arg;
+    Batch_Pool_t * pool = worker->Pool;
+
+    /* One context per worker, reset between job */
+    Emu_Context_t * ctx = Emu_Create();
+    if(ctx != NULL)
+    {
+        Ppu_SetRenderInterval(ctx, pool->Render);
+    }
+
+    for(;;)
+    {
+        int job = Batch_Pop(&worker->Queue);
+        if(job < 0)
+        {
+            job = Batch_Steal(pool, worker->Id);
+        }
+        if(job < 0)
+        {
+            /* Jobs never spawn new jobs: all deques are empty */
+            break;
+        }
+
+        if(ctx == NULL)
+        {
+            pool->Result[job].Status = -1;
+            pool->Result[job].Error = "out of memory";
+            continue;
+        }
+        Batch_Execute(ctx, pool, &pool->Result[job]);
+    }
+
+    Emu_Destroy(ctx);
+    return NULL;
+}
+
+
+/**
+ * Take the most recent job of a deque (owner side)
+ * @param queue The worker own deque
+ * @return The job index, -1 if the deque is empty
+ */
+static int Batch_Pop(Batch_Queue_t * queue)
+{
+    int job = -1;
+
+    pthread_mutex_lock(&queue->Lock);
+    if(queue->Top < queue->Bottom)
+    {
+        job = -- queue->Bottom;
+    }
+    pthread_mutex_unlock(&queue->Lock);
+
+    return job;
+}
+
+
+/**
+ * Take the oldest job of another worker deque (thief side)
+ * @param pool The thread pool
+ * @param thief The index of the stealing worker
+ * @return The job index, -1 if all deques are empty
+ */
+static int Batch_Steal(Batch_Pool_t * pool, int thief)
+{
+    int const start = (thief < 0) ? 0 : thief;
+
+    for(int i=1; i<=pool->WorkerCount; i++)
+    {
+        Batch_Queue_t * queue = &pool->Worker[(start + i) % pool->WorkerCount].Queue;
+        int job = -1;
+
+        pthread_mutex_lock(&queue->Lock);
+        if(queue->Top < queue->Bottom)
+        {
+            job = queue->Top ++;
+        }
+        pthread_mutex_unlock(&queue->Lock);
+
+        if(job >= 0)
+        {
+            return job;
+        }
+    }
+
+    return -1;
+}
+
+
+/**
+ * Run one instance from the post-boot state or from the savestate and record its final state
+ * @param ctx The worker emulator context
+ * @param pool The pool (cycle budget and savestate)
+ * @param result The result to fill (File is set)
+ */
+static void Batch_Execute(Emu_Context_t * ctx, Batch_Pool_t const * pool, Batch_Result_t * result)
+{
+    Emu_Reset(ctx);
+    if(Cartridge_Load(ctx, result->File) != 0)
+    {
+        result->Status = -1;
+        result->Error = "cannot load the cartridge";
+        return;
+    }
+    Emu_SkipBoot(ctx);
+    if((pool->State != NULL) && (State_Load(ctx, pool->State, pool->StateSize) != 0))
+    {
+        result->Status = -1;
+        result->Error = "cannot load the savestate";
+        return;
+    }
+
+    /* Run frame by frame so the budget is not exceeded by more than a block */
+    uint64_t const start = ctx->Cpu.Cycle;
+    uint64_t const end = start + pool->Cycle;
+    while((ctx->Cpu.Cycle < end) && !ctx->Cpu.Locked)
+    {
+        uint64_t const remaining = end - ctx->Cpu.Cycle;
+        Emu_Run(ctx, (remaining > BATCH_FRAME_CYCLE) ? BATCH_FRAME_CYCLE : remaining);
+    }
+
+    /* Only this instance is lost */
+    if(ctx->Cpu.Locked)
+    {
+        result->Status = -1;
+        result->Error = "CPU locked by an illegal opcode";
+        return;
+    }
+
+    uint32_t hash = BATCH_FNV_BASIS;
+    for(uint32_t i=0; i<MEMORY_TABLE_SIZE; i++)
+    {
+        hash ^= Memory_Read(ctx, (uint16_t)i);
+        hash *= BATCH_FNV_PRIME;
+    }
+
+    uint8_t const * frame = Ppu_GetFrame(ctx);
+    uint32_t frameHash = BATCH_FNV_BASIS;
+    for(uint32_t i=0; i<PPU_SCREEN_WIDTH * PPU_SCREEN_HEIGHT; i++)
+    {
+        frameHash ^= frame[i];
+        frameHash *= BATCH_FNV_PRIME;
+    }
+
+    result->Status = 0;
+    result->Cycle = ctx->Cpu.Cycle - start;
+    result->Hash = hash;
+    result->Frame = Ppu_GetFrameCount(ctx);
+    result->FrameHash = frameHash;
+    Cpu_SyncFlag(ctx);
+    for(int i=0; i<CPU_REG_NUM; i++)
+    {
+        result->Reg[i] = CPU_REG16(ctx, i)->UWord;
+    }
+}
+
+
+/**
+ * Get the number of online host core
+ * @return The number of core, at least 1
+ */
+static int Batch_GetCoreCount(void)
+{
+    long const count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count < 1) ? 1 : (int)count;
+}
+
+
+/**
+ * Get a monotonic time
+ * @return The time in second
+ */
+static double Batch_GetTime(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
@@ -0,0 +1,75 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Number of cycle of one frame */
+#define BATCH_FRAME_CYCLE   70224
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Run many emulator instance in parallel and print their final state
+ * @param argc The number of argument following --batch
+ * @param argv The argument list: [-c cycle] [-f frame] [-r render] [-j thread] [-s state] file...
+ * @note A cartridge start at 0x0100 in the state left by the DMG boot ROM
+ * @note -r render every Nth frame (0: none, keep timing and interrupt)
+ * @note -s start every instance from a savestate instead, the budget and the reported cycle count from it
+ * @return 0 if all instance ran, otherwise 1
+ */
+extern int Batch_Run(int argc, char const * argv[]);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _BATCH_H_ */
@@ -0,0 +1,491 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* Required for mmap and fstat */
+#define _POSIX_C_SOURCE 200809L
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Cartridge type header address */
+#define CARTRIDGE_HEADER_TYPE       0x0147
+
+/** RAM size header address */
+#define CARTRIDGE_HEADER_RAM_SIZE   0x0149
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static void Cartridge_Unload(Emu_Context_t * ctx);
+static int Cartridge_AllocateRam(Emu_Context_t * ctx, size_t size);
+static void Cartridge_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static Cartridge_Mbc_e Cartridge_GetMbc(uint8_t type);
+static size_t Cartridge_GetRamSize(uint8_t code);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+int Cartridge_Initialize(Emu_Context_t * ctx)
+{
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+
+    Cartridge_Unload(ctx);
+
+    /* Without cartridge: flat 32 KiB ROM and 8 KiB RAM always enabled */
+    memset(cart->Flat, 0, sizeof(cart->Flat));
+    cart->Rom          = cart->Flat;
+    cart->RomSize      = sizeof(cart->Flat);
+    cart->Mbc          = CARTRIDGE_MBC_NONE;
+    cart->RomBankCount = cart->RomSize / CARTRIDGE_ROM_BANK_SIZE;
+
+    if(Cartridge_AllocateRam(ctx, CARTRIDGE_RAM_BANK_SIZE) != 0)
+    {
+        return -1;
+    }
+
+    Cartridge_Reset(ctx);
+    return 0;
+}
+
+
+void Cartridge_Reset(Emu_Context_t * ctx)
+{
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+
+    /* A bank controller gate the RAM */
+    cart->RomBank    = 1;
+    cart->RamBank    = 0;
+    cart->Mode       = 0;
+    cart->RamEnabled = (cart->Mbc == CARTRIDGE_MBC_NONE);
+
+    Cartridge_MapRom(ctx);
+    Cartridge_MapRam(ctx);
+}
+
+
+void Cartridge_Finalize(Emu_Context_t * ctx)
+{
+    Cartridge_Unload(ctx);
+    Cartridge_AllocateRam(ctx, 0);
+}
+
+
+int Cartridge_Load(Emu_Context_t * ctx, char const * file)
+{
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+
+    if(Cartridge_Initialize(ctx) != 0)
+    {
+        return -1;
+    }
+
+    int fd = open(file, O_RDONLY);
+    struct stat st;
+    if((fd < 0) || (fstat(fd, &st) != 0))
+    {
+        DEBUGGER_ERROR("Cartridge Error: %s: %s\n", file, strerror(errno));
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+        return -1;
+    }
+
+    /* Test program: copy it in the flat ROM */
+    if((size_t)st.st_size < sizeof(cart->Flat))
+    {
+        ssize_t const size = read(fd, cart->Flat, st.st_size);
+        close(fd);
+        Cpu_FlushCache(ctx);
+        return (size == st.st_size) ? 0 : -1;
+    }
+
+    /* Cartridge: share the file page read only, bank switching remaps them */
+    void * rom = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    uint32_t * ref = malloc(sizeof(uint32_t));
+    if((rom == MAP_FAILED) || (ref == NULL))
+    {
+        DEBUGGER_ERROR("Cartridge Error: %s: %s\n", file, strerror(errno));
+        if(rom != MAP_FAILED)
+        {
+            munmap(rom, st.st_size);
+        }
+        free(ref);
+        return -1;
+    }
+
+    *ref = 1;
+    cart->Rom          = rom;
+    cart->RomSize      = st.st_size;
+    cart->MapSize      = st.st_size;
+    cart->MapRef       = ref;
+    cart->RomBankCount = st.st_size / CARTRIDGE_ROM_BANK_SIZE;
+    cart->Mbc          = Cartridge_GetMbc(cart->Rom[CARTRIDGE_HEADER_TYPE]);
+
+    /* RAM size of a bank controller comes from the header */
+    if(cart->Mbc != CARTRIDGE_MBC_NONE)
+    {
+        if(Cartridge_AllocateRam(ctx, Cartridge_GetRamSize(cart->Rom[CARTRIDGE_HEADER_RAM_SIZE])) != 0)
+        {
+            Cartridge_Initialize(ctx);
+            return -1;
+        }
+    }
+
+    Cartridge_Reset(ctx);
+    Cpu_FlushCache(ctx);
+
+    return 0;
+}
+
+
+void Cartridge_Share(Emu_Context_t * fork, Emu_Context_t const * ctx)
+{
+    Cartridge_Info_t * cart = &fork->Cartridge;
+    Cartridge_Info_t const * src = &ctx->Cartridge;
+
+    Cartridge_Unload(fork);
+    if(src->MapSize != 0)
+    {
+        __atomic_add_fetch(src->MapRef, 1, __ATOMIC_RELAXED);
+        cart->Rom     = src->Rom;
+        cart->MapSize = src->MapSize;
+        cart->MapRef  = src->MapRef;
+    }
+    else
+    {
+        memcpy(cart->Flat, src->Flat, sizeof(cart->Flat));
+    }
+
+    cart->RomSize      = src->RomSize;
+    cart->RamSize      = src->RamSize;
+    cart->Mbc          = src->Mbc;
+    cart->RomBankCount = src->RomBankCount;
+    cart->RomBank      = src->RomBank;
+    cart->RamBank      = src->RamBank;
+    cart->Mode         = src->Mode;
+    cart->RamEnabled   = src->RamEnabled;
+
+    Cartridge_MapRom(fork);
+    Cartridge_MapRam(fork);
+}
+
+
+void Cartridge_MapRom(Emu_Context_t * ctx)
+{
+    Cartridge_Info_t const * cart = &ctx->Cartridge;
+    uint32_t bank0 = 0;
+    uint32_t bank1 = cart->RomBank;
+
+    /* MBC1 use the RAM bank register as ROM bank upper bit */
+    if(cart->Mbc == CARTRIDGE_MBC_1)
+    {
+        bank1 |= cart->RamBank << 5;
+        if(cart->Mode != 0)
+        {
+            bank0 = cart->RamBank << 5;
+        }
+    }
+    bank0 %= cart->RomBankCount;
+    bank1 %= cart->RomBankCount;
+
+    uint8_t const * const rom0 = cart->Rom + bank0 * CARTRIDGE_ROM_BANK_SIZE;
+    uint8_t const * const rom1 = cart->Rom + bank1 * CARTRIDGE_ROM_BANK_SIZE;
+
+    /* Drop the instruction decoded from the previous bank */
+    if(ctx->Memory.MapRead[0x40] != rom1)
+    {
+        Memory_Map(ctx, 0x4000, CARTRIDGE_ROM_BANK_SIZE, rom1, NULL, NULL, Cartridge_Write);
+        Cpu_InvalidateRange(ctx, 0x4000, CARTRIDGE_ROM_BANK_SIZE);
+    }
+    if(ctx->Memory.MapRead[0x01] != rom0 + MEMORY_PAGE_SIZE)
+    {
+        Memory_Map(ctx, 0x0000, CARTRIDGE_ROM_BANK_SIZE, rom0, NULL, NULL, Cartridge_Write);
+        Cpu_InvalidateRange(ctx, 0x0000, CARTRIDGE_ROM_BANK_SIZE);
+    }
+
+    /* Boot ROM overlay stay on top */
+    uint8_t const * const page0 = ctx->Memory.BootEnabled ? ctx->Memory.Boot : rom0;
+    if(ctx->Memory.MapRead[0x00] != page0)
+    {
+        Memory_Map(ctx, 0x0000, MEMORY_PAGE_SIZE, page0, NULL, NULL, Cartridge_Write);
+        Cpu_InvalidateRange(ctx, 0x0000, MEMORY_PAGE_SIZE);
+    }
+}
+
+
+/**
+ * Unmap the cartridge file
+ * @param ctx The emulator context
+ */
+static void Cartridge_Unload(Emu_Context_t * ctx)
+{
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+
+    /* The last context using the file mapping unmap it */
+    if(cart->MapSize != 0)
+    {
+        if(__atomic_sub_fetch(cart->MapRef, 1, __ATOMIC_ACQ_REL) == 0)
+        {
+            munmap((void *)cart->Rom, cart->MapSize);
+            free(cart->MapRef);
+        }
+        cart->MapRef = NULL;
+        cart->MapSize = 0;
+    }
+    cart->Rom = cart->Flat;
+    cart->RomSize = sizeof(cart->Flat);
+}
+
+
+/**
+ * Allocate a cleared external RAM
+ * @param ctx The emulator context
+ * @param size The RAM size (bank multiple, 0 if none)
+ * @return 0 if successful, otherwise -1
+ */
+static int Cartridge_AllocateRam(Emu_Context_t * ctx, size_t size)
+{
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+    int const count = size / CARTRIDGE_RAM_BANK_SIZE;
+
+    assert(count <= MEMORY_BANK_COUNT - MEMORY_BANK_EXTERNAL);
+
+    cart->RamSize = 0;
+    for(int i=MEMORY_BANK_EXTERNAL; i<MEMORY_BANK_COUNT; i++)
+    {
+        if(i < MEMORY_BANK_EXTERNAL + count)
+        {
+            if(Memory_AllocateBank(ctx, i) != 0)
+            {
+                return -1;
+            }
+        }
+        else
+        {
+            Memory_ReleaseBank(ctx, i);
+        }
+    }
+    cart->RamSize = size;
+
+    return 0;
+}
+
+
+void Cartridge_MapRam(Emu_Context_t * ctx)
+{
+    Cartridge_Info_t const * cart = &ctx->Cartridge;
+    uint8_t ram = MEMORY_BANK_NONE;
+
+    if(cart->RamEnabled && (cart->RamSize != 0))
+    {
+        uint32_t bank = 0;
+        switch(cart->Mbc)
+        {
+            case CARTRIDGE_MBC_1:
+                bank = (cart->Mode != 0) ? cart->RamBank : 0;
+                break;
+            case CARTRIDGE_MBC_3:
+                /* 0x08-0x0C select the (unsupported) RTC register */
+                bank = (cart->RamBank <= 0x03) ? cart->RamBank : UINT32_MAX;
+                break;
+            case CARTRIDGE_MBC_5:
+                bank = cart->RamBank;
+                break;
+            default:
+                break;
+        }
+
+        if(bank != UINT32_MAX)
+        {
+            ram = MEMORY_BANK_EXTERNAL + bank % (cart->RamSize / CARTRIDGE_RAM_BANK_SIZE);
+        }
+    }
+
+    if(ctx->Memory.MapBank[0xA0] != ram)
+    {
+        if(ram != MEMORY_BANK_NONE)
+        {
+            Memory_MapBank(ctx, 0xA000, CARTRIDGE_RAM_BANK_SIZE, ram, NULL);
+        }
+        else
+        {
+            Memory_Map(ctx, 0xA000, CARTRIDGE_RAM_BANK_SIZE, NULL, NULL, NULL, NULL);
+        }
+        Cpu_InvalidateRange(ctx, 0xA000, CARTRIDGE_RAM_BANK_SIZE);
+    }
+}
+
+
+/**
+ * Write a bank controller register (0x0000-0x7FFF)
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @param data The data to write
+ */
+static void Cartridge_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+
+    if(cart->Mbc == CARTRIDGE_MBC_NONE)
+    {
+        return;
+    }
+
+    /* 0x0000-0x1FFF: RAM enable is common to all controller */
+    if(addr < 0x2000)
+    {
+        cart->RamEnabled = ((data & 0x0F) == 0x0A);
+        Cartridge_MapRam(ctx);
+        return;
+    }
+
+    switch(cart->Mbc)
+    {
+        case CARTRIDGE_MBC_1:
+            if(addr < 0x4000)
+            {
+                cart->RomBank = ((data & 0x1F) == 0) ? 1 : (data & 0x1F);
+            }
+            else if(addr < 0x6000)
+            {
+                cart->RamBank = data & 0x03;
+            }
+            else
+            {
+                cart->Mode = data & 0x01;
+            }
+            break;
+
+        case CARTRIDGE_MBC_3:
+            if(addr < 0x4000)
+            {
+                cart->RomBank = ((data & 0x7F) == 0) ? 1 : (data & 0x7F);
+            }
+            else if(addr < 0x6000)
+            {
+                cart->RamBank = data;
+            }
+            /* 0x6000-0x7FFF: RTC latch is not supported */
+            break;
+
+        case CARTRIDGE_MBC_5:
+            if(addr < 0x3000)
+            {
+                cart->RomBank = (cart->RomBank & 0x100) | data;
+            }
+            else if(addr < 0x4000)
+            {
+                cart->RomBank = (cart->RomBank & 0x0FF) | ((data & 0x01) << 8);
+            }
+            else if(addr < 0x6000)
+            {
+                cart->RamBank = data & 0x0F;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    Cartridge_MapRom(ctx);
+    Cartridge_MapRam(ctx);
+}
+
+
+/**
+ * Get the bank controller of a cartridge type header
+ * @param type The cartridge type (0x0147)
+ * @return The bank controller
+ */
+static Cartridge_Mbc_e Cartridge_GetMbc(uint8_t type)
+{
+    switch(type)
+    {
+        case 0x00: case 0x08: case 0x09:
+            return CARTRIDGE_MBC_NONE;
+        case 0x01: case 0x02: case 0x03:
+            return CARTRIDGE_MBC_1;
+        case 0x0F: case 0x10: case 0x11: case 0x12: case 0x13:
+            return CARTRIDGE_MBC_3;
+        case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E:
+            return CARTRIDGE_MBC_5;
+        default:
+            DEBUGGER_WARNING("Cartridge Warning: unsupported type 0x%02x, no bank switching\n", type);
+            return CARTRIDGE_MBC_NONE;
+    }
+}
+
+
+/**
+ * Get the external RAM size of a RAM size header
+ * @param code The RAM size code (0x0149)
+ * @return The RAM size, at least one full bank if present
+ */
+static size_t Cartridge_GetRamSize(uint8_t code)
+{
+    switch(code)
+    {
+        case 0x01: /* 2 KiB, mirrored over the bank */
+        case 0x02: return 1 * CARTRIDGE_RAM_BANK_SIZE;
+        case 0x03: return 4 * CARTRIDGE_RAM_BANK_SIZE;
+        case 0x04: return 16 * CARTRIDGE_RAM_BANK_SIZE;
+        case 0x05: return 8 * CARTRIDGE_RAM_BANK_SIZE;
+        default:   return 0;
+    }
+}
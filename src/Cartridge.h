@@ -0,0 +1,147 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _CARTRIDGE_H_
+#define _CARTRIDGE_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** ROM bank size */
+#define CARTRIDGE_ROM_BANK_SIZE     0x4000
+
+/** External RAM bank size */
+#define CARTRIDGE_RAM_BANK_SIZE     0x2000
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Memory bank controller type */
+typedef enum tagCartridge_Mbc_e
+{
+    CARTRIDGE_MBC_NONE,     /**< 32 KiB ROM only */
+    CARTRIDGE_MBC_1,        /**< MBC1: 2 MiB ROM, 32 KiB RAM */
+    CARTRIDGE_MBC_3,        /**< MBC3: 2 MiB ROM, 32 KiB RAM (no RTC) */
+    CARTRIDGE_MBC_5         /**< MBC5: 8 MiB ROM, 128 KiB RAM */
+} Cartridge_Mbc_e;
+
+/** Cartridge Info */
+typedef struct tagCartridge_Info_t
+{
+    uint8_t const * Rom;                        /**< ROM content (file mapping or Flat) */
+    size_t RomSize;                             /**< ROM size */
+    size_t MapSize;                             /**< File mapping size (0 if not mapped) */
+    uint32_t * MapRef;                          /**< Number of context sharing the file mapping (atomic) */
+    size_t RamSize;                             /**< External RAM size (bank from MEMORY_BANK_EXTERNAL) */
+    Cartridge_Mbc_e Mbc;                        /**< Bank controller type */
+    uint16_t RomBankCount;                      /**< Number of ROM bank */
+    uint16_t RomBank;                           /**< ROM bank register */
+    uint8_t RamBank;                            /**< RAM bank register (MBC1: ROM bank upper bit) */
+    uint8_t Mode;                               /**< MBC1 banking mode */
+    bool RamEnabled;                            /**< External RAM access enabled */
+    uint8_t Flat[2 * CARTRIDGE_ROM_BANK_SIZE];  /**< ROM of a file too small to be a cartridge */
+} Cartridge_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Remove the cartridge and map an empty 32 KiB ROM
+ * @param ctx The emulator context
+ * @return 0 if successful, otherwise -1
+ */
+extern int Cartridge_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Reset the bank controller and map the cartridge (content is kept)
+ * @param ctx The emulator context
+ */
+extern void Cartridge_Reset(Emu_Context_t * ctx);
+
+/**
+ * Release cartridge resource
+ * @param ctx The emulator context
+ */
+extern void Cartridge_Finalize(Emu_Context_t * ctx);
+
+/**
+ * Insert a cartridge ROM file
+ * @param ctx The emulator context
+ * @param file The ROM file name
+ * @return 0 if successful, otherwise -1
+ * @note The ROM is mapped read only so every instance share the same physical page.
+ *       A file smaller than 32 KiB (test program) is copied instead.
+ */
+extern int Cartridge_Load(Emu_Context_t * ctx, char const * file);
+
+/**
+ * Insert the cartridge of a context in its fork
+ * @param fork The emulator context receiving the cartridge
+ * @param ctx The emulator context to fork
+ * @note The file mapping is shared, the external RAM bank must be shared first (Memory_Share)
+ */
+extern void Cartridge_Share(Emu_Context_t * fork, Emu_Context_t const * ctx);
+
+/**
+ * Map the selected ROM bank in the memory page table
+ * @param ctx The emulator context
+ */
+extern void Cartridge_MapRom(Emu_Context_t * ctx);
+
+/**
+ * Map the selected external RAM bank in the memory page table
+ * @param ctx The emulator context
+ */
+extern void Cartridge_MapRam(Emu_Context_t * ctx);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _CARTRIDGE_H_ */
@@ -27,11 +27,17 @@
 /******************************************************/
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <Cpu.h>
+#include <CpuTable.h>
+#include <CpuOpCode.h>
 #include <Memory.h>
 #include <Debugger.h>
+#include <Dynarec.h>
 
 
 /******************************************************/
@@ -43,6 +49,11 @@
  */
 #define CPU_NULL    0
 
+/**
+ * OpCode parameter: add/substract the carry flag (ADC/SBC)
+ */
+#define CPU_CARRY   1
+
 /**
  * Concat 2 Byte data to 1 Word
  * @param data0 The first Byte
@@ -51,23 +62,194 @@
 #define CONCAT(data0, data1) ((data1) << 8 | (data0))
 
 /**
- * Set a Flag
+ * Set a Flag (per-flag evaluation, reference of the flag table)
+ * @param ctx The emulator context
  * @param flag The Cpu_FlagName_e flag
  */
-#define CPU_FLAG_SET(flag) do{ CPU_REG8(CPU_R_F)->UByte |= (flag); } while(0)
+#define CPU_FLAG_SET(ctx, flag) do{ CPU_REG8(ctx, CPU_R_F)->UByte |= (flag); } while(0)
 
 /**
- * Clear a Flag
+ * Clear a Flag (per-flag evaluation, reference of the flag table)
+ * @param ctx The emulator context
  * @param flag The Cpu_FlagName_e flag
  */
-#define CPU_FLAG_CLEAR(flag) do{ CPU_REG8(CPU_R_F)->UByte &= ~(flag); } while(0)
+#define CPU_FLAG_CLEAR(ctx, flag) do{ CPU_REG8(ctx, CPU_R_F)->UByte &= ~(flag); } while(0)
 
 /**
  * Check flag
+ * @param ctx The emulator context
  * @param mask The mask bitmap to apply to flag before comparison
  * @param compare The comparison bitmap to check
  */
-#define CPU_FLAG_CHECK(mask, compare) ((CPU_REG8(CPU_R_F)->UByte & mask) == compare)
+#define CPU_FLAG_CHECK(ctx, mask, compare) ((Cpu_GetFlag(ctx) & (mask)) == (compare))
+
+/**
+ * Number of entry in the decoded instruction cache (power of 2)
+ */
+#define CPU_DECODE_CACHE_SIZE   0x1000
+
+/**
+ * Get the decoded instruction cache entry of an address
+ * @param ctx The emulator context
+ * @param addr The instruction address
+ */
+#define CPU_DECODE_ENTRY(ctx, addr)  (&(ctx)->Cpu.Cache->Decode[(addr) & (CPU_DECODE_CACHE_SIZE - 1)])
+
+/**
+ * Number of entry in the translated block cache (power of 2)
+ */
+#define CPU_BLOCK_CACHE_SIZE    0x0200
+
+/**
+ * Max number of instruction in a translated block
+ */
+#define CPU_BLOCK_LENGTH        16
+
+/**
+ * Max number of byte covered by a translated block
+ */
+#define CPU_BLOCK_SPAN          (CPU_BLOCK_LENGTH * 3)
+
+/**
+ * Get the translated block cache entry of an address
+ * @param ctx The emulator context
+ * @param addr The block start address
+ */
+#define CPU_BLOCK_ENTRY(ctx, addr)   (&(ctx)->Cpu.Cache->Block[(addr) & (CPU_BLOCK_CACHE_SIZE - 1)])
+
+/**
+ * Check if an address belong to a cached instruction or translated block
+ * @param ctx The emulator context
+ * @param addr The address to check
+ */
+#define CPU_IS_CODE(ctx, addr)       ((ctx)->Cpu.Cache->CodeCount[(uint16_t)(addr)] != 0)
+
+/**
+ * Check if an address has a breakpoint
+ * @param ctx The emulator context
+ * @param addr The address to check
+ */
+#define CPU_IS_BREAK(ctx, addr)      ((ctx)->Cpu.Cache->BreakMap[(addr) >> 3] & (1 << ((addr) & 7)))
+
+/**
+ * Declare the execution callback of an OpCode description entry
+ * @param prefix The table prefix (M for main, P for CB prefix)
+ * @param value The OpCode value
+ */
+#define CPU_OPCODE_PROTOTYPE(prefix, value, size, cycle, taken, name, nameParam, execute, param0, param1) \
+    static int Cpu_OpCode_##prefix##value(Emu_Context_t * ctx, Cpu_OpCode_t const * const opcode);
+#define CPU_OPCODE_PROTOTYPE_M(...)     CPU_OPCODE_PROTOTYPE(M, __VA_ARGS__)
+#define CPU_OPCODE_PROTOTYPE_P(...)     CPU_OPCODE_PROTOTYPE(P, __VA_ARGS__)
+
+/**
+ * Define the execution callback of an OpCode description entry
+ * @note The handler is inlined with constant parameter so each OpCode get its own specialized code
+ * @param prefix The table prefix (M for main, P for CB prefix)
+ * @param value The OpCode value
+ * @param cycle The cycle duration (condition not met)
+ * @param taken The cycle duration of a taken jump
+ * @param execute The handler suffix
+ * @param param0 The first handler parameter
+ * @param param1 The second handler parameter
+ */
+#define CPU_OPCODE_CALLBACK(prefix, value, size, cycle, taken, name, nameParam, execute, param0, param1) \
+    static int Cpu_OpCode_##prefix##value(Emu_Context_t * ctx, Cpu_OpCode_t const * const opcode) \
+    { \
+        /* Unused parameter */ \
+        (void) opcode; \
+        return Cpu_Execute_##execute(ctx, param0, param1) ? (taken) : (cycle); \
+    }
+#define CPU_OPCODE_CALLBACK_M(...)      CPU_OPCODE_CALLBACK(M, __VA_ARGS__)
+#define CPU_OPCODE_CALLBACK_P(...)      CPU_OPCODE_CALLBACK(P, __VA_ARGS__)
+
+/**
+ * OpCode table entry of an OpCode description entry
+ * @param prefix The table prefix (M for main, P for CB prefix)
+ */
+#define CPU_OPCODE_ENTRY(prefix, value, size, cycle, taken, name, nameParam, execute, param0, param1) \
+    {value, size, cycle, name, nameParam, param0, param1, Cpu_OpCode_##prefix##value, CPU_ATTR_##execute},
+#define CPU_OPCODE_ENTRY_M(...)         CPU_OPCODE_ENTRY(M, __VA_ARGS__)
+#define CPU_OPCODE_ENTRY_P(...)         CPU_OPCODE_ENTRY(P, __VA_ARGS__)
+
+/**
+ * Dispatch an OpCode table entry by direct call
+ * @note The table is constant so each case is resolved at compile time
+ * @param base The first dispatch index of the table
+ * @param table The OpCode table
+ * @param n The OpCode value
+ */
+#define CPU_DISPATCH_1(base, table, n)  case (base) + (n): return table[n].Callback(ctx, &table[n]);
+#define CPU_DISPATCH_4(base, table, n)  CPU_DISPATCH_1(base, table, (n))        CPU_DISPATCH_1(base, table, (n) + 0x01) \
+                                        CPU_DISPATCH_1(base, table, (n) + 0x02) CPU_DISPATCH_1(base, table, (n) + 0x03)
+#define CPU_DISPATCH_16(base, table, n) CPU_DISPATCH_4(base, table, (n))        CPU_DISPATCH_4(base, table, (n) + 0x04) \
+                                        CPU_DISPATCH_4(base, table, (n) + 0x08) CPU_DISPATCH_4(base, table, (n) + 0x0C)
+#define CPU_DISPATCH_64(base, table, n) CPU_DISPATCH_16(base, table, (n))        CPU_DISPATCH_16(base, table, (n) + 0x10) \
+                                        CPU_DISPATCH_16(base, table, (n) + 0x20) CPU_DISPATCH_16(base, table, (n) + 0x30)
+#define CPU_DISPATCH_256(base, table)   CPU_DISPATCH_64(base, table, 0x00)       CPU_DISPATCH_64(base, table, 0x40) \
+                                        CPU_DISPATCH_64(base, table, 0x80)       CPU_DISPATCH_64(base, table, 0xC0)
+
+#if defined(CPU_DISPATCH_GOTO)
+#  if !defined(__GNUC__)
+#    error "CPU_DISPATCH_GOTO requires GCC computed goto"
+#  endif
+
+/**
+ * Threaded code label address of an OpCode table entry
+ * @param prefix The table label prefix
+ * @param h The OpCode high hexadecimal digit
+ * @param l The OpCode low hexadecimal digit
+ */
+#define CPU_LABEL_1(prefix, h, l)       &&Cpu_Label_##prefix##h##l,
+#define CPU_LABEL_16(prefix, h)         CPU_LABEL_1(prefix, h, 0) CPU_LABEL_1(prefix, h, 1) CPU_LABEL_1(prefix, h, 2) CPU_LABEL_1(prefix, h, 3) \
+                                        CPU_LABEL_1(prefix, h, 4) CPU_LABEL_1(prefix, h, 5) CPU_LABEL_1(prefix, h, 6) CPU_LABEL_1(prefix, h, 7) \
+                                        CPU_LABEL_1(prefix, h, 8) CPU_LABEL_1(prefix, h, 9) CPU_LABEL_1(prefix, h, A) CPU_LABEL_1(prefix, h, B) \
+                                        CPU_LABEL_1(prefix, h, C) CPU_LABEL_1(prefix, h, D) CPU_LABEL_1(prefix, h, E) CPU_LABEL_1(prefix, h, F)
+#define CPU_LABEL_256(prefix)           CPU_LABEL_16(prefix, 0) CPU_LABEL_16(prefix, 1) CPU_LABEL_16(prefix, 2) CPU_LABEL_16(prefix, 3) \
+                                        CPU_LABEL_16(prefix, 4) CPU_LABEL_16(prefix, 5) CPU_LABEL_16(prefix, 6) CPU_LABEL_16(prefix, 7) \
+                                        CPU_LABEL_16(prefix, 8) CPU_LABEL_16(prefix, 9) CPU_LABEL_16(prefix, A) CPU_LABEL_16(prefix, B) \
+                                        CPU_LABEL_16(prefix, C) CPU_LABEL_16(prefix, D) CPU_LABEL_16(prefix, E) CPU_LABEL_16(prefix, F)
+
+/**
+ * Threaded code of an OpCode table entry: execute it then jump to the next instruction
+ * @note The table entry is a constant so the handler is called with constant parameter
+ * @param prefix The table label prefix
+ * @param table The OpCode table
+ * @param h The OpCode high hexadecimal digit
+ * @param l The OpCode low hexadecimal digit
+ */
+#define CPU_THREAD_1(prefix, table, h, l) \
+    Cpu_Label_##prefix##h##l: \
+        cycle += table[0x##h##l].Callback(ctx, &table[0x##h##l]); \
+        CPU_THREAD_NEXT();
+#define CPU_THREAD_16(prefix, table, h) \
+    CPU_THREAD_1(prefix, table, h, 0) CPU_THREAD_1(prefix, table, h, 1) CPU_THREAD_1(prefix, table, h, 2) CPU_THREAD_1(prefix, table, h, 3) \
+    CPU_THREAD_1(prefix, table, h, 4) CPU_THREAD_1(prefix, table, h, 5) CPU_THREAD_1(prefix, table, h, 6) CPU_THREAD_1(prefix, table, h, 7) \
+    CPU_THREAD_1(prefix, table, h, 8) CPU_THREAD_1(prefix, table, h, 9) CPU_THREAD_1(prefix, table, h, A) CPU_THREAD_1(prefix, table, h, B) \
+    CPU_THREAD_1(prefix, table, h, C) CPU_THREAD_1(prefix, table, h, D) CPU_THREAD_1(prefix, table, h, E) CPU_THREAD_1(prefix, table, h, F)
+#define CPU_THREAD_256(prefix, table) \
+    CPU_THREAD_16(prefix, table, 0) CPU_THREAD_16(prefix, table, 1) CPU_THREAD_16(prefix, table, 2) CPU_THREAD_16(prefix, table, 3) \
+    CPU_THREAD_16(prefix, table, 4) CPU_THREAD_16(prefix, table, 5) CPU_THREAD_16(prefix, table, 6) CPU_THREAD_16(prefix, table, 7) \
+    CPU_THREAD_16(prefix, table, 8) CPU_THREAD_16(prefix, table, 9) CPU_THREAD_16(prefix, table, A) CPU_THREAD_16(prefix, table, B) \
+    CPU_THREAD_16(prefix, table, C) CPU_THREAD_16(prefix, table, D) CPU_THREAD_16(prefix, table, E) CPU_THREAD_16(prefix, table, F)
+#endif
+
+/**
+ * Get the next value of a Cpu_CheckDynarec pseudo random sequence (15 bit)
+ * @param seed The sequence state
+ */
+#define CPU_CHECK_RANDOM(seed)  (((seed) = (seed) * 1103515245 + 12345) >> 16 & 0x7FFF)
+
+/** Work RAM address (checked by Cpu_CheckDynarec) */
+#define CPU_CHECK_WRAM          0xC000
+
+/** Work RAM size (checked by Cpu_CheckDynarec) */
+#define CPU_CHECK_WRAM_SIZE     0x2000
+
+/** High RAM address (checked by Cpu_CheckDynarec) */
+#define CPU_CHECK_HRAM          0xFF80
+
+/** High RAM size (checked by Cpu_CheckDynarec) */
+#define CPU_CHECK_HRAM_SIZE     0x7F
 
 
 /******************************************************/
@@ -79,23 +261,48 @@ typedef struct tagCpu_OpCode_t Cpu_OpCode_t;
 
 /**
  * Callback to Execute an OpCode
+ * @param ctx The emulator context
  * @param opcode The opcode to execute
  * @return The number of cycle used to execute the opcode
  */
-typedef int (*Cpu_Callback_t)(Cpu_OpCode_t const * const opcode);
+typedef int (*Cpu_Callback_t)(Emu_Context_t * ctx, Cpu_OpCode_t const * const opcode);
 
 /** CPU OpCode information */
 typedef struct tagCpu_OpCode_t
 {
     uint32_t Value;     /**< OpCode Value */
     uint32_t Size;      /**< OpCode Byte size */
+    uint32_t Cycle;     /**< OpCode cycle duration (condition not met) */
     char const * Name;  /**< OpCode Name */
     uint32_t NameParam; /**< OpCode Name parameter type */
     uint32_t Param0;    /**< OpCode Param 1 */
     uint32_t Param1;    /**< Opcode Param 2 */
     Cpu_Callback_t Callback; /**< OpCode execution callback */
+    uint32_t Attr;      /**< OpCode Cpu_Attr_e bitmap */
 } Cpu_OpCode_t;
 
+/** CPU OpCode attribute */
+typedef enum tagCpu_Attr_e
+{
+    CPU_A_NONE = 0x00,  /**< No attribute */
+    CPU_A_END  = 0x01,  /**< Can modify PC or the interrupt state (end a translated block) */
+    CPU_A_IDLE = 0x02,  /**< Only modify CPU register (no memory write nor stack access) */
+    CPU_A_JR   = 0x04   /**< Relative jump (polling loop candidate) */
+} Cpu_Attr_e;
+
+/** 8 bit rotation/shift operation (CB prefix OpCode order) */
+typedef enum tagCpu_Rot_e
+{
+    CPU_ROT_RLC,    /**< Rotate left (bit 7 to carry and bit 0) */
+    CPU_ROT_RRC,    /**< Rotate right (bit 0 to carry and bit 7) */
+    CPU_ROT_RL,     /**< Rotate left through carry */
+    CPU_ROT_RR,     /**< Rotate right through carry */
+    CPU_ROT_SLA,    /**< Shift left (bit 0 cleared) */
+    CPU_ROT_SRA,    /**< Arithmetic shift right (bit 7 kept) */
+    CPU_ROT_SWAP,   /**< Swap nibble (carry cleared) */
+    CPU_ROT_SRL     /**< Logical shift right (bit 7 cleared) */
+} Cpu_Rot_e;
+
 /** CPU Name parameter */
 typedef enum tagCpu_NameParam_t
 {
@@ -105,595 +312,431 @@ typedef enum tagCpu_NameParam_t
     CPU_P_SBYTE         /**< Signed 8 bit param */
 } Cpu_NameParam_t;
 
+/** 8 bit ALU operation of the flag benchmark */
+typedef enum tagCpu_AluOp_e
+{
+    CPU_ALU_ADD,    /**< ADD A,N */
+    CPU_ALU_ADC,    /**< ADC A,N */
+    CPU_ALU_SUB,    /**< SUB N */
+    CPU_ALU_SBC,    /**< SBC A,N */
+    CPU_ALU_AND,    /**< AND N */
+    CPU_ALU_XOR,    /**< XOR N */
+    CPU_ALU_OR,     /**< OR N */
+    CPU_ALU_CP,     /**< CP N */
+    CPU_ALU_INC,    /**< INC (of the operand) */
+    CPU_ALU_DEC,    /**< DEC (of the operand) */
+    CPU_ALU_NUM     /**< Number of ALU operation */
+} Cpu_AluOp_e;
+
+/** Decoded instruction cache entry */
+typedef struct tagCpu_Decoded_t
+{
+    Cpu_OpCode_t const * OpCode;    /**< Resolved OpCode (NULL if entry is empty) */
+    uint16_t Addr;                  /**< Instruction address */
+    uint16_t Operand;               /**< Assembled immediate operand */
+    uint16_t Index;                 /**< Dispatch index (0x100 + value for CB prefix) */
+    uint8_t  Size;                  /**< Instruction Byte size */
+    uint8_t  Cycle;                 /**< Instruction cycle duration */
+} Cpu_Decoded_t;
+
+/* Forward declaration for Cpu_Block_t definition */
+typedef struct tagCpu_Block_t Cpu_Block_t;
+
+/** Translated block of straight-line instruction */
+typedef struct tagCpu_Block_t
+{
+    uint16_t Addr;                          /**< Block start address */
+    uint16_t End;                           /**< Address following the last instruction */
+    uint8_t  Valid;                         /**< Block translation validity */
+    uint8_t  Count;                         /**< Number of instruction */
+    uint8_t  Idle;                          /**< Loop on itself without memory write (idle candidate) */
+    uint8_t  Break;                         /**< Start on a breakpoint */
+    Cpu_Block_t * Link[2];                  /**< Chained successor (fall through, branch) */
+#if defined(CPU_DYNAREC)
+    Dynarec_Block_t Native;                 /**< Native translation (NULL if cold) */
+    uint32_t Hits;                          /**< Number of interpreted execution */
+#endif
+    Cpu_Decoded_t Inst[CPU_BLOCK_LENGTH];   /**< Decoded instruction */
+} Cpu_Block_t;
+
+/** Decoded instruction and translated block cache of a context */
+struct tagCpu_Cache_t
+{
+    Cpu_Decoded_t Decode[CPU_DECODE_CACHE_SIZE];    /**< Decoded instruction cache */
+    Cpu_Block_t Block[CPU_BLOCK_CACHE_SIZE];        /**< Translated block cache */
+    uint8_t CodeCount[0x10000];                     /**< Number of decoded instruction and valid block covering each address (3 + CPU_BLOCK_SPAN at most) */
+    uint8_t BreakMap[0x10000 / 8];                  /**< Bitmap of the breakpoint address (kept on flush) */
+#if defined(CPU_DYNAREC)
+    Dynarec_Info_t Dynarec;                         /**< Native code buffer */
+    bool DynarecEnabled;                            /**< Native translation availability */
+#endif
+};
+
 
 /******************************************************/
 /* Prototype                                          */
 /******************************************************/
 
 /**
- * Get PC data
- * @return data pointed by PC
- * @note Each call increment PC register
+ * Get the decoded instruction at an address
+ * @param ctx The emulator context
+ * @param addr The instruction address
+ * @return The decoded instruction
+ */
+static inline Cpu_Decoded_t const * Cpu_Decode(Emu_Context_t * ctx, uint16_t addr);
+
+/**
+ * Evaluate the F register value
+ * @param ctx The emulator context
+ * @return The F register with the pending flag operation applied
+ */
+static inline uint8_t Cpu_GetFlag(Emu_Context_t const * ctx);
+
+/**
+ * Record a flag producing operation for lazy evaluation
+ * @param ctx The emulator context
+ * @param op The Cpu_FlagOp_e operation
+ * @param data0 The first operand
+ * @param data1 The second operand
+ * @param result The operation result
+ */
+static inline void Cpu_SetFlag(Emu_Context_t * ctx, uint8_t op, uint16_t data0, uint16_t data1, uint16_t result);
+
+/**
+ * 8 bit addition to A (ADD/ADC)
+ * @param ctx The emulator context
+ * @param data The operand
+ * @param carry true to add the carry flag
+ */
+static inline void Cpu_AluAdd(Emu_Context_t * ctx, uint8_t data, bool carry);
+
+/**
+ * 8 bit substraction from A (SUB/SBC/CP)
+ * @param ctx The emulator context
+ * @param data The operand
+ * @param carry true to substract the carry flag
+ * @param store false to only set the flag (CP)
+ */
+static inline void Cpu_AluSub(Emu_Context_t * ctx, uint8_t data, bool carry, bool store);
+
+/**
+ * 8 bit logical operation on A (AND/XOR/OR)
+ * @param ctx The emulator context
+ * @param op The Cpu_FlagOp_e operation (CPU_FLAG_OP_AND or CPU_FLAG_OP_LOGIC)
+ * @param data The operand
+ * @param result The operation result
+ */
+static inline void Cpu_AluLogic(Emu_Context_t * ctx, uint8_t op, uint8_t data, uint8_t result);
+
+/**
+ * 8 bit rotation/shift
+ * @param ctx The emulator context
+ * @param rot The Cpu_Rot_e operation
+ * @param data The operand
+ * @return The result, with the carry out in bit 8
+ */
+static inline uint16_t Cpu_AluRotate(Emu_Context_t * ctx, uint32_t rot, uint8_t data);
+
+/**
+ * 16 bit register plus signed 8 bit offset (ADD SP,N / LD HL,SP+N)
+ * @param ctx The emulator context
+ * @param data The 16 bit register value
+ * @param offset The signed offset
+ * @return The result
+ */
+static inline uint16_t Cpu_AluOffset(Emu_Context_t * ctx, uint16_t data, int8_t offset);
+
+/**
+ * Set the F register value, dropping the pending flag operation
+ * @param ctx The emulator context
+ * @param flag The F register value
+ */
+static inline void Cpu_WriteFlag(Emu_Context_t * ctx, uint8_t flag);
+
+/**
+ * Push a 16 bit value on the stack
+ * @param ctx The emulator context
+ * @param data The value to push
+ */
+static inline void Cpu_Push(Emu_Context_t * ctx, uint16_t data);
+
+/**
+ * Pop a 16 bit value from the stack
+ * @param ctx The emulator context
+ * @return The popped value
+ */
+static inline uint16_t Cpu_Pop(Emu_Context_t * ctx);
+
+/**
+ * Execute an 8 bit ALU operation with per-flag set/clear (flag benchmark reference)
+ * @param ctx The emulator context
+ * @param op The Cpu_AluOp_e operation
+ * @param data The operand
+ */
+static inline void Cpu_AluReference(Emu_Context_t * ctx, Cpu_AluOp_e op, uint8_t data);
+
+/**
+ * Execute an 8 bit ALU operation with the flag table (flag benchmark)
+ * @param ctx The emulator context
+ * @param op The Cpu_AluOp_e operation
+ * @param data The operand
+ */
+static inline void Cpu_AluTable(Emu_Context_t * ctx, Cpu_AluOp_e op, uint8_t data);
+
+/**
+ * Execute an instruction without going through the OpCode callback
+ * @param ctx The emulator context
+ * @param index The instruction dispatch index
+ * @return The number of cycle used for the instruction
+ */
+static inline int Cpu_Dispatch(Emu_Context_t * ctx, uint16_t index);
+
+/**
+ * Get the translated block starting at an address
+ * @param ctx The emulator context
+ * @param addr The block start address
+ * @return The translated block
+ */
+static Cpu_Block_t * Cpu_GetBlock(Emu_Context_t * ctx, uint16_t addr);
+
+/**
+ * Invalidate a translated block and release the address it cover
+ * @param ctx The emulator context
+ * @param block The block (no effect if already invalid)
+ */
+static void Cpu_DropBlock(Emu_Context_t * ctx, Cpu_Block_t * block);
+
+/**
+ * Empty a decoded instruction cache entry and release the address it cover
+ * @param ctx The emulator context
+ * @param decoded The entry (no effect if already empty)
+ */
+static void Cpu_DropDecoded(Emu_Context_t * ctx, Cpu_Decoded_t * decoded);
+
+/**
+ * Execute all the instruction of a translated block
+ * @param ctx The emulator context
+ * @param block The block to execute
+ * @return The number of cycle used for the block
+ */
+static inline uint32_t Cpu_ExecuteBlock(Emu_Context_t * ctx, Cpu_Block_t const * block);
+
+/**
+ * Check if an OpCode end a translated block
+ * @param opcode The OpCode to check
+ * @return true if the OpCode can modify PC or the interrupt state
+ */
+static inline bool Cpu_IsBlockEnd(Cpu_OpCode_t const * opcode);
+
+/**
+ * Check if an OpCode only modify CPU register
+ * @param opcode The OpCode to check
+ * @return true if the OpCode does not write memory nor use the stack
+ */
+static bool Cpu_IsIdleSafe(Cpu_OpCode_t const * opcode);
+
+/**
+ * Check if a translated block is a polling loop on itself
+ * @param block The translated block
+ * @return true if the block branch to itself and only modify CPU register
+ */
+static bool Cpu_IsIdleLoop(Cpu_Block_t const * block);
+
+/**
+ * Execute a translated block, natively if it is hot
+ * @param ctx The emulator context
+ * @param block The block to execute
+ * @return The number of cycle used for the block
+ */
+static inline uint32_t Cpu_RunBlock(Emu_Context_t * ctx, Cpu_Block_t * block);
+
+/**
+ * Decode and execute the instruction at PC
+ * @param ctx The emulator context
+ * @return The number of cycle used for the instruction
+ * @note The cycle counter is not updated
  */
-static inline uint8_t Cpu_ReadPc(void);
+static inline uint32_t Cpu_Execute(Emu_Context_t * ctx);
 
+/**
+ * Handle a non-zero interrupt check word: dispatch, HALT or EI delay
+ * @param ctx The emulator context
+ * @param budget The number of cycle a HALT can wait for
+ * @return The number of cycle used
+ * @note The cycle counter is not updated
+ */
+static uint32_t Cpu_Interrupt(Emu_Context_t * ctx, uint32_t budget);
+
+/**
+ * Get the number of cycle HALT or an idle loop can be fast-forwarded
+ * @param ctx The emulator context
+ * @return The cycle up to the run end or the next event, at least one instruction slot
+ * @note Evaluated at the skip: an event may have been scheduled since Cpu_Run started
+ */
+static uint32_t Cpu_GetIdleBudget(Emu_Context_t const * ctx);
+
+#if defined(CPU_DYNAREC)
+/**
+ * Translate a hot block to native code
+ * @param ctx The emulator context
+ * @param block The block to translate
+ */
+static void Cpu_TranslateBlock(Emu_Context_t * ctx, Cpu_Block_t * block);
+
+/**
+ * Set a random CPU state for Cpu_CheckDynarec
+ * @param ctx The emulator context
+ * @param seed The pseudo random sequence state
+ * @note Pointer register stay in work RAM and C in high RAM, a random flag operation is pending
+ */
+static void Cpu_CheckState(Emu_Context_t * ctx, uint32_t * seed);
+
+/**
+ * Fill an instruction for Cpu_CheckDynarec with a random operand
+ * @param inst The instruction to fill
+ * @param index The instruction dispatch index
+ * @param addr The instruction address
+ * @param seed The pseudo random sequence state
+ * @note Address operand point to work RAM or high RAM
+ */
+static void Cpu_CheckInst(Dynarec_Inst_t * inst, uint16_t index, uint16_t addr, uint32_t * seed);
+
+/**
+ * Save or restore the memory checked by Cpu_CheckDynarec (work RAM then high RAM)
+ * @param ctx The emulator context
+ * @param data The CPU_CHECK_WRAM_SIZE + CPU_CHECK_HRAM_SIZE byte buffer
+ * @param restore true to write the buffer to memory, false to read the memory to the buffer
+ */
+static void Cpu_CheckMemory(Emu_Context_t * ctx, uint8_t * data, bool restore);
+#endif
+
+/*
+ * OpCode handler: execute an OpCode with the constant parameter of its description
+ * Return true if a conditional jump is taken (taken duration), false otherwise
+ */
 /* Misc/Control Command */
-static int Cpu_Execute_Unimplemented(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_NOP(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_PREFIX_CB(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_ILLEGAL(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_NOP(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_STOP(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_HALT(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_DI(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_EI(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_PREFIX_CB(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_DAA(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_CPL(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_SCF(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_CCF(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
 
 /* Jump/Call Command */
-static int Cpu_Execute_CALL_F_NN(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_JR_F_N(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RET(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_JR_F_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_JP_F_NN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_JP_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_CALL_F_NN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_RET_F(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_RETI(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_RST_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
 
 /* 8 bit Load/Move/Store Command */
-static int Cpu_Execute_LD_R_N(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_R_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_R_pRR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_pR_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_pN_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_pNN_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_pRR_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LDD_pRR_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LDI_pRR_R(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_LD_R_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_R_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_R_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_R_pN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_R_pR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_R_pNN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LDI_R_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LDD_R_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_pRR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_pRR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_pN_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_pR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_pNN_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LDI_pRR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LDD_pRR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
 
 /* 16 bit Load/Move/Store Command */
-static int Cpu_Execute_LD_RR_NN(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_LD_pNN_RR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_PUSH_RR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_POP_RR(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_LD_RR_NN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_RR_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_RR_RRN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_LD_pNN_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_PUSH_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_POP_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
 
 /* 8 bit Arithmetic/Logical Command */
-static int Cpu_Execute_INC_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_DEC_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_XOR_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_CP_N(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_INC_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_DEC_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_INC_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_DEC_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ADD_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ADD_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ADD_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_SUB_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_SUB_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_SUB_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_AND_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_AND_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_AND_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_XOR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_XOR_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_XOR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_OR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_OR_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_OR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_CP_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_CP_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_CP_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
 
 /* 16 bit Arithmetic/Logical Command */
-static int Cpu_Execute_INC_RR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_DEC_RR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_ADD_RR_RR(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_INC_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_DEC_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ADD_RR_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ADD_RR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
 
 /* 8 bit Rotation/Shift/Bit Command */
-static int Cpu_Execute_BIT_N_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_BIT_N_pRR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_SET_N_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_SET_N_pRR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RES_N_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RES_N_pRR(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RLA(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RLCA(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RL_R(Cpu_OpCode_t const * const opcode);
-static int Cpu_Execute_RL_pRR(Cpu_OpCode_t const * const opcode);
+static inline bool Cpu_Execute_ROTA(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ROT_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_ROT_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_BIT_N_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_BIT_N_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_SET_N_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_SET_N_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_RES_N_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+static inline bool Cpu_Execute_RES_N_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1);
+
+/* OpCode callback of each description entry */
+CPU_OPCODE_MAIN(CPU_OPCODE_PROTOTYPE_M)
+CPU_OPCODE_PREFIX(CPU_OPCODE_PROTOTYPE_P)
 
 
 /******************************************************/
 /* Variable                                           */
 /******************************************************/
 
-/** CPU Info */
-Cpu_Info_t Cpu_Info;
+/** Flag defined by each Cpu_FlagOp_e operation (the other keep their value) */
+static uint8_t const Cpu_FlagMask[CPU_FLAG_OP_NUM] =
+{
+    [CPU_FLAG_OP_NONE]  = CPU_F_NO,
+    [CPU_FLAG_OP_INC]   = CPU_F_Z | CPU_F_N | CPU_F_H,
+    [CPU_FLAG_OP_DEC]   = CPU_F_Z | CPU_F_N | CPU_F_H,
+    [CPU_FLAG_OP_ADD]   = CPU_F_ALL,
+    [CPU_FLAG_OP_SUB]   = CPU_F_ALL,
+    [CPU_FLAG_OP_AND]   = CPU_F_ALL,
+    [CPU_FLAG_OP_LOGIC] = CPU_F_ALL,
+    [CPU_FLAG_OP_BIT]   = CPU_F_Z | CPU_F_N | CPU_F_H,
+    [CPU_FLAG_OP_ADD16] = CPU_F_N | CPU_F_H | CPU_F_C,
+    [CPU_FLAG_OP_ROT]   = CPU_F_ALL,
+    [CPU_FLAG_OP_ROTA]  = CPU_F_ALL
+};
 
 /** Callback table for each OpCode */
 static Cpu_OpCode_t const Cpu_OpCode[] =
 {
-    {0x00, 1, "NOP",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_NOP},
-    {0x01, 3, "LD BC,0x%04x",       CPU_P_UWORD, CPU_R_BC, CPU_NULL, Cpu_Execute_LD_RR_NN},
-    {0x02, 1, "LD (BC),A",          CPU_P_NONE,  CPU_R_BC, CPU_R_A,  Cpu_Execute_LD_pRR_R},
-    {0x03, 1, "INC BC",             CPU_P_NONE,  CPU_R_BC, CPU_NULL, Cpu_Execute_INC_RR},
-    {0x04, 1, "INC B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x05, 1, "DEC B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x06, 2, "LD B,0x%02x",        CPU_P_UBYTE, CPU_R_B,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x07, 1, "RLCA",               CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_RLCA},
-    {0x08, 3, "LD (0x%04x),SP",     CPU_P_UWORD, CPU_NULL, CPU_R_SP, Cpu_Execute_LD_pNN_RR},
-    {0x09, 1, "ADD HL,BC",          CPU_P_NONE,  CPU_R_HL, CPU_R_BC, Cpu_Execute_ADD_RR_RR},
-    {0x0A, 1, "LD A,(BC)",          CPU_P_NONE,  CPU_R_A,  CPU_R_BC, Cpu_Execute_LD_R_pRR},
-    {0x0B, 1, "DEC BC",             CPU_P_NONE,  CPU_R_BC, CPU_NULL, Cpu_Execute_DEC_RR},
-    {0x0C, 1, "INC C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x0D, 1, "DEC C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x0E, 2, "LD C,0x%02x",        CPU_P_UBYTE, CPU_R_C,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x0F, 1, "RRCA",               CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x10, 2, "STOP",               CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x11, 3, "LD DE,0x%04x",       CPU_P_UWORD, CPU_R_DE, CPU_NULL, Cpu_Execute_LD_RR_NN},
-    {0x12, 1, "LD (DE),A",          CPU_P_NONE,  CPU_R_DE, CPU_R_A,  Cpu_Execute_LD_pRR_R},
-    {0x13, 1, "INC DE",             CPU_P_NONE,  CPU_R_DE, CPU_NULL, Cpu_Execute_INC_RR},
-    {0x14, 1, "INC D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x15, 1, "DEC D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x16, 2, "LD D,0x%02x",        CPU_P_UBYTE, CPU_R_D,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x17, 1, "RLA",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_RLA},
-    {0x18, 2, "JR %d",              CPU_P_SBYTE, CPU_F_NO, CPU_F_NO, Cpu_Execute_JR_F_N},
-    {0x19, 1, "ADD HL,DE",          CPU_P_NONE,  CPU_R_HL, CPU_R_DE, Cpu_Execute_ADD_RR_RR},
-    {0x1A, 1, "LD A,(DE)",          CPU_P_NONE,  CPU_R_A,  CPU_R_DE, Cpu_Execute_LD_R_pRR},
-    {0x1B, 1, "DEC DE",             CPU_P_NONE,  CPU_R_DE, CPU_NULL, Cpu_Execute_DEC_RR},
-    {0x1C, 1, "INC E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x1D, 1, "DEC E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x1E, 2, "LD E,0x%02x",        CPU_P_UBYTE, CPU_R_E,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x1F, 1, "RRA",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x20, 2, "JR NZ,%d",           CPU_P_SBYTE, CPU_F_Z,  CPU_F_NO, Cpu_Execute_JR_F_N},
-    {0x21, 3, "LD HL,0x%04x",       CPU_P_UWORD, CPU_R_HL, CPU_NULL, Cpu_Execute_LD_RR_NN},
-    {0x22, 1, "LD (HL+),A",         CPU_P_NONE,  CPU_R_HL, CPU_R_A,  Cpu_Execute_LDI_pRR_R},
-    {0x23, 1, "INC HL",             CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_INC_RR},
-    {0x24, 1, "INC H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x25, 1, "DEC H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x26, 2, "LD H,0x%02x",        CPU_P_UBYTE, CPU_R_H,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x27, 1, "DAA",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x28, 2, "JR Z,%d",            CPU_P_SBYTE, CPU_F_Z,  CPU_F_Z,  Cpu_Execute_JR_F_N},
-    {0x29, 1, "ADD HL,HL",          CPU_P_NONE,  CPU_R_HL, CPU_R_HL, Cpu_Execute_ADD_RR_RR},
-    {0x2A, 1, "LD A,(HL+)",         CPU_P_NONE,  CPU_R_A,  CPU_R_HL, Cpu_Execute_Unimplemented},
-    {0x2B, 1, "DEC HL",             CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_DEC_RR},
-    {0x2C, 1, "INC L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x2D, 1, "DEC L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x2E, 2, "LD L,0x%02x",        CPU_P_UBYTE, CPU_R_L,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x2F, 1, "CPL",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x30, 2, "JR NC,%d",           CPU_P_SBYTE, CPU_F_C,  CPU_F_NO, Cpu_Execute_JR_F_N},
-    {0x31, 3, "LD SP,0x%04x",       CPU_P_UWORD, CPU_R_SP, CPU_NULL, Cpu_Execute_LD_RR_NN},
-    {0x32, 1, "LD (HL-),A",         CPU_P_NONE,  CPU_R_HL, CPU_R_A,  Cpu_Execute_LDD_pRR_R},
-    {0x33, 1, "INC SP",             CPU_P_NONE,  CPU_R_SP, CPU_NULL, Cpu_Execute_INC_RR},
-    {0x34, 1, "INC (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x35, 1, "DEC (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x36, 2, "LD (HL),0x%02x",     CPU_P_UBYTE, CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x37, 1, "SCF",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x38, 2, "JR C,%d",            CPU_P_SBYTE, CPU_F_C,  CPU_F_C,  Cpu_Execute_JR_F_N},
-    {0x39, 1, "ADD HL,SP",          CPU_P_NONE,  CPU_R_HL, CPU_R_SP, Cpu_Execute_ADD_RR_RR},
-    {0x3A, 1, "LD A,(HL-)",         CPU_P_NONE,  CPU_R_A,  CPU_R_HL, Cpu_Execute_Unimplemented},
-    {0x3B, 1, "DEC SP",             CPU_P_NONE,  CPU_R_SP, CPU_NULL, Cpu_Execute_DEC_RR},
-    {0x3C, 1, "INC A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_INC_R},
-    {0x3D, 1, "DEC A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_DEC_R},
-    {0x3E, 2, "LD A,0x%02x",        CPU_P_UBYTE, CPU_R_A,  CPU_NULL, Cpu_Execute_LD_R_N},
-    {0x3F, 1, "CCF",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x40, 1, "LD B,B",             CPU_P_NONE,  CPU_R_B,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x41, 1, "LD B,C",             CPU_P_NONE,  CPU_R_B,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x42, 1, "LD B,D",             CPU_P_NONE,  CPU_R_B,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x43, 1, "LD B,E",             CPU_P_NONE,  CPU_R_B,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x44, 1, "LD B,H",             CPU_P_NONE,  CPU_R_B,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x45, 1, "LD B,L",             CPU_P_NONE,  CPU_R_B,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x46, 1, "LD B,(HL)",          CPU_P_NONE,  CPU_R_B,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x47, 1, "LD B,A",             CPU_P_NONE,  CPU_R_B,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x48, 1, "LD C,B",             CPU_P_NONE,  CPU_R_C,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x49, 1, "LD C,C",             CPU_P_NONE,  CPU_R_C,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x4A, 1, "LD C,D",             CPU_P_NONE,  CPU_R_C,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x4B, 1, "LD C,E",             CPU_P_NONE,  CPU_R_C,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x4C, 1, "LD C,H",             CPU_P_NONE,  CPU_R_C,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x4D, 1, "LD C,L",             CPU_P_NONE,  CPU_R_C,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x4E, 1, "LD C,(HL)",          CPU_P_NONE,  CPU_R_C,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x4F, 1, "LD C,A",             CPU_P_NONE,  CPU_R_C,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x50, 1, "LD D,B",             CPU_P_NONE,  CPU_R_D,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x51, 1, "LD D,C",             CPU_P_NONE,  CPU_R_D,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x52, 1, "LD D,D",             CPU_P_NONE,  CPU_R_D,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x53, 1, "LD D,E",             CPU_P_NONE,  CPU_R_D,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x54, 1, "LD D,H",             CPU_P_NONE,  CPU_R_D,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x55, 1, "LD D,L",             CPU_P_NONE,  CPU_R_D,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x56, 1, "LD D,(HL)",          CPU_P_NONE,  CPU_R_D,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x57, 1, "LD D,A",             CPU_P_NONE,  CPU_R_D,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x58, 1, "LD E,B",             CPU_P_NONE,  CPU_R_E,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x59, 1, "LD E,C",             CPU_P_NONE,  CPU_R_E,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x5A, 1, "LD E,D",             CPU_P_NONE,  CPU_R_E,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x5B, 1, "LD E,E",             CPU_P_NONE,  CPU_R_E,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x5C, 1, "LD E,H",             CPU_P_NONE,  CPU_R_E,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x5D, 1, "LD E,L",             CPU_P_NONE,  CPU_R_E,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x5E, 1, "LD E,(HL)",          CPU_P_NONE,  CPU_R_E,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x5F, 1, "LD E,A",             CPU_P_NONE,  CPU_R_E,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x60, 1, "LD H,B",             CPU_P_NONE,  CPU_R_H,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x61, 1, "LD H,C",             CPU_P_NONE,  CPU_R_H,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x62, 1, "LD H,D",             CPU_P_NONE,  CPU_R_H,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x63, 1, "LD H,E",             CPU_P_NONE,  CPU_R_H,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x64, 1, "LD H,H",             CPU_P_NONE,  CPU_R_H,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x65, 1, "LD H,L",             CPU_P_NONE,  CPU_R_H,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x66, 1, "LD H,(HL)",          CPU_P_NONE,  CPU_R_H,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x67, 1, "LD H,A",             CPU_P_NONE,  CPU_R_H,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x68, 1, "LD L,B",             CPU_P_NONE,  CPU_R_L,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x69, 1, "LD L,C",             CPU_P_NONE,  CPU_R_L,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x6A, 1, "LD L,D",             CPU_P_NONE,  CPU_R_L,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x6B, 1, "LD L,E",             CPU_P_NONE,  CPU_R_L,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x6C, 1, "LD L,H",             CPU_P_NONE,  CPU_R_L,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x6D, 1, "LD L,L",             CPU_P_NONE,  CPU_R_L,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x6E, 1, "LD L,(HL)",          CPU_P_NONE,  CPU_R_L,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x6F, 1, "LD L,A",             CPU_P_NONE,  CPU_R_L,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x70, 1, "LD (HL),B",          CPU_P_NONE,  CPU_R_HL, CPU_R_B,  Cpu_Execute_LD_pRR_R},
-    {0x71, 1, "LD (HL),C",          CPU_P_NONE,  CPU_R_HL, CPU_R_C,  Cpu_Execute_LD_pRR_R},
-    {0x72, 1, "LD (HL),D",          CPU_P_NONE,  CPU_R_HL, CPU_R_D,  Cpu_Execute_LD_pRR_R},
-    {0x73, 1, "LD (HL),E",          CPU_P_NONE,  CPU_R_HL, CPU_R_E,  Cpu_Execute_LD_pRR_R},
-    {0x74, 1, "LD (HL),H",          CPU_P_NONE,  CPU_R_HL, CPU_R_H,  Cpu_Execute_LD_pRR_R},
-    {0x75, 1, "LD (HL),L",          CPU_P_NONE,  CPU_R_HL, CPU_R_L,  Cpu_Execute_LD_pRR_R},
-    {0x76, 1, "HALT",               CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x77, 1, "LD (HL),A",          CPU_P_NONE,  CPU_R_HL, CPU_R_A,  Cpu_Execute_LD_pRR_R},
-    {0x78, 1, "LD A,B",             CPU_P_NONE,  CPU_R_A,  CPU_R_B,  Cpu_Execute_LD_R_R},
-    {0x79, 1, "LD A,C",             CPU_P_NONE,  CPU_R_A,  CPU_R_C,  Cpu_Execute_LD_R_R},
-    {0x7A, 1, "LD A,D",             CPU_P_NONE,  CPU_R_A,  CPU_R_D,  Cpu_Execute_LD_R_R},
-    {0x7B, 1, "LD A,E",             CPU_P_NONE,  CPU_R_A,  CPU_R_E,  Cpu_Execute_LD_R_R},
-    {0x7C, 1, "LD A,H",             CPU_P_NONE,  CPU_R_A,  CPU_R_H,  Cpu_Execute_LD_R_R},
-    {0x7D, 1, "LD A,L",             CPU_P_NONE,  CPU_R_A,  CPU_R_L,  Cpu_Execute_LD_R_R},
-    {0x7E, 1, "LD A,(HL)",          CPU_P_NONE,  CPU_R_A,  CPU_R_HL, Cpu_Execute_LD_R_pRR},
-    {0x7F, 1, "LD A,A",             CPU_P_NONE,  CPU_R_A,  CPU_R_A,  Cpu_Execute_LD_R_R},
-    {0x80, 1, "ADD A,B",            CPU_P_NONE,  CPU_R_A,  CPU_R_B,  Cpu_Execute_Unimplemented},
-    {0x81, 1, "ADD A,C",            CPU_P_NONE,  CPU_R_A,  CPU_R_C,  Cpu_Execute_Unimplemented},
-    {0x82, 1, "ADD A,D",            CPU_P_NONE,  CPU_R_A,  CPU_R_D,  Cpu_Execute_Unimplemented},
-    {0x83, 1, "ADD A,E",            CPU_P_NONE,  CPU_R_A,  CPU_R_E,  Cpu_Execute_Unimplemented},
-    {0x84, 1, "ADD A,H",            CPU_P_NONE,  CPU_R_A,  CPU_R_H,  Cpu_Execute_Unimplemented},
-    {0x85, 1, "ADD A,L",            CPU_P_NONE,  CPU_R_A,  CPU_R_L,  Cpu_Execute_Unimplemented},
-    {0x86, 1, "ADD A,(HL)",         CPU_P_NONE,  CPU_R_A,  CPU_R_HL, Cpu_Execute_Unimplemented},
-    {0x87, 1, "ADD A,A",            CPU_P_NONE,  CPU_R_A,  CPU_R_A,  Cpu_Execute_Unimplemented},
-    {0x88, 1, "ADC A,B",            CPU_P_NONE,  CPU_R_A,  CPU_R_B,  Cpu_Execute_Unimplemented},
-    {0x89, 1, "ADC A,C",            CPU_P_NONE,  CPU_R_A,  CPU_R_C,  Cpu_Execute_Unimplemented},
-    {0x8A, 1, "ADC A,D",            CPU_P_NONE,  CPU_R_A,  CPU_R_D,  Cpu_Execute_Unimplemented},
-    {0x8B, 1, "ADC A,E",            CPU_P_NONE,  CPU_R_A,  CPU_R_E,  Cpu_Execute_Unimplemented},
-    {0x8C, 1, "ADC A,H",            CPU_P_NONE,  CPU_R_A,  CPU_R_H,  Cpu_Execute_Unimplemented},
-    {0x8D, 1, "ADC A,L",            CPU_P_NONE,  CPU_R_A,  CPU_R_L,  Cpu_Execute_Unimplemented},
-    {0x8E, 1, "ADC A,(HL)",         CPU_P_NONE,  CPU_R_A,  CPU_R_HL, Cpu_Execute_Unimplemented},
-    {0x8F, 1, "ADC A,A",            CPU_P_NONE,  CPU_R_A,  CPU_R_A,  Cpu_Execute_Unimplemented},
-    {0x90, 1, "SUB B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x91, 1, "SUB C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x92, 1, "SUB D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x93, 1, "SUB E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x94, 1, "SUB H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x95, 1, "SUB L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x96, 1, "SUB (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x97, 1, "SUB A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x98, 1, "SBC A,B",            CPU_P_NONE,  CPU_R_A,  CPU_R_B,  Cpu_Execute_Unimplemented},
-    {0x99, 1, "SBC A,C",            CPU_P_NONE,  CPU_R_A,  CPU_R_C,  Cpu_Execute_Unimplemented},
-    {0x9A, 1, "SBC A,D",            CPU_P_NONE,  CPU_R_A,  CPU_R_D,  Cpu_Execute_Unimplemented},
-    {0x9B, 1, "SBC A,E",            CPU_P_NONE,  CPU_R_A,  CPU_R_E,  Cpu_Execute_Unimplemented},
-    {0x9C, 1, "SBC A,H",            CPU_P_NONE,  CPU_R_A,  CPU_R_H,  Cpu_Execute_Unimplemented},
-    {0x9D, 1, "SBC A,L",            CPU_P_NONE,  CPU_R_A,  CPU_R_L,  Cpu_Execute_Unimplemented},
-    {0x9E, 1, "SBC A,(HL)",         CPU_P_NONE,  CPU_R_A,  CPU_R_HL, Cpu_Execute_Unimplemented},
-    {0x9F, 1, "SBC A,A",            CPU_P_NONE,  CPU_R_A,  CPU_R_A,  Cpu_Execute_Unimplemented},
-    {0xA0, 1, "AND B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA1, 1, "AND C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA2, 1, "AND D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA3, 1, "AND E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA4, 1, "AND H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA5, 1, "AND L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA6, 1, "AND (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA7, 1, "AND A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xA8, 1, "XOR B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xA9, 1, "XOR C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xAA, 1, "XOR D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xAB, 1, "XOR E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xAC, 1, "XOR H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xAD, 1, "XOR L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xAE, 1, "XOR (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xAF, 1, "XOR A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_XOR_R},
-    {0xB0, 1, "OR B",               CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB1, 1, "OR C",               CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB2, 1, "OR D",               CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB3, 1, "OR E",               CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB4, 1, "OR H",               CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB5, 1, "OR L",               CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB6, 1, "OR (HL)",            CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB7, 1, "OR A",               CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB8, 1, "CP B",               CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xB9, 1, "CP C",               CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xBA, 1, "CP D",               CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xBB, 1, "CP E",               CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xBC, 1, "CP H",               CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xBD, 1, "CP L",               CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xBE, 1, "CP (HL)",            CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xBF, 1, "CP A",               CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC0, 1, "RET NZ",             CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC1, 1, "POP BC",             CPU_P_NONE,  CPU_R_BC, CPU_NULL, Cpu_Execute_POP_RR},
-    {0xC2, 3, "JP NZ,0x%04x",       CPU_P_UWORD, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC3, 3, "JP 0x%04x",          CPU_P_UWORD, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC4, 3, "CALL NZ,0x%04x",     CPU_P_UWORD, CPU_F_Z,  CPU_F_NO, Cpu_Execute_CALL_F_NN},
-    {0xC5, 1, "PUSH BC",            CPU_P_NONE,  CPU_R_BC, CPU_NULL, Cpu_Execute_PUSH_RR},
-    {0xC6, 2, "ADD A,0x%02x",       CPU_P_UBYTE, CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC7, 1, "RST 00H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC8, 1, "RET Z",              CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xC9, 1, "RET",                CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_RET},
-    {0xCA, 3, "JP Z,0x%04x",        CPU_P_UWORD, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xCB, 2, "PREFIX CB",          CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_PREFIX_CB},
-    {0xCC, 3, "CALL Z,0x%04x",      CPU_P_UWORD, CPU_F_Z,  CPU_F_Z,  Cpu_Execute_CALL_F_NN},
-    {0xCD, 3, "CALL 0x%04x",        CPU_P_UWORD, CPU_F_NO, CPU_F_NO, Cpu_Execute_CALL_F_NN},
-    {0xCE, 2, "ADC A,0x%02x",       CPU_P_UBYTE, CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xCF, 1, "RST 08H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD0, 1, "RET NC",             CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD1, 1, "POP DE",             CPU_P_NONE,  CPU_R_DE, CPU_NULL, Cpu_Execute_POP_RR},
-    {0xD2, 3, "JP NC,0x%04x",       CPU_P_UWORD, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD3, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD4, 3, "CALL NC,0x%04x",     CPU_P_UWORD, CPU_F_C,  CPU_F_NO, Cpu_Execute_CALL_F_NN},
-    {0xD5, 1, "PUSH DE",            CPU_P_NONE,  CPU_R_DE, CPU_NULL, Cpu_Execute_PUSH_RR},
-    {0xD6, 2, "SUB 0x%02x",         CPU_P_UBYTE, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD7, 1, "RST 10H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD8, 1, "RET C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xD9, 1, "RETI",               CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xDA, 3, "JP C,0x%04x",        CPU_P_UWORD, CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xDB, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xDC, 3, "CALL C,0x%04x",      CPU_P_UWORD, CPU_F_C,  CPU_F_C,  Cpu_Execute_CALL_F_NN},
-    {0xDD, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xDE, 2, "SBC A,0x%02x",       CPU_P_UBYTE, CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xDF, 1, "RST 18H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xE0, 2, "LD (0xff%02x),A",    CPU_P_UBYTE, CPU_NULL, CPU_R_A,  Cpu_Execute_LD_pN_R},
-    {0xE1, 1, "POP HL",             CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_POP_RR},
-    {0xE2, 1, "LD (0xff00+C),A",    CPU_P_NONE,  CPU_R_C,  CPU_R_A,  Cpu_Execute_LD_pR_R},
-    {0xE3, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xE4, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xE5, 1, "PUSH HL",            CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_PUSH_RR},
-    {0xE6, 2, "AND 0x%02x",         CPU_P_UBYTE, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xE7, 1, "RST 20H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xE8, 2, "ADD SP,%d",          CPU_P_SBYTE, CPU_R_SP, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xE9, 1, "JP (HL)",            CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xEA, 3, "LD (0x%04x),A",      CPU_P_UWORD, CPU_NULL, CPU_R_A,  Cpu_Execute_LD_pNN_R},
-    {0xEB, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xEC, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xED, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xEE, 2, "XOR 0x%02x",         CPU_P_UBYTE, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xEF, 1, "RST 28H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xF0, 2, "LD A,(0xff%02x)",    CPU_P_UBYTE, CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xF1, 1, "POP AF",             CPU_P_NONE,  CPU_R_AF, CPU_NULL, Cpu_Execute_POP_RR},
-    {0xF2, 2, "LD A,(C)",           CPU_P_NONE,  CPU_R_A,  CPU_R_C,  Cpu_Execute_Unimplemented},
-    {0xF3, 1, "DI",                 CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xF4, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xF5, 1, "PUSH AF",            CPU_P_NONE,  CPU_R_AF, CPU_NULL, Cpu_Execute_PUSH_RR},
-    {0xF6, 2, "OR 0x%02x",          CPU_P_UBYTE, CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xF7, 1, "RST 30H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xF8, 2, "LD HL,SP+%d",        CPU_P_SBYTE, CPU_R_HL, CPU_R_SP, Cpu_Execute_Unimplemented},
-    {0xF9, 1, "LD SP,HL",           CPU_P_NONE,  CPU_R_SP, CPU_R_HL, Cpu_Execute_Unimplemented},
-    {0xFA, 3, "LD A,(0x%04x)",      CPU_P_UWORD, CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xFB, 1, "EI",                 CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xFC, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xFD, 1, "UNKNOWN",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0xFE, 2, "CP 0x%02x",          CPU_P_UBYTE, CPU_NULL, CPU_NULL, Cpu_Execute_CP_N},
-    {0xFF, 1, "RST 38H",            CPU_P_NONE,  CPU_NULL, CPU_NULL, Cpu_Execute_Unimplemented}
+    CPU_OPCODE_MAIN(CPU_OPCODE_ENTRY_M)
 };
 
+/** Callback table for each CB prefix OpCode */
 static Cpu_OpCode_t const Cpu_OpCode_Prefix[] =
 {
-    {0x00, 2, "RLC B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x01, 2, "RLC C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x02, 2, "RLC D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x03, 2, "RLC E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x04, 2, "RLC H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x05, 2, "RLC L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x06, 2, "RLC (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x07, 2, "RLC A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x08, 2, "RRC B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x09, 2, "RRC C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x0A, 2, "RRC D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x0B, 2, "RRC E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x0C, 2, "RRC H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x0D, 2, "RRC L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x0E, 2, "RRC (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x0F, 2, "RRC A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x10, 2, "RL B",               CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x11, 2, "RL C",               CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x12, 2, "RL D",               CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x13, 2, "RL E",               CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x14, 2, "RL H",               CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x15, 2, "RL L",               CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x16, 2, "RL (HL)",            CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_RL_pRR},
-    {0x17, 2, "RL A",               CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_RL_R},
-    {0x18, 2, "RR B",               CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x19, 2, "RR C",               CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x1A, 2, "RR D",               CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x1B, 2, "RR E",               CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x1C, 2, "RR H",               CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x1D, 2, "RR L",               CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x1E, 2, "RR (HL)",            CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x1F, 2, "RR A",               CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x20, 2, "SLA B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x21, 2, "SLA C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x22, 2, "SLA D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x23, 2, "SLA E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x24, 2, "SLA H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x25, 2, "SLA L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x26, 2, "SLA (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x27, 2, "SLA A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x28, 2, "SRA B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x29, 2, "SRA C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x2A, 2, "SRA D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x2B, 2, "SRA E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x2C, 2, "SRA H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x2D, 2, "SRA L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x2E, 2, "SRA (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x2F, 2, "SRA A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x30, 2, "SWAP B",             CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x31, 2, "SWAP C",             CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x32, 2, "SWAP D",             CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x33, 2, "SWAP E",             CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x34, 2, "SWAP H",             CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x35, 2, "SWAP L",             CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x36, 2, "SWAP (HL)",          CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x37, 2, "SWAP A",             CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x38, 2, "SRL B",              CPU_P_NONE,  CPU_R_B,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x39, 2, "SRL C",              CPU_P_NONE,  CPU_R_C,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x3A, 2, "SRL D",              CPU_P_NONE,  CPU_R_D,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x3B, 2, "SRL E",              CPU_P_NONE,  CPU_R_E,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x3C, 2, "SRL H",              CPU_P_NONE,  CPU_R_H,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x3D, 2, "SRL L",              CPU_P_NONE,  CPU_R_L,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x3E, 2, "SRL (HL)",           CPU_P_NONE,  CPU_R_HL, CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x3F, 2, "SRL A",              CPU_P_NONE,  CPU_R_A,  CPU_NULL, Cpu_Execute_Unimplemented},
-    {0x40, 2, "BIT 0,B",            CPU_P_NONE,  0x01,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x41, 2, "BIT 0,C",            CPU_P_NONE,  0x01,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x42, 2, "BIT 0,D",            CPU_P_NONE,  0x01,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x43, 2, "BIT 0,E",            CPU_P_NONE,  0x01,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x44, 2, "BIT 0,H",            CPU_P_NONE,  0x01,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x45, 2, "BIT 0,L",            CPU_P_NONE,  0x01,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x46, 2, "BIT 0,(HL)",         CPU_P_NONE,  0x01,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x47, 2, "BIT 0,A",            CPU_P_NONE,  0x01,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x48, 2, "BIT 1,B",            CPU_P_NONE,  0x02,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x49, 2, "BIT 1,C",            CPU_P_NONE,  0x02,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x4A, 2, "BIT 1,D",            CPU_P_NONE,  0x02,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x4B, 2, "BIT 1,E",            CPU_P_NONE,  0x02,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x4C, 2, "BIT 1,H",            CPU_P_NONE,  0x02,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x4D, 2, "BIT 1,L",            CPU_P_NONE,  0x02,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x4E, 2, "BIT 1,(HL)",         CPU_P_NONE,  0x02,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x4F, 2, "BIT 1,A",            CPU_P_NONE,  0x02,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x50, 2, "BIT 2,B",            CPU_P_NONE,  0x04,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x51, 2, "BIT 2,C",            CPU_P_NONE,  0x04,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x52, 2, "BIT 2,D",            CPU_P_NONE,  0x04,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x53, 2, "BIT 2,E",            CPU_P_NONE,  0x04,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x54, 2, "BIT 2,H",            CPU_P_NONE,  0x04,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x55, 2, "BIT 2,L",            CPU_P_NONE,  0x04,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x56, 2, "BIT 2,(HL)",         CPU_P_NONE,  0x04,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x57, 2, "BIT 2,A",            CPU_P_NONE,  0x04,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x58, 2, "BIT 3,B",            CPU_P_NONE,  0x08,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x59, 2, "BIT 3,C",            CPU_P_NONE,  0x08,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x5A, 2, "BIT 3,D",            CPU_P_NONE,  0x08,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x5B, 2, "BIT 3,E",            CPU_P_NONE,  0x08,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x5C, 2, "BIT 3,H",            CPU_P_NONE,  0x08,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x5D, 2, "BIT 3,L",            CPU_P_NONE,  0x08,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x5E, 2, "BIT 3,(HL)",         CPU_P_NONE,  0x08,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x5F, 2, "BIT 3,A",            CPU_P_NONE,  0x08,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x60, 2, "BIT 4,B",            CPU_P_NONE,  0x10,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x61, 2, "BIT 4,C",            CPU_P_NONE,  0x10,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x62, 2, "BIT 4,D",            CPU_P_NONE,  0x10,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x63, 2, "BIT 4,E",            CPU_P_NONE,  0x10,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x64, 2, "BIT 4,H",            CPU_P_NONE,  0x10,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x65, 2, "BIT 4,L",            CPU_P_NONE,  0x10,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x66, 2, "BIT 4,(HL)",         CPU_P_NONE,  0x10,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x67, 2, "BIT 4,A",            CPU_P_NONE,  0x10,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x68, 2, "BIT 5,B",            CPU_P_NONE,  0x20,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x69, 2, "BIT 5,C",            CPU_P_NONE,  0x20,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x6A, 2, "BIT 5,D",            CPU_P_NONE,  0x20,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x6B, 2, "BIT 5,E",            CPU_P_NONE,  0x20,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x6C, 2, "BIT 5,H",            CPU_P_NONE,  0x20,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x6D, 2, "BIT 5,L",            CPU_P_NONE,  0x20,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x6E, 2, "BIT 5,(HL)",         CPU_P_NONE,  0x20,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x6F, 2, "BIT 5,A",            CPU_P_NONE,  0x20,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x70, 2, "BIT 6,B",            CPU_P_NONE,  0x40,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x71, 2, "BIT 6,C",            CPU_P_NONE,  0x40,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x72, 2, "BIT 6,D",            CPU_P_NONE,  0x40,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x73, 2, "BIT 6,E",            CPU_P_NONE,  0x40,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x74, 2, "BIT 6,H",            CPU_P_NONE,  0x40,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x75, 2, "BIT 6,L",            CPU_P_NONE,  0x40,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x76, 2, "BIT 6,(HL)",         CPU_P_NONE,  0x40,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x77, 2, "BIT 6,A",            CPU_P_NONE,  0x40,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x78, 2, "BIT 7,B",            CPU_P_NONE,  0x80,     CPU_R_B,  Cpu_Execute_BIT_N_R},
-    {0x79, 2, "BIT 7,C",            CPU_P_NONE,  0x80,     CPU_R_C,  Cpu_Execute_BIT_N_R},
-    {0x7A, 2, "BIT 7,D",            CPU_P_NONE,  0x80,     CPU_R_D,  Cpu_Execute_BIT_N_R},
-    {0x7B, 2, "BIT 7,E",            CPU_P_NONE,  0x80,     CPU_R_E,  Cpu_Execute_BIT_N_R},
-    {0x7C, 2, "BIT 7,H",            CPU_P_NONE,  0x80,     CPU_R_H,  Cpu_Execute_BIT_N_R},
-    {0x7D, 2, "BIT 7,L",            CPU_P_NONE,  0x80,     CPU_R_L,  Cpu_Execute_BIT_N_R},
-    {0x7E, 2, "BIT 7,(HL)",         CPU_P_NONE,  0x80,     CPU_R_HL, Cpu_Execute_BIT_N_pRR},
-    {0x7F, 2, "BIT 7,A",            CPU_P_NONE,  0x80,     CPU_R_A,  Cpu_Execute_BIT_N_R},
-    {0x80, 2, "RES 0,B",            CPU_P_NONE,  0x01,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0x81, 2, "RES 0,C",            CPU_P_NONE,  0x01,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0x82, 2, "RES 0,D",            CPU_P_NONE,  0x01,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0x83, 2, "RES 0,E",            CPU_P_NONE,  0x01,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0x84, 2, "RES 0,H",            CPU_P_NONE,  0x01,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0x85, 2, "RES 0,L",            CPU_P_NONE,  0x01,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0x86, 2, "RES 0,(HL)",         CPU_P_NONE,  0x01,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0x87, 2, "RES 0,A",            CPU_P_NONE,  0x01,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0x88, 2, "RES 1,B",            CPU_P_NONE,  0x02,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0x89, 2, "RES 1,C",            CPU_P_NONE,  0x02,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0x8A, 2, "RES 1,D",            CPU_P_NONE,  0x02,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0x8B, 2, "RES 1,E",            CPU_P_NONE,  0x02,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0x8C, 2, "RES 1,H",            CPU_P_NONE,  0x02,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0x8D, 2, "RES 1,L",            CPU_P_NONE,  0x02,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0x8E, 2, "RES 1,(HL)",         CPU_P_NONE,  0x02,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0x8F, 2, "RES 1,A",            CPU_P_NONE,  0x02,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0x90, 2, "RES 2,B",            CPU_P_NONE,  0x04,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0x91, 2, "RES 2,C",            CPU_P_NONE,  0x04,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0x92, 2, "RES 2,D",            CPU_P_NONE,  0x04,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0x93, 2, "RES 2,E",            CPU_P_NONE,  0x04,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0x94, 2, "RES 2,H",            CPU_P_NONE,  0x04,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0x95, 2, "RES 2,L",            CPU_P_NONE,  0x04,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0x96, 2, "RES 2,(HL)",         CPU_P_NONE,  0x04,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0x97, 2, "RES 2,A",            CPU_P_NONE,  0x04,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0x98, 2, "RES 3,B",            CPU_P_NONE,  0x08,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0x99, 2, "RES 3,C",            CPU_P_NONE,  0x08,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0x9A, 2, "RES 3,D",            CPU_P_NONE,  0x08,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0x9B, 2, "RES 3,E",            CPU_P_NONE,  0x08,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0x9C, 2, "RES 3,H",            CPU_P_NONE,  0x08,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0x9D, 2, "RES 3,L",            CPU_P_NONE,  0x08,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0x9E, 2, "RES 3,(HL)",         CPU_P_NONE,  0x08,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0x9F, 2, "RES 3,A",            CPU_P_NONE,  0x08,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0xA0, 2, "RES 4,B",            CPU_P_NONE,  0x10,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0xA1, 2, "RES 4,C",            CPU_P_NONE,  0x10,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0xA2, 2, "RES 4,D",            CPU_P_NONE,  0x10,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0xA3, 2, "RES 4,E",            CPU_P_NONE,  0x10,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0xA4, 2, "RES 4,H",            CPU_P_NONE,  0x10,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0xA5, 2, "RES 4,L",            CPU_P_NONE,  0x10,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0xA6, 2, "RES 4,(HL)",         CPU_P_NONE,  0x10,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0xA7, 2, "RES 4,A",            CPU_P_NONE,  0x10,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0xA8, 2, "RES 5,B",            CPU_P_NONE,  0x20,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0xA9, 2, "RES 5,C",            CPU_P_NONE,  0x20,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0xAA, 2, "RES 5,D",            CPU_P_NONE,  0x20,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0xAB, 2, "RES 5,E",            CPU_P_NONE,  0x20,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0xAC, 2, "RES 5,H",            CPU_P_NONE,  0x20,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0xAD, 2, "RES 5,L",            CPU_P_NONE,  0x20,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0xAE, 2, "RES 5,(HL)",         CPU_P_NONE,  0x20,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0xAF, 2, "RES 5,A",            CPU_P_NONE,  0x20,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0xB0, 2, "RES 6,B",            CPU_P_NONE,  0x40,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0xB1, 2, "RES 6,C",            CPU_P_NONE,  0x40,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0xB2, 2, "RES 6,D",            CPU_P_NONE,  0x40,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0xB3, 2, "RES 6,E",            CPU_P_NONE,  0x40,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0xB4, 2, "RES 6,H",            CPU_P_NONE,  0x40,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0xB5, 2, "RES 6,L",            CPU_P_NONE,  0x40,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0xB6, 2, "RES 6,(HL)",         CPU_P_NONE,  0x40,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0xB7, 2, "RES 6,A",            CPU_P_NONE,  0x40,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0xB8, 2, "RES 7,B",            CPU_P_NONE,  0x80,     CPU_R_B,  Cpu_Execute_RES_N_R},
-    {0xB9, 2, "RES 7,C",            CPU_P_NONE,  0x80,     CPU_R_C,  Cpu_Execute_RES_N_R},
-    {0xBA, 2, "RES 7,D",            CPU_P_NONE,  0x80,     CPU_R_D,  Cpu_Execute_RES_N_R},
-    {0xBB, 2, "RES 7,E",            CPU_P_NONE,  0x80,     CPU_R_E,  Cpu_Execute_RES_N_R},
-    {0xBC, 2, "RES 7,H",            CPU_P_NONE,  0x80,     CPU_R_H,  Cpu_Execute_RES_N_R},
-    {0xBD, 2, "RES 7,L",            CPU_P_NONE,  0x80,     CPU_R_L,  Cpu_Execute_RES_N_R},
-    {0xBE, 2, "RES 7,(HL)",         CPU_P_NONE,  0x80,     CPU_R_HL, Cpu_Execute_RES_N_pRR},
-    {0xBF, 2, "RES 7,A",            CPU_P_NONE,  0x80,     CPU_R_A,  Cpu_Execute_RES_N_R},
-    {0xC0, 2, "SET 0,B",            CPU_P_NONE,  0x01,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xC1, 2, "SET 0,C",            CPU_P_NONE,  0x01,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xC2, 2, "SET 0,D",            CPU_P_NONE,  0x01,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xC3, 2, "SET 0,E",            CPU_P_NONE,  0x01,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xC4, 2, "SET 0,H",            CPU_P_NONE,  0x01,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xC5, 2, "SET 0,L",            CPU_P_NONE,  0x01,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xC6, 2, "SET 0,(HL)",         CPU_P_NONE,  0x01,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xC7, 2, "SET 0,A",            CPU_P_NONE,  0x01,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xC8, 2, "SET 1,B",            CPU_P_NONE,  0x02,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xC9, 2, "SET 1,C",            CPU_P_NONE,  0x02,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xCA, 2, "SET 1,D",            CPU_P_NONE,  0x02,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xCB, 2, "SET 1,E",            CPU_P_NONE,  0x02,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xCC, 2, "SET 1,H",            CPU_P_NONE,  0x02,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xCD, 2, "SET 1,L",            CPU_P_NONE,  0x02,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xCE, 2, "SET 1,(HL)",         CPU_P_NONE,  0x02,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xCF, 2, "SET 1,A",            CPU_P_NONE,  0x02,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xD0, 2, "SET 2,B",            CPU_P_NONE,  0x04,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xD1, 2, "SET 2,C",            CPU_P_NONE,  0x04,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xD2, 2, "SET 2,D",            CPU_P_NONE,  0x04,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xD3, 2, "SET 2,E",            CPU_P_NONE,  0x04,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xD4, 2, "SET 2,H",            CPU_P_NONE,  0x04,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xD5, 2, "SET 2,L",            CPU_P_NONE,  0x04,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xD6, 2, "SET 2,(HL)",         CPU_P_NONE,  0x04,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xD7, 2, "SET 2,A",            CPU_P_NONE,  0x04,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xD8, 2, "SET 3,B",            CPU_P_NONE,  0x08,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xD9, 2, "SET 3,C",            CPU_P_NONE,  0x08,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xDA, 2, "SET 3,D",            CPU_P_NONE,  0x08,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xDB, 2, "SET 3,E",            CPU_P_NONE,  0x08,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xDC, 2, "SET 3,H",            CPU_P_NONE,  0x08,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xDD, 2, "SET 3,L",            CPU_P_NONE,  0x08,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xDE, 2, "SET 3,(HL)",         CPU_P_NONE,  0x08,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xDF, 2, "SET 3,A",            CPU_P_NONE,  0x08,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xE0, 2, "SET 4,B",            CPU_P_NONE,  0x10,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xE1, 2, "SET 4,C",            CPU_P_NONE,  0x10,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xE2, 2, "SET 4,D",            CPU_P_NONE,  0x10,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xE3, 2, "SET 4,E",            CPU_P_NONE,  0x10,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xE4, 2, "SET 4,H",            CPU_P_NONE,  0x10,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xE5, 2, "SET 4,L",            CPU_P_NONE,  0x10,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xE6, 2, "SET 4,(HL)",         CPU_P_NONE,  0x10,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xE7, 2, "SET 4,A",            CPU_P_NONE,  0x10,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xE8, 2, "SET 5,B",            CPU_P_NONE,  0x20,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xE9, 2, "SET 5,C",            CPU_P_NONE,  0x20,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xEA, 2, "SET 5,D",            CPU_P_NONE,  0x20,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xEB, 2, "SET 5,E",            CPU_P_NONE,  0x20,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xEC, 2, "SET 5,H",            CPU_P_NONE,  0x20,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xED, 2, "SET 5,L",            CPU_P_NONE,  0x20,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xEE, 2, "SET 5,(HL)",         CPU_P_NONE,  0x20,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xEF, 2, "SET 5,A",            CPU_P_NONE,  0x20,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xF0, 2, "SET 6,B",            CPU_P_NONE,  0x40,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xF1, 2, "SET 6,C",            CPU_P_NONE,  0x40,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xF2, 2, "SET 6,D",            CPU_P_NONE,  0x40,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xF3, 2, "SET 6,E",            CPU_P_NONE,  0x40,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xF4, 2, "SET 6,H",            CPU_P_NONE,  0x40,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xF5, 2, "SET 6,L",            CPU_P_NONE,  0x40,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xF6, 2, "SET 6,(HL)",         CPU_P_NONE,  0x40,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xF7, 2, "SET 6,A",            CPU_P_NONE,  0x40,     CPU_R_A,  Cpu_Execute_SET_N_R},
-    {0xF8, 2, "SET 7,B",            CPU_P_NONE,  0x80,     CPU_R_B,  Cpu_Execute_SET_N_R},
-    {0xF9, 2, "SET 7,C",            CPU_P_NONE,  0x80,     CPU_R_C,  Cpu_Execute_SET_N_R},
-    {0xFA, 2, "SET 7,D",            CPU_P_NONE,  0x80,     CPU_R_D,  Cpu_Execute_SET_N_R},
-    {0xFB, 2, "SET 7,E",            CPU_P_NONE,  0x80,     CPU_R_E,  Cpu_Execute_SET_N_R},
-    {0xFC, 2, "SET 7,H",            CPU_P_NONE,  0x80,     CPU_R_H,  Cpu_Execute_SET_N_R},
-    {0xFD, 2, "SET 7,L",            CPU_P_NONE,  0x80,     CPU_R_L,  Cpu_Execute_SET_N_R},
-    {0xFE, 2, "SET 7,(HL)",         CPU_P_NONE,  0x80,     CPU_R_HL, Cpu_Execute_SET_N_pRR},
-    {0xFF, 2, "SET 7,A",            CPU_P_NONE,  0x80,     CPU_R_A,  Cpu_Execute_SET_N_R}
+    CPU_OPCODE_PREFIX(CPU_OPCODE_ENTRY_P)
 };
 
 
@@ -701,551 +744,2429 @@ static Cpu_OpCode_t const Cpu_OpCode_Prefix[] =
 /* Function                                           */
 /******************************************************/
 
-void Cpu_Initialize(void)
+int Cpu_Initialize(Emu_Context_t * ctx)
 {
     for(int i=0; i<CPU_REG_NUM; i++)
     {
-        CPU_REG16(i)->UWord = 0;
+        CPU_REG16(ctx, i)->UWord = 0;
+    }
+    ctx->Cpu.Operand.UWord = 0;
+    ctx->Cpu.Flag.Op = CPU_FLAG_OP_NONE;
+    ctx->Cpu.Cycle = 0;
+    ctx->Cpu.IdleCycle = 0;
+    ctx->Cpu.Irq = 0;
+    ctx->Cpu.Halted = false;
+    ctx->Cpu.Locked = false;
+    ctx->Cpu.Ime = false;
+    ctx->Cpu.ImeDelay = false;
+    ctx->Cpu.VolatileRead = false;
+    ctx->Cpu.Break = false;
+    ctx->Cpu.BreakRequest = false;
+
+    if(ctx->Cpu.Cache == NULL)
+    {
+        ctx->Cpu.Cache = calloc(1, sizeof(Cpu_Cache_t));
+        if(ctx->Cpu.Cache == NULL)
+        {
+            DEBUGGER_WARNING("Cannot allocate instruction cache\n");
+            return -1;
+        }
     }
+
+#if defined(CPU_DYNAREC)
+    ctx->Cpu.Cache->DynarecEnabled = (Dynarec_Initialize(&ctx->Cpu.Cache->Dynarec) == 0);
+#endif
+
+    Cpu_FlushCache(ctx);
+    return 0;
 }
 
 
-uint32_t Cpu_Step(void)
+void Cpu_Finalize(Emu_Context_t * ctx)
 {
-    /* Get instruction */
-    uint8_t const data = Cpu_ReadPc();
-    Cpu_OpCode_t const * opcode = &Cpu_OpCode[data];
+    if(ctx->Cpu.Cache != NULL)
+    {
+#if defined(CPU_DYNAREC)
+        Dynarec_Finalize(&ctx->Cpu.Cache->Dynarec);
+#endif
+        free(ctx->Cpu.Cache);
+        ctx->Cpu.Cache = NULL;
+    }
+}
 
-    /* Execute instruction */
-    return opcode->Callback(opcode);
+
+uint32_t Cpu_Step(Emu_Context_t * ctx)
+{
+    /* HALT wait one instruction slot for an interrupt request */
+    uint32_t const cycle = (ctx->Cpu.Irq != 0) ? Cpu_Interrupt(ctx, 4) : Cpu_Execute(ctx);
+    ctx->Cpu.Cycle += cycle;
+
+    /* The step already stop: consume the request */
+    ctx->Cpu.Break = ctx->Cpu.BreakRequest;
+    if(ctx->Cpu.BreakRequest)
+    {
+        ctx->Cpu.BreakRequest = false;
+        Interrupt_Update(ctx);
+    }
+
+    return cycle;
+}
+
+
+uint32_t Cpu_Run(Emu_Context_t * ctx, uint32_t cycles)
+{
+    uint64_t const start = ctx->Cpu.Cycle;
+    Cpu_Block_t * block = NULL;
+
+    ctx->Cpu.Break = false;
+    ctx->Cpu.End = start + cycles;
+
+    /* Scheduler_Schedule lower the end when a write start an earlier event */
+    while(ctx->Cpu.Cycle < ctx->Cpu.End)
+    {
+        /* Interrupt, HALT and EI delay are only checked between block */
+        if(ctx->Cpu.Irq != 0)
+        {
+            if(ctx->Cpu.BreakRequest)
+            {
+                ctx->Cpu.BreakRequest = false;
+                Interrupt_Update(ctx);
+                ctx->Cpu.Break = true;
+                break;
+            }
+
+            /* The EI delay slot execute one instruction outside of a block */
+            if((ctx->Cpu.Irq == CPU_IRQ_EI) && CPU_IS_BREAK(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord))
+            {
+                ctx->Cpu.Break = true;
+                break;
+            }
+
+            uint32_t const spent = Cpu_Interrupt(ctx, Cpu_GetIdleBudget(ctx));
+            ctx->Cpu.Cycle += spent;
+            block = NULL;
+            continue;
+        }
+
+        uint16_t const pc = CPU_REG16(ctx, CPU_R_PC)->UWord;
+        Cpu_Block_t * next = NULL;
+
+        /* Follow the chain of the previous block */
+        if(block != NULL)
+        {
+            int const slot = (pc == block->End) ? 0 : 1;
+            next = block->Link[slot];
+            if((next == NULL) || (next->Valid == 0) || (next->Addr != pc))
+            {
+                next = Cpu_GetBlock(ctx, pc);
+                block->Link[slot] = next;
+            }
+        }
+        else
+        {
+            next = Cpu_GetBlock(ctx, pc);
+        }
+
+        block = next;
+
+        if((block->Idle | block->Break) == 0)
+        {
+            /* Keep the cycle counter current for the peripheral synchronized on access */
+            ctx->Cpu.Cycle += Cpu_RunBlock(ctx, block);
+            continue;
+        }
+
+        /* Stop before the breakpoint instruction */
+        if(block->Break)
+        {
+            ctx->Cpu.Break = true;
+            break;
+        }
+
+        /* Polling loop: an iteration leaving the register (SP included) unchanged will repeat until an event */
+        Cpu_Reg16_t reg[CPU_R_PC];
+        Cpu_SyncFlag(ctx);
+        memcpy(reg, ctx->Cpu.Reg, sizeof(reg));
+        ctx->Cpu.VolatileRead = false;
+
+        uint32_t const spent = Cpu_RunBlock(ctx, block);
+        ctx->Cpu.Cycle += spent;
+        Cpu_SyncFlag(ctx);
+
+        if((CPU_REG16(ctx, CPU_R_PC)->UWord == block->Addr) && !ctx->Cpu.VolatileRead &&
+           (memcmp(reg, ctx->Cpu.Reg, sizeof(reg)) == 0) && (ctx->Cpu.Cycle < ctx->Cpu.End) && (spent > 0))
+        {
+            /* Skip whole iteration up to the budget end or the next event */
+            uint32_t const skip = Cpu_GetIdleBudget(ctx) / spent * spent;
+            ctx->Cpu.Cycle += skip;
+            ctx->Cpu.IdleCycle += skip;
+        }
+    }
+
+    return (uint32_t)(ctx->Cpu.Cycle - start);
+}
+
+
+static uint32_t Cpu_GetIdleBudget(Emu_Context_t const * ctx)
+{
+    uint64_t end = Scheduler_GetDeadline(ctx);
+    if(end > ctx->Cpu.End)
+    {
+        end = ctx->Cpu.End;
+    }
+
+    /* A due event is only fired after Cpu_Run return */
+    if(end < ctx->Cpu.Cycle + 4)
+    {
+        return 4;
+    }
+
+    uint64_t const budget = end - ctx->Cpu.Cycle;
+    return (budget > UINT32_MAX) ? UINT32_MAX : (uint32_t)budget;
+}
+
+
+void Cpu_NotifyVolatileRead(Emu_Context_t * ctx)
+{
+    ctx->Cpu.VolatileRead = true;
+}
+
+
+void Cpu_SyncFlag(Emu_Context_t * ctx)
+{
+    if(ctx->Cpu.Flag.Op != CPU_FLAG_OP_NONE)
+    {
+        CPU_REG8(ctx, CPU_R_F)->UByte = Cpu_GetFlag(ctx);
+        ctx->Cpu.Flag.Op = CPU_FLAG_OP_NONE;
+    }
+}
+
+
+uint32_t Cpu_Interpret(Emu_Context_t * ctx, uint16_t index, uint16_t operand)
+{
+    ctx->Cpu.Operand.UWord = operand;
+    return Cpu_Dispatch(ctx, index);
+}
+
+
+void Cpu_InvalidateCache(Emu_Context_t * ctx, uint16_t addr)
+{
+    /* Plain data: nothing cached */
+    if(!CPU_IS_CODE(ctx, addr))
+    {
+        return;
+    }
+
+    /* An instruction is at most 3 byte long */
+    for(uint16_t i=addr-2; i!=(uint16_t)(addr+1); i++)
+    {
+        Cpu_Decoded_t * decoded = CPU_DECODE_ENTRY(ctx, i);
+        if(decoded->Addr == i)
+        {
+            Cpu_DropDecoded(ctx, decoded);
+        }
+    }
+
+    /* Drop the translated block containing the address: it start at most CPU_BLOCK_SPAN byte before */
+    for(int i=0; (i<CPU_BLOCK_SPAN) && CPU_IS_CODE(ctx, addr); i++)
+    {
+        Cpu_Block_t * block = CPU_BLOCK_ENTRY(ctx, (uint16_t)(addr - i));
+        if((block->Valid != 0) && ((uint16_t)(addr - block->Addr) < (uint16_t)(block->End - block->Addr)))
+        {
+            Cpu_DropBlock(ctx, block);
+        }
+    }
+}
+
+
+void Cpu_InvalidateRange(Emu_Context_t * ctx, uint16_t addr, uint32_t size)
+{
+    Cpu_Cache_t * const cache = ctx->Cpu.Cache;
+
+    /* An instruction starting up to 2 byte before the range can overlap it */
+    uint16_t const first = addr - 2;
+    uint32_t const span = size + 2;
+
+    for(int i=0; i<CPU_DECODE_CACHE_SIZE; i++)
+    {
+        if((uint16_t)(cache->Decode[i].Addr - first) < span)
+        {
+            Cpu_DropDecoded(ctx, &cache->Decode[i]);
+        }
+    }
+
+    for(int i=0; i<CPU_BLOCK_CACHE_SIZE; i++)
+    {
+        Cpu_Block_t * block = &cache->Block[i];
+        if((block->Valid != 0) &&
+           ((uint16_t)(block->Addr - addr) < size || (uint16_t)(addr - block->Addr) < (uint16_t)(block->End - block->Addr)))
+        {
+            Cpu_DropBlock(ctx, block);
+        }
+    }
+}
+
+
+void Cpu_SetBreakpoint(Emu_Context_t * ctx, uint16_t addr, bool enable)
+{
+    uint8_t * const map = &ctx->Cpu.Cache->BreakMap[addr >> 3];
+
+    if(enable)
+    {
+        *map |= 1 << (addr & 7);
+    }
+    else
+    {
+        *map &= ~(1 << (addr & 7));
+    }
+
+    /* Retranslate the block containing or starting at the address */
+    Cpu_InvalidateRange(ctx, addr, 1);
+}
+
+
+void Cpu_ClearBreakpoint(Emu_Context_t * ctx)
+{
+    memset(ctx->Cpu.Cache->BreakMap, 0, sizeof(ctx->Cpu.Cache->BreakMap));
+    Cpu_FlushCache(ctx);
+}
+
+
+void Cpu_RequestBreak(Emu_Context_t * ctx)
+{
+    ctx->Cpu.BreakRequest = true;
+    Interrupt_Update(ctx);
+
+    /* PC already point after the instruction: leave its block as for a self-modifying write */
+    Cpu_InvalidateCache(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord - 1);
+}
+
+
+bool Cpu_IsBreakpoint(Emu_Context_t const * ctx, uint16_t addr)
+{
+    return CPU_IS_BREAK(ctx, addr) != 0;
+}
+
+
+void Cpu_FlushCache(Emu_Context_t * ctx)
+{
+    Cpu_Cache_t * const cache = ctx->Cpu.Cache;
+
+    for(int i=0; i<CPU_DECODE_CACHE_SIZE; i++)
+    {
+        cache->Decode[i].OpCode = NULL;
+    }
+
+    for(int i=0; i<CPU_BLOCK_CACHE_SIZE; i++)
+    {
+        cache->Block[i].Valid = 0;
+    }
+
+    memset(cache->CodeCount, 0, sizeof(cache->CodeCount));
+
+#if defined(CPU_DYNAREC)
+    Dynarec_Flush(&cache->Dynarec);
+#endif
+}
+
+
+static inline Cpu_Decoded_t const * Cpu_Decode(Emu_Context_t * ctx, uint16_t addr)
+{
+    Cpu_Decoded_t * decoded = CPU_DECODE_ENTRY(ctx, addr);
+
+    /* Cache hit */
+    if((decoded->OpCode != NULL) && (decoded->Addr == addr))
+    {
+        return decoded;
+    }
+
+    /* Evict the previous instruction of the entry */
+    Cpu_DropDecoded(ctx, decoded);
+
+    /* Resolve the opcode (CB prefix included) */
+    uint8_t const data = Memory_Read(ctx, addr);
+    Cpu_OpCode_t const * opcode = &Cpu_OpCode[data];
+    if(data == 0xCB)
+    {
+        opcode = &Cpu_OpCode_Prefix[Memory_Read(ctx, addr + 1)];
+    }
+
+    /* Assemble the immediate operand */
+    uint16_t operand = 0;
+    if(opcode->Size >= 2)
+    {
+        operand = Memory_Read(ctx, addr + 1);
+    }
+    if(opcode->Size >= 3)
+    {
+        operand = CONCAT(operand, Memory_Read(ctx, addr + 2));
+    }
+
+    decoded->OpCode  = opcode;
+    decoded->Addr    = addr;
+    decoded->Operand = operand;
+    decoded->Index   = (data == 0xCB) ? (0x100 | (operand & 0xFF)) : data;
+    decoded->Size    = opcode->Size;
+    decoded->Cycle   = opcode->Cycle;
+
+    /* Remember the decoded address for invalidation */
+    for(uint16_t i=0; i<decoded->Size; i++)
+    {
+        ctx->Cpu.Cache->CodeCount[(uint16_t)(addr + i)] ++;
+    }
+
+    return decoded;
+}
+
+
+static void Cpu_DropDecoded(Emu_Context_t * ctx, Cpu_Decoded_t * decoded)
+{
+    if(decoded->OpCode == NULL)
+    {
+        return;
+    }
+
+    for(uint16_t i=0; i<decoded->Size; i++)
+    {
+        ctx->Cpu.Cache->CodeCount[(uint16_t)(decoded->Addr + i)] --;
+    }
+    decoded->OpCode = NULL;
+}
+
+
+static inline uint8_t Cpu_GetFlag(Emu_Context_t const * ctx)
+{
+    Cpu_Flag_t const * flag = &ctx->Cpu.Flag;
+    uint8_t const result = (uint8_t)flag->Result;
+    uint8_t f = CPU_REG8(ctx, CPU_R_F)->UByte & ~Cpu_FlagMask[flag->Op];
+
+    switch(flag->Op)
+    {
+        case CPU_FLAG_OP_INC:
+            f |= Cpu_FlagInc[result];
+            break;
+        case CPU_FLAG_OP_DEC:
+            f |= Cpu_FlagDec[result];
+            break;
+        case CPU_FLAG_OP_ADD:
+            f |= Cpu_FlagAdd[CPU_TABLE_INDEX(flag->Data0, flag->Data1, flag->Result)];
+            break;
+        case CPU_FLAG_OP_SUB:
+            f |= Cpu_FlagSub[CPU_TABLE_INDEX(flag->Data0, flag->Data1, flag->Result)];
+            break;
+        case CPU_FLAG_OP_AND:
+            f |= Cpu_FlagAnd[result];
+            break;
+        case CPU_FLAG_OP_LOGIC:
+            f |= Cpu_FlagLogic[result];
+            break;
+        case CPU_FLAG_OP_BIT:
+            f |= ((result == 0x00) ? CPU_F_Z : CPU_F_NO) | CPU_F_H;
+            break;
+        case CPU_FLAG_OP_ADD16:
+            f |= (((flag->Data0 & 0x0FFF) + (flag->Data1 & 0x0FFF)) > 0x0FFF) ? CPU_F_H : CPU_F_NO;
+            f |= (((uint32_t)flag->Data0 + (uint32_t)flag->Data1) > 0xFFFF) ? CPU_F_C : CPU_F_NO;
+            break;
+        case CPU_FLAG_OP_ROT:
+            f |= (result == 0x00) ? CPU_F_Z : CPU_F_NO;
+            f |= ((flag->Result & 0x100) != 0) ? CPU_F_C : CPU_F_NO;
+            break;
+        case CPU_FLAG_OP_ROTA:
+            f |= ((flag->Result & 0x100) != 0) ? CPU_F_C : CPU_F_NO;
+            break;
+        default:
+            /* CPU_FLAG_OP_NONE: F register is up to date */
+            break;
+    }
+
+    return f;
+}
+
+
+static inline void Cpu_SetFlag(Emu_Context_t * ctx, uint8_t op, uint16_t data0, uint16_t data1, uint16_t result)
+{
+    /* The flag kept by the new operation must be evaluated before the pending one is lost */
+    if((Cpu_FlagMask[ctx->Cpu.Flag.Op] & ~Cpu_FlagMask[op]) != 0)
+    {
+        Cpu_SyncFlag(ctx);
+    }
+
+    ctx->Cpu.Flag.Op = op;
+    ctx->Cpu.Flag.Data0 = data0;
+    ctx->Cpu.Flag.Data1 = data1;
+    ctx->Cpu.Flag.Result = result;
+}
+
+
+static inline void Cpu_AluAdd(Emu_Context_t * ctx, uint8_t data, bool carry)
+{
+    uint8_t const dataA = CPU_REG8(ctx, CPU_R_A)->UByte;
+    uint8_t const dataC = (carry && CPU_FLAG_CHECK(ctx, CPU_F_C, CPU_F_C)) ? 0x01 : 0x00;
+    uint16_t const result = dataA + data + dataC;
+    CPU_REG8(ctx, CPU_R_A)->UByte = (uint8_t)result;
+
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_ADD, dataA, data, result);
+}
+
+
+static inline void Cpu_AluSub(Emu_Context_t * ctx, uint8_t data, bool carry, bool store)
+{
+    uint8_t const dataA = CPU_REG8(ctx, CPU_R_A)->UByte;
+    uint8_t const dataC = (carry && CPU_FLAG_CHECK(ctx, CPU_F_C, CPU_F_C)) ? 0x01 : 0x00;
+    uint16_t const result = dataA - data - dataC;
+    if(store)
+    {
+        CPU_REG8(ctx, CPU_R_A)->UByte = (uint8_t)result;
+    }
+
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_SUB, dataA, data, result);
+}
+
+
+static inline void Cpu_AluLogic(Emu_Context_t * ctx, uint8_t op, uint8_t data, uint8_t result)
+{
+    uint8_t const dataA = CPU_REG8(ctx, CPU_R_A)->UByte;
+    CPU_REG8(ctx, CPU_R_A)->UByte = result;
+
+    Cpu_SetFlag(ctx, op, dataA, data, result);
+}
+
+
+static inline uint16_t Cpu_AluRotate(Emu_Context_t * ctx, uint32_t rot, uint8_t data)
+{
+    uint16_t const carry = (((rot == CPU_ROT_RL) || (rot == CPU_ROT_RR)) && CPU_FLAG_CHECK(ctx, CPU_F_C, CPU_F_C)) ? 0x01 : 0x00;
+    uint16_t const out = (data & 0x01) << 8;
+
+    switch(rot)
+    {
+        case CPU_ROT_RLC:
+            return (data << 1) | (data >> 7);
+        case CPU_ROT_RRC:
+            return out | ((data & 0x01) << 7) | (data >> 1);
+        case CPU_ROT_RL:
+            return (data << 1) | carry;
+        case CPU_ROT_RR:
+            return out | (carry << 7) | (data >> 1);
+        case CPU_ROT_SLA:
+            return data << 1;
+        case CPU_ROT_SRA:
+            return out | (data & 0x80) | (data >> 1);
+        case CPU_ROT_SWAP:
+            return (uint8_t)((data << 4) | (data >> 4));
+        default:
+            /* CPU_ROT_SRL */
+            return out | (data >> 1);
+    }
+}
+
+
+static inline uint16_t Cpu_AluOffset(Emu_Context_t * ctx, uint16_t data, int8_t offset)
+{
+    /* Half carry and carry come from the unsigned low Byte addition */
+    uint8_t const data0 = (uint8_t)data;
+    uint8_t const data1 = (uint8_t)offset;
+    uint8_t const flag = Cpu_FlagAdd[CPU_TABLE_INDEX(data0, data1, data0 + data1)];
+    Cpu_WriteFlag(ctx, flag & (CPU_F_H | CPU_F_C));
+
+    return data + offset;
+}
+
+
+static inline void Cpu_WriteFlag(Emu_Context_t * ctx, uint8_t flag)
+{
+    CPU_REG8(ctx, CPU_R_F)->UByte = flag;
+    ctx->Cpu.Flag.Op = CPU_FLAG_OP_NONE;
+}
+
+
+static inline void Cpu_Push(Emu_Context_t * ctx, uint16_t data)
+{
+    uint16_t const sp = CPU_REG16(ctx, CPU_R_SP)->UWord;
+    Memory_Write(ctx, sp - 1, (uint8_t)(data >> 8));
+    Memory_Write(ctx, sp - 2, (uint8_t)data);
+    CPU_REG16(ctx, CPU_R_SP)->UWord = sp - 2;
+}
+
+
+static inline uint16_t Cpu_Pop(Emu_Context_t * ctx)
+{
+    uint16_t const sp = CPU_REG16(ctx, CPU_R_SP)->UWord;
+    uint8_t const data0 = Memory_Read(ctx, sp);
+    uint8_t const data1 = Memory_Read(ctx, sp + 1);
+    CPU_REG16(ctx, CPU_R_SP)->UWord = sp + 2;
+
+    return CONCAT(data0, data1);
+}
+
+
+static inline int Cpu_Dispatch(Emu_Context_t * ctx, uint16_t index)
+{
+    switch(index)
+    {
+        CPU_DISPATCH_256(0x000, Cpu_OpCode)
+        CPU_DISPATCH_256(0x100, Cpu_OpCode_Prefix)
+    }
+
+    return 0;
+}
+
+
+static Cpu_Block_t * Cpu_GetBlock(Emu_Context_t * ctx, uint16_t addr)
+{
+    Cpu_Block_t * block = CPU_BLOCK_ENTRY(ctx, addr);
+
+    /* Cache hit */
+    if((block->Valid != 0) && (block->Addr == addr))
+    {
+        return block;
+    }
+
+    /* Translate straight-line instruction up to the next branch */
+    uint16_t pc = addr;
+    int count = 0;
+    while(count < CPU_BLOCK_LENGTH)
+    {
+        /* A breakpoint start its own block */
+        if((count > 0) && CPU_IS_BREAK(ctx, pc))
+        {
+            break;
+        }
+
+        Cpu_Decoded_t const * decoded = Cpu_Decode(ctx, pc);
+        block->Inst[count ++] = *decoded;
+        pc += decoded->Size;
+
+        if(Cpu_IsBlockEnd(decoded->OpCode))
+        {
+            break;
+        }
+    }
+
+    /* Evict the previous block of the entry, remember the translated address for invalidation */
+    Cpu_DropBlock(ctx, block);
+    for(uint16_t i=addr; i!=pc; i++)
+    {
+        ctx->Cpu.Cache->CodeCount[i] ++;
+    }
+
+    block->Addr    = addr;
+    block->End     = pc;
+    block->Count   = count;
+    block->Link[0] = NULL;
+    block->Link[1] = NULL;
+    block->Idle    = Cpu_IsIdleLoop(block);
+    block->Break   = CPU_IS_BREAK(ctx, addr) != 0;
+    block->Valid   = 1;
+#if defined(CPU_DYNAREC)
+    block->Native  = NULL;
+    block->Hits    = 0;
+#endif
+
+    return block;
+}
+
+
+static void Cpu_DropBlock(Emu_Context_t * ctx, Cpu_Block_t * block)
+{
+    if(block->Valid == 0)
+    {
+        return;
+    }
+
+    for(uint16_t i=block->Addr; i!=block->End; i++)
+    {
+        ctx->Cpu.Cache->CodeCount[i] --;
+    }
+    block->Valid = 0;
+}
+
+
+#if defined(CPU_DISPATCH_GOTO)
+static inline uint32_t Cpu_ExecuteBlock(Emu_Context_t * ctx, Cpu_Block_t const * block)
+{
+    static void const * const label[] =
+    {
+        CPU_LABEL_256(M)
+        CPU_LABEL_256(P)
+    };
+
+    Cpu_Decoded_t const * inst = block->Inst;
+    Cpu_Decoded_t const * const end = inst + block->Count;
+    uint32_t cycle = 0;
+
+/* Point PC to the next instruction and jump to its threaded code */
+#define CPU_THREAD_FETCH() \
+    do { \
+        CPU_REG16(ctx, CPU_R_PC)->UWord = inst->Addr + inst->Size; \
+        ctx->Cpu.Operand.UWord = inst->Operand; \
+        goto *label[inst->Index]; \
+    } while(0)
+
+/* Stop at the end of the block or if the instruction modified its own block */
+#define CPU_THREAD_NEXT() \
+    do { \
+        if((++ inst == end) || (block->Valid == 0)) \
+        { \
+            return cycle; \
+        } \
+        CPU_THREAD_FETCH(); \
+    } while(0)
+
+    CPU_THREAD_FETCH();
+    CPU_THREAD_256(M, Cpu_OpCode)
+    CPU_THREAD_256(P, Cpu_OpCode_Prefix)
+
+#undef CPU_THREAD_FETCH
+#undef CPU_THREAD_NEXT
+
+    return cycle;
+}
+#else
+static inline uint32_t Cpu_ExecuteBlock(Emu_Context_t * ctx, Cpu_Block_t const * block)
+{
+    uint32_t cycle = 0;
+
+    for(int i=0; i<block->Count; i++)
+    {
+        Cpu_Decoded_t const * inst = &block->Inst[i];
+
+        /* Point PC to the next instruction */
+        CPU_REG16(ctx, CPU_R_PC)->UWord = inst->Addr + inst->Size;
+        ctx->Cpu.Operand.UWord = inst->Operand;
+
+        cycle += Cpu_Dispatch(ctx, inst->Index);
+
+        /* Stop if the instruction modified its own block */
+        if(block->Valid == 0)
+        {
+            break;
+        }
+    }
+
+    return cycle;
+}
+#endif
+
+
+static inline bool Cpu_IsBlockEnd(Cpu_OpCode_t const * opcode)
+{
+    return (opcode->Attr & CPU_A_END) != 0;
+}
+
+
+static bool Cpu_IsIdleSafe(Cpu_OpCode_t const * opcode)
+{
+    return (opcode->Attr & CPU_A_IDLE) != 0;
+}
+
+
+static bool Cpu_IsIdleLoop(Cpu_Block_t const * block)
+{
+    /* The block must end with a relative jump to its own start */
+    Cpu_Decoded_t const * last = &block->Inst[block->Count - 1];
+    if(((last->OpCode->Attr & CPU_A_JR) == 0) ||
+       ((uint16_t)(block->End + (int8_t)last->Operand) != block->Addr))
+    {
+        return false;
+    }
+
+    for(int i=0; i<block->Count - 1; i++)
+    {
+        if(!Cpu_IsIdleSafe(block->Inst[i].OpCode))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static inline uint32_t Cpu_RunBlock(Emu_Context_t * ctx, Cpu_Block_t * block)
+{
+#if defined(CPU_DYNAREC)
+    /* Run hot block natively */
+    if((block->Native == NULL) && ctx->Cpu.Cache->DynarecEnabled && (++ block->Hits == DYNAREC_THRESHOLD))
+    {
+        Cpu_TranslateBlock(ctx, block);
+    }
+    if(block->Native != NULL)
+    {
+        return block->Native(ctx);
+    }
+#endif
+
+    return Cpu_ExecuteBlock(ctx, block);
+}
+
+
+static inline uint32_t Cpu_Execute(Emu_Context_t * ctx)
+{
+    /* Get instruction */
+    uint16_t const pc = CPU_REG16(ctx, CPU_R_PC)->UWord;
+    Cpu_Decoded_t const * decoded = Cpu_Decode(ctx, pc);
+    Cpu_OpCode_t const * opcode = decoded->OpCode;
+
+    /* Point PC to the next instruction */
+    CPU_REG16(ctx, CPU_R_PC)->UWord = pc + decoded->Size;
+    ctx->Cpu.Operand.UWord = decoded->Operand;
+
+    /* Execute instruction */
+    return opcode->Callback(ctx, opcode);
+}
+
+
+static uint32_t Cpu_Interrupt(Emu_Context_t * ctx, uint32_t budget)
+{
+    uint8_t const source = ctx->Cpu.Irq & INTERRUPT_ALL;
+
+    /* Dispatch the highest priority (lowest bit) request, wake up from HALT */
+    if(source != 0)
+    {
+        uint16_t vector = INTERRUPT_VECTOR;
+        uint8_t bit = 0x01;
+        while((source & bit) == 0)
+        {
+            bit <<= 1;
+            vector += 8;
+        }
+
+        ctx->Cpu.Ime = false;
+        ctx->Cpu.ImeDelay = false;
+        ctx->Cpu.Halted = false;
+        Interrupt_Acknowledge(ctx, bit);
+
+        Cpu_Push(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord);
+        CPU_REG16(ctx, CPU_R_PC)->UWord = vector;
+        return 20;
+    }
+
+    if(ctx->Cpu.Halted)
+    {
+        /* Nothing happen before the next event, the budget never go past it */
+        if(ctx->Cpu.Locked || (Interrupt_GetPending(ctx) == 0))
+        {
+            ctx->Cpu.IdleCycle += budget;
+            return budget;
+        }
+
+        /* IME is clear: resume after HALT without dispatch (one instruction slot to wake up) */
+        ctx->Cpu.Halted = false;
+        Interrupt_Update(ctx);
+        return 4;
+    }
+
+    /* EI take effect after the next instruction (unless it is DI) */
+    bool const delay = ctx->Cpu.ImeDelay;
+    uint32_t const cycle = Cpu_Execute(ctx);
+    if(delay && ctx->Cpu.ImeDelay)
+    {
+        ctx->Cpu.ImeDelay = false;
+        ctx->Cpu.Ime = true;
+        Interrupt_Update(ctx);
+    }
+
+    return cycle;
+}
+
+
+#if defined(CPU_DYNAREC)
+static void Cpu_TranslateBlock(Emu_Context_t * ctx, Cpu_Block_t * block)
+{
+    Dynarec_Inst_t inst[CPU_BLOCK_LENGTH];
+
+    for(int i=0; i<block->Count; i++)
+    {
+        inst[i].Index   = block->Inst[i].Index;
+        inst[i].Operand = block->Inst[i].Operand;
+        inst[i].Next    = block->Inst[i].Addr + block->Inst[i].Size;
+        inst[i].Cycle   = block->Inst[i].Cycle;
+    }
+
+    block->Native = Dynarec_Translate(&ctx->Cpu.Cache->Dynarec, inst, block->Count, &block->Valid,
+                                      ctx->Cpu.Cache->CodeCount);
+
+    /* Code buffer is full: restart from an empty translation cache */
+    if(block->Native == NULL)
+    {
+        Cpu_FlushCache(ctx);
+    }
+}
+#endif
+
+
+#if defined(CPU_DYNAREC)
+int Cpu_CheckDynarec(Emu_Context_t * ctx, uint32_t count, bool mismatch[CPU_INDEX_NUM])
+{
+    Cpu_Cache_t * const cache = ctx->Cpu.Cache;
+    uint8_t ram[CPU_CHECK_WRAM_SIZE + CPU_CHECK_HRAM_SIZE];
+    uint8_t ram_expected[CPU_CHECK_WRAM_SIZE + CPU_CHECK_HRAM_SIZE];
+    uint8_t ram_native[CPU_CHECK_WRAM_SIZE + CPU_CHECK_HRAM_SIZE];
+    uint32_t seed = 1;
+    int failed = 0;
+
+    if(!cache->DynarecEnabled)
+    {
+        return -1;
+    }
+
+    memset(mismatch, 0, CPU_INDEX_NUM * sizeof(bool));
+    for(uint32_t n=0; n<count; n++)
+    {
+        for(uint16_t index=0; index<CPU_INDEX_NUM; index++)
+        {
+            /* The CB prefix is only dispatched with its second Byte, an illegal opcode lock the CPU */
+            static uint8_t const skip[] = {0xCB, 0xD3, 0xDB, 0xDD, 0xE3, 0xE4, 0xEB, 0xEC, 0xED, 0xF4, 0xFC, 0xFD};
+            if((index < 0x100) && (memchr(skip, index, sizeof(skip)) != NULL))
+            {
+                continue;
+            }
+
+            /* Block of an instruction setting the flag and the checked one, the translation know the pending flag */
+            static uint16_t const prefix[] = {0x00, 0x05, 0x17, 0x3C, 0x3D, 0x80, 0x99, 0xA0, 0xA9, 0xAF, 0xD6, 0xE6, 0xFE,
+                                              0x117, 0x147, 0x17C};
+            Dynarec_Inst_t inst[2];
+            uint16_t const first = prefix[CPU_CHECK_RANDOM(seed) % (sizeof(prefix) / sizeof(prefix[0]))];
+            Cpu_CheckInst(&inst[0], first, (uint16_t)CPU_CHECK_RANDOM(seed), &seed);
+            Cpu_CheckInst(&inst[1], index, inst[0].Next, &seed);
+            Cpu_CheckState(ctx, &seed);
+
+            Cpu_Info_t const initial = ctx->Cpu;
+            Cpu_CheckMemory(ctx, ram, false);
+
+            /* Reference: interpreter, as the native block fallback */
+            uint32_t cycle = 0;
+            for(int i=0; i<2; i++)
+            {
+                CPU_REG16(ctx, CPU_R_PC)->UWord = inst[i].Next;
+                cycle += Cpu_Interpret(ctx, inst[i].Index, inst[i].Operand);
+            }
+            Cpu_SyncFlag(ctx);
+            Cpu_Info_t const expected = ctx->Cpu;
+            Cpu_CheckMemory(ctx, ram_expected, false);
+
+            /* Same initial state for the native block */
+            ctx->Cpu = initial;
+            Cpu_CheckMemory(ctx, ram, true);
+
+            uint8_t valid = 1;
+            Dynarec_Block_t native = Dynarec_Translate(&cache->Dynarec, inst, 2, &valid, cache->CodeCount);
+            if(native == NULL)
+            {
+                Cpu_FlushCache(ctx);
+                native = Dynarec_Translate(&cache->Dynarec, inst, 2, &valid, cache->CodeCount);
+            }
+            uint32_t const native_cycle = native(ctx);
+            Cpu_SyncFlag(ctx);
+            Cpu_CheckMemory(ctx, ram_native, false);
+
+            bool const same = (memcmp(ctx->Cpu.Reg, expected.Reg, sizeof(expected.Reg)) == 0) && (native_cycle == cycle) &&
+                              (memcmp(ram_native, ram_expected, sizeof(ram_native)) == 0);
+            if(!same && !mismatch[index])
+            {
+                mismatch[index] = true;
+                failed ++;
+            }
+        }
+    }
+
+    return failed;
+}
+
+
+static void Cpu_CheckState(Emu_Context_t * ctx, uint32_t * seed)
+{
+    uint32_t const a = CPU_CHECK_RANDOM(*seed);
+    uint32_t const b = CPU_CHECK_RANDOM(*seed);
+    uint32_t const c = CPU_CHECK_RANDOM(*seed);
+
+    CPU_REG8(ctx, CPU_R_A)->UByte = (uint8_t)a;
+    CPU_REG8(ctx, CPU_R_F)->UByte = (uint8_t)(a >> 7) & CPU_F_ALL;
+    CPU_REG8(ctx, CPU_R_B)->UByte = 0xC1 + b % 0x1D;
+    CPU_REG8(ctx, CPU_R_C)->UByte = 0x80 + (b >> 5) % CPU_CHECK_HRAM_SIZE;
+    CPU_REG8(ctx, CPU_R_D)->UByte = 0xC1 + c % 0x1D;
+    CPU_REG8(ctx, CPU_R_E)->UByte = (uint8_t)(c >> 7);
+    CPU_REG8(ctx, CPU_R_H)->UByte = 0xC1 + CPU_CHECK_RANDOM(*seed) % 0x1D;
+    CPU_REG8(ctx, CPU_R_L)->UByte = (uint8_t)CPU_CHECK_RANDOM(*seed);
+    CPU_REG16(ctx, CPU_R_SP)->UWord = 0xC100 + CPU_CHECK_RANDOM(*seed) % 0x1C00;
+
+    /* Any pending flag operation left by the interpreter */
+    ctx->Cpu.Flag.Op = CPU_CHECK_RANDOM(*seed) % CPU_FLAG_OP_NUM;
+    ctx->Cpu.Flag.Data0 = (uint16_t)CPU_CHECK_RANDOM(*seed);
+    ctx->Cpu.Flag.Data1 = (uint16_t)CPU_CHECK_RANDOM(*seed);
+    ctx->Cpu.Flag.Result = (uint16_t)CPU_CHECK_RANDOM(*seed);
+}
+
+
+static void Cpu_CheckInst(Dynarec_Inst_t * inst, uint16_t index, uint16_t addr, uint32_t * seed)
+{
+    Cpu_OpCode_t const * opcode = (index >= 0x100) ? &Cpu_OpCode_Prefix[index & 0xFF] : &Cpu_OpCode[index];
+    uint16_t operand = 0;
+
+    if(index >= 0x100)
+    {
+        operand = index & 0xFF;
+    }
+    else if((index == 0xE0) || (index == 0xF0))
+    {
+        operand = (CPU_CHECK_HRAM & 0xFF) + CPU_CHECK_RANDOM(*seed) % CPU_CHECK_HRAM_SIZE;
+    }
+    else if(opcode->Size == 3)
+    {
+        operand = 0xC100 + CPU_CHECK_RANDOM(*seed) % 0x1C00;
+    }
+    else if(opcode->Size == 2)
+    {
+        operand = CPU_CHECK_RANDOM(*seed) & 0xFF;
+    }
+
+    inst->Index   = index;
+    inst->Operand = operand;
+    inst->Next    = addr + opcode->Size;
+    inst->Cycle   = opcode->Cycle;
+}
+
+
+static void Cpu_CheckMemory(Emu_Context_t * ctx, uint8_t * data, bool restore)
+{
+    for(int i=0; i<CPU_CHECK_WRAM_SIZE + CPU_CHECK_HRAM_SIZE; i++)
+    {
+        uint16_t const addr = (i < CPU_CHECK_WRAM_SIZE) ? (CPU_CHECK_WRAM + i) : (CPU_CHECK_HRAM + i - CPU_CHECK_WRAM_SIZE);
+
+        /* Write only the modified byte */
+        if(!restore)
+        {
+            data[i] = Memory_Read(ctx, addr);
+        }
+        else if(Memory_Read(ctx, addr) != data[i])
+        {
+            Memory_Write(ctx, addr, data[i]);
+        }
+    }
+}
+#endif
+
+
+uint32_t Cpu_BenchAlu(Emu_Context_t * ctx, uint32_t count, bool table)
+{
+    uint32_t sum = 0;
+
+    Cpu_SyncFlag(ctx);
+    for(uint32_t n=0; n<count; n++)
+    {
+        for(int op=0; op<CPU_ALU_NUM; op++)
+        {
+            /* Every (A, operand) pair in a scrambled order (odd multiplier), carry set on odd pass */
+            for(uint32_t index=0; index<0x10000; index++)
+            {
+                uint16_t const pair = (uint16_t)(index * 0x9E3B);
+                CPU_REG8(ctx, CPU_R_A)->UByte = (uint8_t)(pair >> 8);
+                CPU_REG8(ctx, CPU_R_F)->UByte = ((n & 1) != 0) ? CPU_F_C : CPU_F_NO;
+                if(table)
+                {
+                    Cpu_AluTable(ctx, (Cpu_AluOp_e)op, (uint8_t)pair);
+                }
+                else
+                {
+                    Cpu_AluReference(ctx, (Cpu_AluOp_e)op, (uint8_t)pair);
+                }
+                /* Byte access: reading AF as a word right after the byte store stalls the store forwarding */
+                sum = (sum * 31 + CPU_REG8(ctx, CPU_R_F)->UByte) ^ ((uint32_t)CPU_REG8(ctx, CPU_R_A)->UByte << 16);
+            }
+        }
+    }
+
+    return sum;
+}
+
+
+static inline void Cpu_AluReference(Emu_Context_t * ctx, Cpu_AluOp_e op, uint8_t data)
+{
+    uint8_t const dataA = CPU_REG8(ctx, CPU_R_A)->UByte;
+    uint8_t const carry = ((CPU_REG8(ctx, CPU_R_F)->UByte & CPU_F_C) != 0) ? 0x01 : 0x00;
+    uint8_t const dataC = ((op == CPU_ALU_ADC) || (op == CPU_ALU_SBC)) ? carry : 0x00;
+    uint8_t result = dataA;
+
+    switch(op)
+    {
+        case CPU_ALU_ADD:
+        case CPU_ALU_ADC:
+            result = dataA + data + dataC;
+            CPU_FLAG_CLEAR(ctx, CPU_F_ALL);
+            if(result == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_Z);
+            }
+            if(((dataA & 0x0F) + (data & 0x0F) + dataC) > 0x0F)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_H);
+            }
+            if(((uint32_t)dataA + data + dataC) > 0xFF)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_C);
+            }
+            break;
+        case CPU_ALU_SUB:
+        case CPU_ALU_SBC:
+        case CPU_ALU_CP:
+            result = dataA - data - dataC;
+            CPU_FLAG_CLEAR(ctx, CPU_F_ALL);
+            CPU_FLAG_SET(ctx, CPU_F_N);
+            if(result == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_Z);
+            }
+            if(((data & 0x0F) + dataC) > (dataA & 0x0F))
+            {
+                CPU_FLAG_SET(ctx, CPU_F_H);
+            }
+            if(((uint32_t)data + dataC) > dataA)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_C);
+            }
+            if(op == CPU_ALU_CP)
+            {
+                result = dataA;
+            }
+            break;
+        case CPU_ALU_AND:
+            result = dataA & data;
+            CPU_FLAG_CLEAR(ctx, CPU_F_ALL);
+            CPU_FLAG_SET(ctx, CPU_F_H);
+            if(result == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_Z);
+            }
+            break;
+        case CPU_ALU_XOR:
+        case CPU_ALU_OR:
+            result = (op == CPU_ALU_XOR) ? (dataA ^ data) : (dataA | data);
+            CPU_FLAG_CLEAR(ctx, CPU_F_ALL);
+            if(result == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_Z);
+            }
+            break;
+        case CPU_ALU_INC:
+            result = data + 1;
+            CPU_FLAG_CLEAR(ctx, CPU_F_Z | CPU_F_N | CPU_F_H);
+            if(result == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_Z);
+            }
+            if((data & 0x0F) == 0x0F)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_H);
+            }
+            break;
+        case CPU_ALU_DEC:
+            result = data - 1;
+            CPU_FLAG_CLEAR(ctx, CPU_F_Z | CPU_F_H);
+            CPU_FLAG_SET(ctx, CPU_F_N);
+            if(result == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_Z);
+            }
+            if((data & 0x0F) == 0x00)
+            {
+                CPU_FLAG_SET(ctx, CPU_F_H);
+            }
+            break;
+        default:
+            break;
+    }
+
+    CPU_REG8(ctx, CPU_R_A)->UByte = result;
+}
+
+
+static inline void Cpu_AluTable(Emu_Context_t * ctx, Cpu_AluOp_e op, uint8_t data)
+{
+    uint8_t const dataA = CPU_REG8(ctx, CPU_R_A)->UByte;
+    uint8_t const carry = ((CPU_REG8(ctx, CPU_R_F)->UByte & CPU_F_C) != 0) ? 0x01 : 0x00;
+    uint8_t const dataC = ((op == CPU_ALU_ADC) || (op == CPU_ALU_SBC)) ? carry : 0x00;
+    uint16_t result = dataA;
+    uint8_t f = CPU_REG8(ctx, CPU_R_F)->UByte;
+
+    switch(op)
+    {
+        case CPU_ALU_ADD:
+        case CPU_ALU_ADC:
+            result = dataA + data + dataC;
+            f = Cpu_FlagAdd[CPU_TABLE_INDEX(dataA, data, result)];
+            break;
+        case CPU_ALU_SUB:
+        case CPU_ALU_SBC:
+        case CPU_ALU_CP:
+            result = dataA - data - dataC;
+            f = Cpu_FlagSub[CPU_TABLE_INDEX(dataA, data, result)];
+            if(op == CPU_ALU_CP)
+            {
+                result = dataA;
+            }
+            break;
+        case CPU_ALU_AND:
+            result = dataA & data;
+            f = Cpu_FlagAnd[result];
+            break;
+        case CPU_ALU_XOR:
+        case CPU_ALU_OR:
+            result = (op == CPU_ALU_XOR) ? (dataA ^ data) : (dataA | data);
+            f = Cpu_FlagLogic[result];
+            break;
+        case CPU_ALU_INC:
+            result = (uint8_t)(data + 1);
+            f = (f & CPU_F_C) | Cpu_FlagInc[result];
+            break;
+        case CPU_ALU_DEC:
+            result = (uint8_t)(data - 1);
+            f = (f & CPU_F_C) | Cpu_FlagDec[result];
+            break;
+        default:
+            break;
+    }
+
+    CPU_REG8(ctx, CPU_R_A)->UByte = (uint8_t)result;
+    CPU_REG8(ctx, CPU_R_F)->UByte = f;
+}
+
+
+uint16_t Cpu_GetProgramCounter(Emu_Context_t const * ctx)
+{
+    return ctx->Cpu.Reg[CPU_R_PC].UWord;
+}
+
+
+void Cpu_GetOpcodeInfo(Emu_Context_t * ctx, uint16_t addr, char *buffer, int *size)
+{
+    uint8_t  data = Memory_Read(ctx, addr ++);
+    Cpu_OpCode_t const * opcode = &Cpu_OpCode[data];
+
+    /* Handle CB prefix */
+    if(data == 0xCB)
+    {
+        data = Memory_Read(ctx, addr ++);
+        opcode = &Cpu_OpCode_Prefix[data];
+    }
+
+    /* Set opcode size */
+    *size = opcode->Size;
+
+    /* Genererate opcode string */
+    uint8_t ubyte0, ubyte1;
+    int8_t sbyte;
+
+    /* @todo implement a way to retrieve string */
+    switch(opcode->NameParam)
+    {
+        case CPU_P_UWORD:
+            ubyte0 = Memory_Read(ctx, addr ++);
+            ubyte1 = Memory_Read(ctx, addr ++);
+            sprintf(buffer, opcode->Name, CONCAT(ubyte0, ubyte1));
+            break;
+        case CPU_P_UBYTE:
+            ubyte0 = Memory_Read(ctx, addr ++);
+            sprintf(buffer, opcode->Name, ubyte0);
+            break;
+        case CPU_P_SBYTE:
+            sbyte = Memory_Read(ctx, addr ++);
+            sprintf(buffer, opcode->Name, sbyte);
+            break;
+        default:
+            /* No parameter CPU_P_NONE */
+            sprintf(buffer, opcode->Name);
+    }
+}
+
+
+/******************************************************/
+/* Misc/Control Command                               */
+/******************************************************/
+
+/**
+ * OpCode: UNKNOWN (illegal OpCode, lock the hardware CPU)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_ILLEGAL(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    Cpu_SyncFlag(ctx);
+    DEBUGGER_INFO("CPU Register:\n");
+    DEBUGGER_INFO("#AF: 0x%04x\n", CPU_REG16(ctx, CPU_R_AF)->UWord);
+    DEBUGGER_INFO("#BC: 0x%04x\n", CPU_REG16(ctx, CPU_R_BC)->UWord);
+    DEBUGGER_INFO("#DE: 0x%04x\n", CPU_REG16(ctx, CPU_R_DE)->UWord);
+    DEBUGGER_INFO("#HL: 0x%04x\n", CPU_REG16(ctx, CPU_R_HL)->UWord);
+    DEBUGGER_INFO("#SP: 0x%04x\n", CPU_REG16(ctx, CPU_R_SP)->UWord);
+    DEBUGGER_INFO("#PC: 0x%04x\n", CPU_REG16(ctx, CPU_R_PC)->UWord);
+    DEBUGGER_INFO("Illegal Opcode 0x%02x\n", param0);
+
+    /* The hardware stop fetching instruction for good: halt with no wake up */
+    ctx->Cpu.Locked = true;
+    ctx->Cpu.Halted = true;
+    ctx->Cpu.Ime = false;
+    ctx->Cpu.ImeDelay = false;
+    Interrupt_Update(ctx);
+    return false;
+}
+
+
+/**
+ * OpCode: NOP
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_NOP(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) ctx;
+    (void) param0;
+    (void) param1;
+
+    /* Do nothing */
+    return false;
+}
+
+
+/**
+ * OpCode: STOP
+ * ZNHC Flag:----
+ * @note Low power mode is not emulated: the OpCode and its padding Byte are skipped
+ */
+static inline bool Cpu_Execute_STOP(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) ctx;
+    (void) param0;
+    (void) param1;
+
+    return false;
+}
+
+
+/**
+ * OpCode: HALT
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_HALT(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Stop until an enabled interrupt is requested */
+    if(Interrupt_GetPending(ctx) == 0)
+    {
+        ctx->Cpu.Halted = true;
+        Interrupt_Update(ctx);
+    }
+
+    return false;
+}
+
+
+/**
+ * OpCode: DI
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_DI(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    ctx->Cpu.Ime = false;
+    ctx->Cpu.ImeDelay = false;
+    Interrupt_Update(ctx);
+
+    return false;
+}
+
+
+/**
+ * OpCode: EI
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_EI(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* IME is set after the next instruction */
+    if(!ctx->Cpu.Ime)
+    {
+        ctx->Cpu.ImeDelay = true;
+        Interrupt_Update(ctx);
+    }
+
+    return false;
+}
+
+
+/**
+ * OpCode: PREFIX CB
+ * @note The decoder resolve the OpCode in Cpu_OpCode_Prefix, this entry is never executed
+ */
+static inline bool Cpu_Execute_PREFIX_CB(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) ctx;
+    (void) param0;
+    (void) param1;
+
+    assert(0);
+    return false;
+}
+
+
+/**
+ * OpCode: DAA
+ * ZNHC Flag:Z-0C
+ */
+static inline bool Cpu_Execute_DAA(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Execute the command */
+    uint8_t const flag = Cpu_GetFlag(ctx);
+    uint8_t data = CPU_REG8(ctx, CPU_R_A)->UByte;
+    uint8_t carry = flag & CPU_F_C;
+    if((flag & CPU_F_N) == CPU_F_NO)
+    {
+        /* Adjust after an addition */
+        if((carry != CPU_F_NO) || (data > 0x99))
+        {
+            data += 0x60;
+            carry = CPU_F_C;
+        }
+        if(((flag & CPU_F_H) != CPU_F_NO) || ((data & 0x0F) > 0x09))
+        {
+            data += 0x06;
+        }
+    }
+    else
+    {
+        /* Adjust after a substraction */
+        if(carry != CPU_F_NO)
+        {
+            data -= 0x60;
+        }
+        if((flag & CPU_F_H) != CPU_F_NO)
+        {
+            data -= 0x06;
+        }
+    }
+    CPU_REG8(ctx, CPU_R_A)->UByte = data;
+
+    /* Set up Flag */
+    Cpu_WriteFlag(ctx, ((data == 0x00) ? CPU_F_Z : CPU_F_NO) | (flag & CPU_F_N) | carry);
+
+    return false;
+}
+
+
+/**
+ * OpCode: CPL
+ * ZNHC Flag:-11-
+ */
+static inline bool Cpu_Execute_CPL(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Execute the command */
+    CPU_REG8(ctx, CPU_R_A)->UByte = ~CPU_REG8(ctx, CPU_R_A)->UByte;
+
+    /* Set up Flag */
+    Cpu_WriteFlag(ctx, Cpu_GetFlag(ctx) | CPU_F_N | CPU_F_H);
+
+    return false;
+}
+
+
+/**
+ * OpCode: SCF
+ * ZNHC Flag:-001
+ */
+static inline bool Cpu_Execute_SCF(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Set up Flag */
+    Cpu_WriteFlag(ctx, (Cpu_GetFlag(ctx) & CPU_F_Z) | CPU_F_C);
+
+    return false;
+}
+
+
+/**
+ * OpCode: CCF
+ * ZNHC Flag:-00C
+ */
+static inline bool Cpu_Execute_CCF(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Set up Flag */
+    uint8_t const flag = Cpu_GetFlag(ctx);
+    Cpu_WriteFlag(ctx, (flag & CPU_F_Z) | ((flag & CPU_F_C) ^ CPU_F_C));
+
+    return false;
+}
+
+
+/******************************************************/
+/* Jump/Call Command                                  */
+/******************************************************/
+
+/**
+ * OpCode: JR F,N
+ * ZNHC Flag:----
+ * @return true if the jump is taken
+ */
+static inline bool Cpu_Execute_JR_F_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Get instruction */
+    int8_t const data = ctx->Cpu.Operand.Byte[0].SByte;
+
+    /* Execute the command */
+    if(CPU_FLAG_CHECK(ctx, param0, param1))
+    {
+        CPU_REG16(ctx, CPU_R_PC)->UWord += data;
+        return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * OpCode: JP F,NN
+ * ZNHC Flag:----
+ * @return true if the jump is taken
+ */
+static inline bool Cpu_Execute_JP_F_NN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Get instruction */
+    uint16_t const addr = ctx->Cpu.Operand.UWord;
+
+    /* Execute the command */
+    if(CPU_FLAG_CHECK(ctx, param0, param1))
+    {
+        CPU_REG16(ctx, CPU_R_PC)->UWord = addr;
+        return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * OpCode: JP (RR)
+ * ZNHC Flag:----
+ * @return true (the jump is always taken)
+ */
+static inline bool Cpu_Execute_JP_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Execute the command */
+    CPU_REG16(ctx, CPU_R_PC)->UWord = CPU_REG16(ctx, param0)->UWord;
+
+    return true;
+}
+
+
+/**
+ * OpCode: CALL F,NN
+ * ZNHC Flag:----
+ * @return true if the call is taken
+ */
+static inline bool Cpu_Execute_CALL_F_NN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Get instruction */
+    uint16_t const addr = ctx->Cpu.Operand.UWord;
+
+    /* Execute the command */
+    if(CPU_FLAG_CHECK(ctx, param0, param1))
+    {
+        Cpu_Push(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord);
+        CPU_REG16(ctx, CPU_R_PC)->UWord = addr;
+        return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * OpCode: RET F
+ * ZNHC Flag:----
+ * @return true if the return is taken
+ */
+static inline bool Cpu_Execute_RET_F(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    if(CPU_FLAG_CHECK(ctx, param0, param1))
+    {
+        CPU_REG16(ctx, CPU_R_PC)->UWord = Cpu_Pop(ctx);
+        return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * OpCode: RETI
+ * ZNHC Flag:----
+ * @return true (the return is always taken)
+ */
+static inline bool Cpu_Execute_RETI(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Execute the command */
+    CPU_REG16(ctx, CPU_R_PC)->UWord = Cpu_Pop(ctx);
+    ctx->Cpu.Ime = true;
+    ctx->Cpu.ImeDelay = false;
+    Interrupt_Update(ctx);
+
+    return true;
+}
+
+
+/**
+ * OpCode: RST N
+ * ZNHC Flag:----
+ * @return true (the call is always taken)
+ */
+static inline bool Cpu_Execute_RST_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Execute the command */
+    Cpu_Push(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord);
+    CPU_REG16(ctx, CPU_R_PC)->UWord = param0;
+
+    return true;
+}
+
+
+/******************************************************/
+/* 8 bit Load/Move/Store Command                      */
+/******************************************************/
+
+/**
+ * OpCode: LD R,R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_R_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    CPU_REG8(ctx, param0)->UByte = data;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,N
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_R_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
+
+    /* Execute the command */
+    CPU_REG8(ctx, param0)->UByte = data;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,(RR)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_R_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint16_t const addr = CPU_REG16(ctx, param1)->UWord;
+    CPU_REG8(ctx, param0)->UByte = Memory_Read(ctx, addr);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,(0xFF00+N)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_R_pN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const addrOffset = ctx->Cpu.Operand.Byte[0].UByte;
+
+    /* Execute the command */
+    uint16_t const addr = 0xFF00 + addrOffset;
+    CPU_REG8(ctx, param0)->UByte = Memory_Read(ctx, addr);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,(0xFF00+R)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_R_pR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint16_t const addr = 0xFF00 + CPU_REG8(ctx, param1)->UByte;
+    CPU_REG8(ctx, param0)->UByte = Memory_Read(ctx, addr);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,(NN)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_R_pNN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint16_t const addr = ctx->Cpu.Operand.UWord;
+
+    /* Execute the command */
+    CPU_REG8(ctx, param0)->UByte = Memory_Read(ctx, addr);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,(RR+)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LDI_R_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint16_t const addr = CPU_REG16(ctx, param1)->UWord;
+    CPU_REG8(ctx, param0)->UByte = Memory_Read(ctx, addr);
+    CPU_REG16(ctx, param1)->UWord = addr + 1;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD R,(RR-)
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LDD_R_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint16_t const addr = CPU_REG16(ctx, param1)->UWord;
+    CPU_REG8(ctx, param0)->UByte = Memory_Read(ctx, addr);
+    CPU_REG16(ctx, param1)->UWord = addr - 1;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (RR),R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_pRR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    Memory_Write(ctx, addr, data);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (RR),N
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_pRR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
+
+    /* Execute the command */
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    Memory_Write(ctx, addr, data);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (0xFF00+N),R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_pN_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+
+    /* Get instruction */
+    uint8_t const addrOffset = ctx->Cpu.Operand.Byte[0].UByte;
+
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    uint16_t const addr = 0xFF00 + addrOffset;
+    Memory_Write(ctx, addr, data);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (0xFF00+R),R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_pR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    uint16_t const addr = 0xFF00 + CPU_REG8(ctx, param0)->UByte;
+    Memory_Write(ctx, addr, data);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (NN),R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_pNN_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param0;
+
+    /* Get instruction */
+    uint16_t const addr = ctx->Cpu.Operand.UWord;
+
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    Memory_Write(ctx, addr, data);
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (RR+),R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LDI_pRR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    Memory_Write(ctx, addr, data);
+    CPU_REG16(ctx, param0)->UWord = addr + 1;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD (RR-),R
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LDD_pRR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    Memory_Write(ctx, addr, data);
+    CPU_REG16(ctx, param0)->UWord = addr - 1;
+
+    return false;
+}
+
+
+/******************************************************/
+/* 16 bit Load/Move/Store Command                     */
+/******************************************************/
+
+/**
+ * OpCode: LD RR,NN
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_RR_NN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint16_t const data = ctx->Cpu.Operand.UWord;
+
+    /* Execute the command */
+    CPU_REG16(ctx, param0)->UWord = data;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD RR,RR
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_RR_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Execute the command */
+    CPU_REG16(ctx, param0)->UWord = CPU_REG16(ctx, param1)->UWord;
+
+    return false;
+}
+
+
+/**
+ * OpCode: LD RR,RR+N
+ * ZNHC Flag:00HC
+ */
+static inline bool Cpu_Execute_LD_RR_RRN(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
+{
+    /* Get instruction */
+    int8_t const data = ctx->Cpu.Operand.Byte[0].SByte;
+
+    /* Execute the command */
+    CPU_REG16(ctx, param0)->UWord = Cpu_AluOffset(ctx, CPU_REG16(ctx, param1)->UWord, data);
+
+    return false;
 }
 
 
-static inline uint8_t Cpu_ReadPc(void)
+/**
+ * OpCode: LD (NN),RR
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_LD_pNN_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    uint16_t const pc = CPU_REG16(CPU_R_PC)->UWord;
-    uint8_t const data = Memory_Read(pc);
-    CPU_REG16(CPU_R_PC)->UWord = pc + 1;
+    /* Unused parameter */
+    (void) param0;
 
-    return data;
+    /* Get instruction */
+    uint16_t const addr = ctx->Cpu.Operand.UWord;
+
+    /* Execute the command (little endian) */
+    uint8_t const data0 = CPU_REG16(ctx, param1)->Byte[0].UByte;
+    uint8_t const data1 = CPU_REG16(ctx, param1)->Byte[1].UByte;
+    Memory_Write(ctx, addr    , data0);
+    Memory_Write(ctx, addr + 1, data1);
+
+    return false;
 }
 
 
-void Cpu_GetOpcodeInfo(uint16_t addr, char *buffer, int *size)
+/**
+ * OpCode: PUSH RR
+ * ZNHC Flag:----
+ */
+static inline bool Cpu_Execute_PUSH_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    uint8_t  data = Memory_Read(addr ++);
-    Cpu_OpCode_t const * opcode = &Cpu_OpCode[data];
+    /* Unused parameter */
+    (void) param1;
 
-    /* Handle CB prefix */
-    if(data == 0xCB)
+    /* F register is pushed with AF */
+    if(param0 == CPU_R_AF)
     {
-        data = Memory_Read(addr ++);
-        opcode = &Cpu_OpCode_Prefix[data];
+        Cpu_SyncFlag(ctx);
     }
 
-    /* Set opcode size */
-    *size = opcode->Size;
-
-    /* Genererate opcode string */
-    uint8_t ubyte0, ubyte1;
-    int8_t sbyte;
+    /* Execute the command */
+    Cpu_Push(ctx, CPU_REG16(ctx, param0)->UWord);
 
-    /* @todo implement a way to retrieve string */
-    switch(opcode->NameParam)
-    {
-        case CPU_P_UWORD:
-            ubyte0 = Memory_Read(addr ++);
-            ubyte1 = Memory_Read(addr ++);
-            sprintf(buffer, opcode->Name, CONCAT(ubyte0, ubyte1));
-            break;
-        case CPU_P_UBYTE:
-            ubyte0 = Memory_Read(addr ++);
-            sprintf(buffer, opcode->Name, ubyte0);
-            break;
-        case CPU_P_SBYTE:
-            sbyte = Memory_Read(addr ++);
-            sprintf(buffer, opcode->Name, sbyte);
-            break;
-        default:
-            /* No parameter CPU_P_NONE */
-            sprintf(buffer, opcode->Name);
-    }
+    return false;
 }
 
 
 /**
- * OpCode: XXXXXX
- * Size:X, Duration:X, ZNHC Flag:XXXX
- * @todo Delete this function when all opcode implemented
+ * OpCode: POP RR
+ * ZNHC Flag:---- (ZNHC for POP AF)
  */
-static int Cpu_Execute_Unimplemented(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_POP_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    DEBUGGER_INFO("CPU Register:\n");
-    DEBUGGER_INFO("#AF: 0x%04x\n", CPU_REG16(CPU_R_AF)->UWord);
-    DEBUGGER_INFO("#BC: 0x%04x\n", CPU_REG16(CPU_R_BC)->UWord);
-    DEBUGGER_INFO("#DE: 0x%04x\n", CPU_REG16(CPU_R_DE)->UWord);
-    DEBUGGER_INFO("#HL: 0x%04x\n", CPU_REG16(CPU_R_HL)->UWord);
-    DEBUGGER_INFO("#SP: 0x%04x\n", CPU_REG16(CPU_R_SP)->UWord);
-    DEBUGGER_INFO("#PC: 0x%04x\n", CPU_REG16(CPU_R_PC)->UWord);
-    DEBUGGER_INFO("Unimplemented Opcode 0x%02x: %s\n", opcode->Value, opcode->Name);
-    assert(0);
-    return 0;
+    /* Unused parameter */
+    (void) param1;
+
+    /* Execute the command */
+    CPU_REG16(ctx, param0)->UWord = Cpu_Pop(ctx);
+
+    /* F register is loaded with AF: only the flag bit exist */
+    if(param0 == CPU_R_AF)
+    {
+        Cpu_WriteFlag(ctx, CPU_REG8(ctx, CPU_R_F)->UByte & CPU_F_ALL);
+    }
+
+    return false;
 }
 
 
 /******************************************************/
-/* Misc/Control Command                               */
+/* 8 bit Arithmetic/Logical Command                   */
 /******************************************************/
 
 /**
- * opcode: NOP
- * size:1, duration:4, znhc flag:----
+ * OpCode: INC R
+ * ZNHC Flag:Z0H-
  */
-static int Cpu_Execute_NOP(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_INC_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Do nothing */
-    return 4;
+    /* Unused parameter */
+    (void) param1;
+
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+    uint8_t const result = data + 1;
+    CPU_REG8(ctx, param0)->UByte = result;
+
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_INC, data, 0, result);
+
+    return false;
 }
 
+
 /**
- * Handle OpCode begining by 0xCB
+ * OpCode: DEC R
+ * ZNHC Flag:Z1H-
  */
-static int Cpu_Execute_PREFIX_CB(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_DEC_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Unused parameter */
-    (void) opcode;
+    (void) param1;
 
-    /* Get instruction */
-    uint8_t const data = Cpu_ReadPc();
-    Cpu_OpCode_t const * opcode_prefix = &Cpu_OpCode_Prefix[data];
+    /* Execute the command */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+    uint8_t const result = data - 1;
+    CPU_REG8(ctx, param0)->UByte = result;
 
-    /* Execute instruction */
-    return opcode_prefix->Callback(opcode_prefix);
-}
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_DEC, data, 0, result);
 
+    return false;
+}
 
-/******************************************************/
-/* Jump/Call Command                                  */
-/******************************************************/
 
 /**
- * opcode: CALL F,NN
- * size:3, duration:24/12, znhc flag:----
+ * OpCode: INC (RR)
+ * ZNHC Flag:Z0H-
  */
-static int Cpu_Execute_CALL_F_NN(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_INC_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Get instruction */
-    uint8_t const data0 = Cpu_ReadPc();
-    uint8_t const data1 = Cpu_ReadPc();
+    /* Unused parameter */
+    (void) param1;
 
     /* Execute the command */
-    uint8_t mask = opcode->Param0;
-    uint8_t compare = opcode->Param1;
-    if(CPU_FLAG_CHECK(mask, compare))
-    {
-        /* Copy PC in the Stack and update SP */
-        uint8_t const pc0 = CPU_REG16(CPU_R_PC)->Byte[0].UByte;
-        uint8_t const pc1 = CPU_REG16(CPU_R_PC)->Byte[1].UByte;
-        uint16_t const sp = CPU_REG16(CPU_R_SP)->UWord;
-        Memory_Write(sp - 1, pc1);
-        Memory_Write(sp - 2, pc0);
-        CPU_REG16(CPU_R_SP)->UWord = sp - 2;
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+    uint8_t const result = data + 1;
+    Memory_Write(ctx, addr, result);
 
-        /* Set PC to the call addr */
-        CPU_REG16(CPU_R_PC)->Byte[0].UByte = data0;
-        CPU_REG16(CPU_R_PC)->Byte[1].UByte = data1;
-        return 24;
-    }
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_INC, data, 0, result);
 
-    return 12;
+    return false;
 }
 
 
 /**
- * opcode: JR F,N
- * size:2, duration:12/8, znhc flag:----
+ * OpCode: DEC (RR)
+ * ZNHC Flag:Z1H-
  */
-static int Cpu_Execute_JR_F_N(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_DEC_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Get instruction */
-    int8_t const data = Cpu_ReadPc();
+    /* Unused parameter */
+    (void) param1;
 
     /* Execute the command */
-    uint8_t mask = opcode->Param0;
-    uint8_t compare = opcode->Param1;
-    if(CPU_FLAG_CHECK(mask, compare))
-    {
-        CPU_REG16(CPU_R_PC)->UWord += data;
-        return 12;
-    }
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+    uint8_t const result = data - 1;
+    Memory_Write(ctx, addr, result);
+
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_DEC, data, 0, result);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * opcode: RET
- * size:1, duration:16, znhc flag:----
+ * OpCode: ADD A,R / ADC A,R
+ * ZNHC Flag:Z0HC
  */
-static int Cpu_Execute_RET(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ADD_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Unused parameter */
-    (void) opcode;
+    /* Get instruction */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
 
     /* Execute the command */
-    uint16_t const sp = CPU_REG16(CPU_R_SP)->UWord;
-    uint8_t data0 = Memory_Read(sp);
-    uint8_t data1 = Memory_Read(sp + 1);
-    CPU_REG16(CPU_R_PC)->Byte[0].UByte = data0;
-    CPU_REG16(CPU_R_PC)->Byte[1].UByte = data1;
-    CPU_REG16(CPU_R_SP)->UWord = sp + 2;
+    Cpu_AluAdd(ctx, data, param1 == CPU_CARRY);
 
-    return 16;
+    return false;
 }
 
 
-/******************************************************/
-/* 8 bit Load/Move/Store Command                      */
-/******************************************************/
-
 /**
- * opcode: LD R,(RR)
- * size:1, duration:8, znhc flag:----
+ * OpCode: ADD A,(RR) / ADC A,(RR)
+ * ZNHC Flag:Z0HC
  */
-static int Cpu_Execute_LD_R_pRR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ADD_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Get instruction */
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+
     /* Execute the command */
-    uint16_t const addr = CPU_REG16(opcode->Param1)->UWord;
-    uint8_t const data = Memory_Read(addr);
-    CPU_REG8(opcode->Param0)->UByte = data;
+    Cpu_AluAdd(ctx, data, param1 == CPU_CARRY);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * opcode: LD R,R
- * size:1, duration:4, znhc flag:----
+ * OpCode: ADD A,N / ADC A,N
+ * ZNHC Flag:Z0HC
  */
-static int Cpu_Execute_LD_R_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ADD_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param0;
+
+    /* Get instruction */
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
+
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    CPU_REG8(opcode->Param0)->UByte = data;
+    Cpu_AluAdd(ctx, data, param1 == CPU_CARRY);
 
-    return 4;
+    return false;
 }
 
 
 /**
- * opcode: LD R,N
- * size:2, duration:8, znhc flag:----
+ * OpCode: SUB R / SBC A,R
+ * ZNHC Flag:Z1HC
  */
-static int Cpu_Execute_LD_R_N(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_SUB_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Get instruction */
-    uint8_t const data = Cpu_ReadPc();
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
 
     /* Execute the command */
-    CPU_REG8(opcode->Param0)->UByte = data;
+    Cpu_AluSub(ctx, data, param1 == CPU_CARRY, true);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * opcode: LD (NN),R
- * size:3, duration:16, znhc flag:----
+ * OpCode: SUB (RR) / SBC A,(RR)
+ * ZNHC Flag:Z1HC
  */
-static int Cpu_Execute_LD_pNN_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_SUB_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Get instruction */
-    uint8_t const data0 = Cpu_ReadPc();
-    uint8_t const data1 = Cpu_ReadPc();
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
 
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint16_t const addr = CONCAT(data0, data1);
-    Memory_Write(addr, data);
+    Cpu_AluSub(ctx, data, param1 == CPU_CARRY, true);
 
-    return 16;
+    return false;
 }
 
 
 /**
- * opcode: LD (0xFF00+N),R
- * size:2, duration:12, znhc flag:----
+ * OpCode: SUB N / SBC A,N
+ * ZNHC Flag:Z1HC
  */
-static int Cpu_Execute_LD_pN_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_SUB_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param0;
+
     /* Get instruction */
-    uint8_t const addrOffset = Cpu_ReadPc();
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
 
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint16_t const addr = 0xFF00 + addrOffset;
-    Memory_Write(addr, data);
+    Cpu_AluSub(ctx, data, param1 == CPU_CARRY, true);
 
-    return 12;
+    return false;
 }
 
 
 /**
- * opcode: LD (0xFF00+R),R
- * size:1, duration:8, znhc flag:----
+ * OpCode: AND R
+ * ZNHC Flag:Z010
  */
-static int Cpu_Execute_LD_pR_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_AND_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint16_t const addr = 0xFF00 + CPU_REG8(opcode->Param0)->UByte;
-    Memory_Write(addr, data);
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_AND, data, CPU_REG8(ctx, CPU_R_A)->UByte & data);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * opcode: LD (RR),R
- * size:1, duration:8, znhc flag:----
+ * OpCode: AND (RR)
+ * ZNHC Flag:Z010
  */
-static int Cpu_Execute_LD_pRR_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_AND_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint16_t const addr = CPU_REG16(opcode->Param0)->UWord;
-    Memory_Write(addr, data);
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_AND, data, CPU_REG8(ctx, CPU_R_A)->UByte & data);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * opcode: LD (RR-),R
- * size:1, duration:8, znhc flag:----
+ * OpCode: AND N
+ * ZNHC Flag:Z010
  */
-static int Cpu_Execute_LDD_pRR_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_AND_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
+
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint16_t const addr = CPU_REG16(opcode->Param0)->UWord;
-    Memory_Write(addr, data);
-    CPU_REG16(opcode->Param0)->UWord = addr - 1;
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_AND, data, CPU_REG8(ctx, CPU_R_A)->UByte & data);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * opcode: LD (RR+),R
- * size:1, duration:8, znhc flag:----
+ * OpCode: XOR R
+ * ZNHC Flag:Z000
  */
-static int Cpu_Execute_LDI_pRR_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_XOR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint16_t const addr = CPU_REG16(opcode->Param0)->UWord;
-    Memory_Write(addr, data);
-    CPU_REG16(opcode->Param0)->UWord = addr + 1;
+    /* Unused parameter */
+    (void) param1;
 
-    return 8;
-}
+    /* Get instruction */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
 
+    /* Execute the command */
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_LOGIC, data, CPU_REG8(ctx, CPU_R_A)->UByte ^ data);
 
+    return false;
+}
 
-/******************************************************/
-/* 16 bit Load/Move/Store Command                     */
-/******************************************************/
 
 /**
- * OpCode: LD RR,NN
- * Size:3, Duration:12, ZNHC Flag:----
+ * OpCode: XOR (RR)
+ * ZNHC Flag:Z000
  */
-static int Cpu_Execute_LD_RR_NN(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_XOR_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Get the opcde parameter */
-    uint8_t const data0 = Cpu_ReadPc();
-    uint8_t const data1 = Cpu_ReadPc();
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
 
     /* Execute the command */
-    CPU_REG16(opcode->Param0)->Byte[0].UByte = data0;
-    CPU_REG16(opcode->Param0)->Byte[1].UByte = data1;
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_LOGIC, data, CPU_REG8(ctx, CPU_R_A)->UByte ^ data);
 
-    return 12;
+    return false;
 }
 
 
 /**
- * OpCode: LD (NN),RR
- * Size:3, Duration:20, ZNHC Flag:----
+ * OpCode: XOR N
+ * ZNHC Flag:Z000
  */
-static int Cpu_Execute_LD_pNN_RR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_XOR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Get the opcde parameter */
-    uint8_t const addr0 = Cpu_ReadPc();
-    uint8_t const addr1 = Cpu_ReadPc();
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
 
     /* Execute the command */
-    uint16_t const addr = CONCAT(addr0, addr1);
-    uint8_t const data0 = CPU_REG16(opcode->Param1)->Byte[0].UByte;
-    uint8_t const data1 = CPU_REG16(opcode->Param1)->Byte[1].UByte;
-    Memory_Write(addr  , data1);
-    Memory_Write(addr+1, data0);
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_LOGIC, data, CPU_REG8(ctx, CPU_R_A)->UByte ^ data);
 
-    return 20;
+    return false;
 }
 
 
-
 /**
- * opcode: PUSH RR
- * size:1, duration:16, znhc flag:----
+ * OpCode: OR R
+ * ZNHC Flag:Z000
  */
-static int Cpu_Execute_PUSH_RR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_OR_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+
     /* Execute the command */
-    uint8_t const rr0 = CPU_REG16(opcode->Param0)->Byte[0].UByte;
-    uint8_t const rr1 = CPU_REG16(opcode->Param0)->Byte[1].UByte;
-    uint16_t const sp = CPU_REG16(CPU_R_SP)->UWord;
-    Memory_Write(sp - 1, rr1);
-    Memory_Write(sp - 2, rr0);
-    CPU_REG16(CPU_R_SP)->UWord = sp - 2;
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_LOGIC, data, CPU_REG8(ctx, CPU_R_A)->UByte | data);
 
-    return 16;
+    return false;
 }
 
 
 /**
- * opcode: POP RR
- * size:1, duration:12, znhc flag:----
+ * OpCode: OR (RR)
+ * ZNHC Flag:Z000
  */
-static int Cpu_Execute_POP_RR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_OR_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param1;
+
+    /* Get instruction */
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+
     /* Execute the command */
-    uint16_t const sp = CPU_REG16(CPU_R_SP)->UWord;
-    uint8_t data0 = Memory_Read(sp);
-    uint8_t data1 = Memory_Read(sp + 1);
-    CPU_REG16(opcode->Param0)->Byte[0].UByte = data0;
-    CPU_REG16(opcode->Param0)->Byte[1].UByte = data1;
-    CPU_REG16(CPU_R_SP)->UWord = sp + 2;
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_LOGIC, data, CPU_REG8(ctx, CPU_R_A)->UByte | data);
 
-    return 12;
+    return false;
 }
 
 
-/******************************************************/
-/* 8 bit Arithmetic/Logical Command                   */
-/******************************************************/
-
 /**
- * OpCode: INC R
- * Size:1, Duration:4, ZNHC Flag:Z0H-
+ * OpCode: OR N
+ * ZNHC Flag:Z000
  */
-static int Cpu_Execute_INC_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_OR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param0)->UByte;
-    uint8_t const result = data + 1;
-    CPU_REG8(opcode->Param0)->UByte = result;
+    /* Unused parameter */
+    (void) param0;
+    (void) param1;
 
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_Z | CPU_F_N | CPU_F_H);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
-    if((data & 0x0F) == 0x0F)
-    {
-        CPU_FLAG_SET(CPU_F_H);
-    }
+    /* Get instruction */
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
+
+    /* Execute the command */
+    Cpu_AluLogic(ctx, CPU_FLAG_OP_LOGIC, data, CPU_REG8(ctx, CPU_R_A)->UByte | data);
 
-    return 4;
+    return false;
 }
 
 
 /**
- * OpCode: DEC R
- * Size:1, Duration:4, ZNHC Flag:Z1H-
+ * OpCode: CP R
+ * ZNHC Flag:Z1HC
  */
-static int Cpu_Execute_DEC_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_CP_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param0)->UByte;
-    uint8_t const result = data - 1;
-    CPU_REG8(opcode->Param0)->UByte = result;
+    /* Unused parameter */
+    (void) param1;
 
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_Z | CPU_F_H);
-    CPU_FLAG_SET(CPU_F_N);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
-    if((data & 0x0F) == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_H);
-    }
+    /* Get instruction */
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+
+    /* Execute the command */
+    Cpu_AluSub(ctx, data, false, false);
 
-    return 4;
+    return false;
 }
 
 
 /**
- * OpCode: XOR R
- * Size:1, Duration:4, ZNHC Flag:Z000
+ * OpCode: CP (RR)
+ * ZNHC Flag:Z1HC
  */
-static int Cpu_Execute_XOR_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_CP_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Execute the command */
-    uint8_t const dataA = CPU_REG8(CPU_R_A)->UByte;
-    uint8_t const dataR = CPU_REG8(opcode->Param0)->UByte;
-    uint8_t const result = dataA ^ dataR;
-    CPU_REG8(CPU_R_A)->UByte = result;
+    /* Unused parameter */
+    (void) param1;
 
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_ALL);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
+    /* Get instruction */
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
 
-    return 4;
+    /* Execute the command */
+    Cpu_AluSub(ctx, data, false, false);
+
+    return false;
 }
 
 
 /**
  * OpCode: CP N
- * Size:2, Duration:8, ZNHC Flag:Z1HC
+ * ZNHC Flag:Z1HC
  */
-static int Cpu_Execute_CP_N(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_CP_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Unused parameter */
-    (void) opcode;
+    (void) param0;
+    (void) param1;
 
     /* Get instruction */
-    uint8_t const data = Cpu_ReadPc();
+    uint8_t const data = ctx->Cpu.Operand.Byte[0].UByte;
 
     /* Execute the command */
-    uint8_t const dataA = CPU_REG8(CPU_R_A)->UByte;
-    uint8_t const result = dataA - data;
-
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_Z | CPU_F_H | CPU_F_C);
-    CPU_FLAG_SET(CPU_F_N);
-    if(result == 0)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
-    if((data & 0x0F) > (dataA & 0x0F))
-    {
-        CPU_FLAG_SET(CPU_F_H);
-    }
-    if(data > dataA)
-    {
-        CPU_FLAG_SET(CPU_F_C);
-    }
+    Cpu_AluSub(ctx, data, false, false);
 
-    return 8;
+    return false;
 }
 
 
@@ -1255,280 +3176,239 @@ static int Cpu_Execute_CP_N(Cpu_OpCode_t const * const opcode)
 
 /**
  * OpCode: INC RR
- * Size:1, Duration:8, ZNHC Flag:----
+ * ZNHC Flag:----
  */
-static int Cpu_Execute_INC_RR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_INC_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param1;
+
     /* Execute the command */
-    uint16_t const data = CPU_REG16(opcode->Param0)->UWord;
+    uint16_t const data = CPU_REG16(ctx, param0)->UWord;
     uint16_t const result = data + 1;
-    CPU_REG16(opcode->Param0)->UWord = result;
+    CPU_REG16(ctx, param0)->UWord = result;
 
-    return 8;
+    return false;
 }
 
 
 /**
  * OpCode: DEC RR
- * Size:1, Duration:8, ZNHC Flag:----
+ * ZNHC Flag:----
  */
-static int Cpu_Execute_DEC_RR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_DEC_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
+    /* Unused parameter */
+    (void) param1;
+
     /* Execute the command */
-    uint16_t const data = CPU_REG16(opcode->Param0)->UWord;
+    uint16_t const data = CPU_REG16(ctx, param0)->UWord;
     uint16_t const result = data - 1;
-    CPU_REG16(opcode->Param0)->UWord = result;
+    CPU_REG16(ctx, param0)->UWord = result;
 
-    return 8;
+    return false;
 }
 
 
 /**
  * OpCode: ADD RR,RR
- * Size:1, Duration:8, ZNHC Flag:-0HC
+ * ZNHC Flag:-0HC
  */
-static int Cpu_Execute_ADD_RR_RR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ADD_RR_RR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint16_t const data0 = CPU_REG16(opcode->Param0)->UWord;
-    uint16_t const data1 = CPU_REG16(opcode->Param1)->UWord;
+    uint16_t const data0 = CPU_REG16(ctx, param0)->UWord;
+    uint16_t const data1 = CPU_REG16(ctx, param1)->UWord;
     uint16_t const result = data0 + data1;
-    CPU_REG16(opcode->Param0)->UWord = result;
+    CPU_REG16(ctx, param0)->UWord = result;
 
     /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_N | CPU_F_H | CPU_F_C);
-    if(((data0 & 0x0F) + (data1 & 0x0F)) > 0x0F)
-    {
-        CPU_FLAG_SET(CPU_F_H);
-    }
-    if(((uint32_t)data0 + (uint32_t)data1) > 0x00FF)
-    {
-        CPU_FLAG_SET(CPU_F_C);
-    }
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_ADD16, data0, data1, result);
 
-    return 8;
+    return false;
 }
 
 
-/******************************************************/
-/* 8 bit Rotation/Shift/Bit Command                   */
-/******************************************************/
-
 /**
- * OpCode: BIT N,R
- * Size:2, Duration:8, ZNHC Flag:Z01-
+ * OpCode: ADD RR,N
+ * ZNHC Flag:00HC
  */
-static int Cpu_Execute_BIT_N_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ADD_RR_N(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Execute the command */
-    uint8_t const mask = opcode->Param0;
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint8_t const result = data & mask;
+    /* Unused parameter */
+    (void) param1;
 
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_Z | CPU_F_N);
-    CPU_FLAG_SET(CPU_F_H);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
+    /* Get instruction */
+    int8_t const data = ctx->Cpu.Operand.Byte[0].SByte;
+
+    /* Execute the command */
+    CPU_REG16(ctx, param0)->UWord = Cpu_AluOffset(ctx, CPU_REG16(ctx, param0)->UWord, data);
 
-    return 8;
+    return false;
 }
 
 
+/******************************************************/
+/* 8 bit Rotation/Shift/Bit Command                   */
+/******************************************************/
+
 /**
- * OpCode: BIT N,(RR)
- * Size:2, Duration:16, ZNHC Flag:Z01-
+ * OpCode: RLCA / RRCA / RLA / RRA
+ * ZNHC Flag:000C
  */
-static int Cpu_Execute_BIT_N_pRR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ROTA(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint8_t const mask = opcode->Param0;
-    uint16_t const addr = CPU_REG16(opcode->Param1)->UWord;
-    uint8_t const data = Memory_Read(addr);
-    uint8_t const result = data & mask;
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+    uint16_t const result = Cpu_AluRotate(ctx, param1, data);
+    CPU_REG8(ctx, param0)->UByte = (uint8_t)result;
 
     /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_Z | CPU_F_N);
-    CPU_FLAG_SET(CPU_F_H);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_ROTA, data, 0, result);
 
-    return 16;
+    return false;
 }
 
 
 /**
- * OpCode: SET N,R
- * Size:2, Duration:8, ZNHC Flag:----
+ * OpCode: RLC R / RRC R / RL R / RR R / SLA R / SRA R / SWAP R / SRL R
+ * ZNHC Flag:Z00C
  */
-static int Cpu_Execute_SET_N_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ROT_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint8_t const mask = opcode->Param0;
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint8_t const result = data | mask;
-    CPU_REG8(opcode->Param1)->UByte = result;
+    uint8_t const data = CPU_REG8(ctx, param0)->UByte;
+    uint16_t const result = Cpu_AluRotate(ctx, param1, data);
+    CPU_REG8(ctx, param0)->UByte = (uint8_t)result;
+
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_ROT, data, 0, result);
 
-    return 8;
+    return false;
 }
 
 
 /**
- * OpCode: SET N,pRR
- * Size:2, Duration:16, ZNHC Flag:----
+ * OpCode: RLC (RR) / RRC (RR) / RL (RR) / RR (RR) / SLA (RR) / SRA (RR) / SWAP (RR) / SRL (RR)
+ * ZNHC Flag:Z00C
  */
-static int Cpu_Execute_SET_N_pRR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_ROT_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint8_t const mask = opcode->Param0;
-    uint16_t const addr = CPU_REG16(opcode->Param1)->UWord;
-    uint8_t const data = Memory_Read(addr);
-    uint8_t const result = data | mask;
-    Memory_Write(addr, result);
+    uint16_t const addr = CPU_REG16(ctx, param0)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+    uint16_t const result = Cpu_AluRotate(ctx, param1, data);
+    Memory_Write(ctx, addr, (uint8_t)result);
+
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_ROT, data, 0, result);
 
-    return 16;
+    return false;
 }
 
 
 /**
- * OpCode: RES N,R
- * Size:2, Duration:8, ZNHC Flag:----
+ * OpCode: BIT N,R
+ * ZNHC Flag:Z01-
  */
-static int Cpu_Execute_RES_N_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_BIT_N_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint8_t const mask = opcode->Param0;
-    uint8_t const data = CPU_REG8(opcode->Param1)->UByte;
-    uint8_t const result = data & ~mask;
-    CPU_REG8(opcode->Param1)->UByte = result;
+    uint8_t const mask = param0;
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    uint8_t const result = data & mask;
 
-    return 8;
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_BIT, data, mask, result);
+
+    return false;
 }
 
 
 /**
- * OpCode: RES N,pRR
- * Size:2, Duration:16, ZNHC Flag:----
+ * OpCode: BIT N,(RR)
+ * ZNHC Flag:Z01-
  */
-static int Cpu_Execute_RES_N_pRR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_BIT_N_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint8_t const mask = opcode->Param0;
-    uint16_t const addr = CPU_REG16(opcode->Param1)->UWord;
-    uint8_t const data = Memory_Read(addr);
-    uint8_t const result = data & ~mask;
-    Memory_Write(addr, result);
+    uint8_t const mask = param0;
+    uint16_t const addr = CPU_REG16(ctx, param1)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+    uint8_t const result = data & mask;
 
-    return 16;
+    /* Set up Flag */
+    Cpu_SetFlag(ctx, CPU_FLAG_OP_BIT, data, mask, result);
+
+    return false;
 }
 
 
 /**
- * OpCode: RLA
- * Size:1, Duration:4, ZNHC Flag:000C
+ * OpCode: SET N,R
+ * ZNHC Flag:----
  */
-static int Cpu_Execute_RLA(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_SET_N_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Unused parameter */
-    (void) opcode;
-
     /* Execute the command */
-    uint8_t const data = CPU_REG8(CPU_R_A)->UByte;
-    uint8_t const carry = CPU_FLAG_CHECK(CPU_F_C, CPU_F_C) ? 0x01 : 0x00;
-    uint8_t const result = (data << 1) | carry;
-    CPU_REG8(CPU_R_A)->UByte = result;
-
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_ALL);
-    if((data & 0x80) == 0x80)
-    {
-        CPU_FLAG_SET(CPU_F_C);
-    }
+    uint8_t const mask = param0;
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    CPU_REG8(ctx, param1)->UByte = data | mask;
 
-    return 4;
+    return false;
 }
 
 
 /**
- * OpCode: RLCA
- * Size:1, Duration:4, ZNHC Flag:000C
+ * OpCode: SET N,(RR)
+ * ZNHC Flag:----
  */
-static int Cpu_Execute_RLCA(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_SET_N_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
-    /* Unused parameter */
-    (void) opcode;
-
     /* Execute the command */
-    uint8_t const data = CPU_REG8(CPU_R_A)->UByte;
-    uint8_t const result = (data << 1) | (data >> 7);
-    CPU_REG8(CPU_R_A)->UByte = result;
-
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_ALL);
-    if((data & 0x80) == 0x80)
-    {
-        CPU_FLAG_SET(CPU_F_C);
-    }
+    uint8_t const mask = param0;
+    uint16_t const addr = CPU_REG16(ctx, param1)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+    Memory_Write(ctx, addr, data | mask);
 
-    return 4;
+    return false;
 }
 
 
 /**
- * OpCode: RL R
- * Size:2, Duration:8, ZNHC Flag:Z00C
+ * OpCode: RES N,R
+ * ZNHC Flag:----
  */
-static int Cpu_Execute_RL_R(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_RES_N_R(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint8_t const data = CPU_REG8(opcode->Param0)->UByte;
-    uint8_t const carry = CPU_FLAG_CHECK(CPU_F_C, CPU_F_C) ? 0x01 : 0x00;
-    uint8_t const result = (data << 1) | carry;
-    CPU_REG8(opcode->Param0)->UByte = result;
+    uint8_t const mask = param0;
+    uint8_t const data = CPU_REG8(ctx, param1)->UByte;
+    CPU_REG8(ctx, param1)->UByte = data & ~mask;
 
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_ALL);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
-    if((data & 0x80) == 0x80)
-    {
-        CPU_FLAG_SET(CPU_F_C);
-    }
-
-    return 8;
+    return false;
 }
 
 
 /**
- * OpCode: RL pRR
- * Size:2, Duration:16, ZNHC Flag:Z00C
+ * OpCode: RES N,(RR)
+ * ZNHC Flag:----
  */
-static int Cpu_Execute_RL_pRR(Cpu_OpCode_t const * const opcode)
+static inline bool Cpu_Execute_RES_N_pRR(Emu_Context_t * ctx, uint32_t param0, uint32_t param1)
 {
     /* Execute the command */
-    uint16_t const addr = CPU_REG16(opcode->Param0)->UWord;
-    uint8_t const data = Memory_Read(addr);
-    uint8_t const carry = CPU_FLAG_CHECK(CPU_F_C, CPU_F_C) ? 0x01 : 0x00;
-    uint8_t const result = (data << 1) | carry;
-    Memory_Write(addr, result);
-
-    /* Set up Flag */
-    CPU_FLAG_CLEAR(CPU_F_ALL);
-    if(result == 0x00)
-    {
-        CPU_FLAG_SET(CPU_F_Z);
-    }
-    if((data & 0x80) == 0x80)
-    {
-        CPU_FLAG_SET(CPU_F_C);
-    }
+    uint8_t const mask = param0;
+    uint16_t const addr = CPU_REG16(ctx, param1)->UWord;
+    uint8_t const data = Memory_Read(ctx, addr);
+    Memory_Write(ctx, addr, data & ~mask);
 
-    return 16;
+    return false;
 }
 
+
+/******************************************************/
+/* OpCode Callback                                    */
+/******************************************************/
+
+CPU_OPCODE_MAIN(CPU_OPCODE_CALLBACK_M)
+CPU_OPCODE_PREFIX(CPU_OPCODE_CALLBACK_P)
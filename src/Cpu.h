@@ -29,6 +29,7 @@
 /* Include                                            */
 /******************************************************/
 
+#include <stdbool.h>
 #include <stdint.h>
 
 
@@ -38,15 +39,29 @@
 
 /**
  * Get CPU internal 16 bit register pointer
+ * @param ctx The emulator context
  * @param reg The 16 bit register Cpu_RegName_e id
  */
-#define CPU_REG16(reg)  (&Cpu_Info.Reg[reg])
+#define CPU_REG16(ctx, reg) (&(ctx)->Cpu.Reg[reg])
 
 /**
  * Get CPU internal 8 bit register pointer
+ * @param ctx The emulator context
  * @param reg The 8 bit register Cpu_RegName_e id
  */
-#define CPU_REG8(reg)   (&Cpu_Info.Reg[(reg) / 2].Byte[(reg) % 2])
+#define CPU_REG8(ctx, reg)  (&(ctx)->Cpu.Reg[(reg) / 2].Byte[(reg) % 2])
+
+/** Number of instruction dispatch index (0x100 + value for CB prefix) */
+#define CPU_INDEX_NUM   0x200
+
+/** Interrupt check word: debugger stop request (interrupt source use the lower bit) */
+#define CPU_IRQ_BREAK       0x20
+
+/** Interrupt check word: HALT state */
+#define CPU_IRQ_HALT        0x40
+
+/** Interrupt check word: IME set after the next instruction (EI) */
+#define CPU_IRQ_EI          0x80
 
 
 /******************************************************/
@@ -87,6 +102,23 @@ typedef enum tagCpu_FlagName_e
     CPU_F_ALL = 0xF0    /**< All flag (Zero, Substract, Half Carry, Carry) bitmap */
 } Cpu_FlagName_e;
 
+/** Kind of the last flag producing operation (lazy flag evaluation) */
+typedef enum tagCpu_FlagOp_e
+{
+    CPU_FLAG_OP_NONE = 0,   /**< F register is up to date */
+    CPU_FLAG_OP_INC,        /**< 8 bit increment (Z0H-) */
+    CPU_FLAG_OP_DEC,        /**< 8 bit decrement (Z1H-) */
+    CPU_FLAG_OP_ADD,        /**< 8 bit addition with or without carry (Z0HC) */
+    CPU_FLAG_OP_SUB,        /**< 8 bit substraction/comparison with or without carry (Z1HC) */
+    CPU_FLAG_OP_AND,        /**< 8 bit AND (Z010) */
+    CPU_FLAG_OP_LOGIC,      /**< 8 bit XOR/OR (Z000) */
+    CPU_FLAG_OP_BIT,        /**< Bit test (Z01-) */
+    CPU_FLAG_OP_ADD16,      /**< 16 bit addition (-0HC) */
+    CPU_FLAG_OP_ROT,        /**< 8 bit rotation/shift, carry out in result bit 8 (Z00C) */
+    CPU_FLAG_OP_ROTA,       /**< Accumulator rotation, carry out in result bit 8 (000C) */
+    CPU_FLAG_OP_NUM         /**< Number of flag operation */
+} Cpu_FlagOp_e;
+
 /** All purpose 8 bit register type */
 typedef union tagCpu_Reg8_t
 {
@@ -102,12 +134,41 @@ typedef union tagCpu_Reg16_t
     Cpu_Reg8_t Byte[2];   /**< 8 bit access */
 } Cpu_Reg16_t;
 
+/** Operand of the last flag producing operation */
+typedef struct tagCpu_Flag_t
+{
+    uint16_t Data0;     /**< First operand */
+    uint16_t Data1;     /**< Second operand */
+    uint16_t Result;    /**< Operation raw result (carry/borrow out in bit 8) */
+    uint8_t  Op;        /**< Cpu_FlagOp_e operation */
+} Cpu_Flag_t;
+
+/** CPU decoded instruction and translated block cache (private) */
+typedef struct tagCpu_Cache_t Cpu_Cache_t;
+
 /** CPU Info */
 typedef struct tagCpu_Info_t
 {
     Cpu_Reg16_t Reg[CPU_REG_NUM];   /**< Internal Register */
+    Cpu_Reg16_t Operand;            /**< Immediate operand of the executing instruction */
+    Cpu_Flag_t Flag;                /**< Pending flag evaluation (F register is stale unless CPU_FLAG_OP_NONE) */
+    uint8_t Irq;                    /**< Interrupt check word (IME & IE & IF, CPU_IRQ_*), 0 on the fast path */
+    uint64_t Cycle;                 /**< Number of cycle executed since initialization */
+    uint64_t IdleCycle;             /**< Number of cycle fast-forwarded (HALT and idle loop) */
+    uint64_t End;                   /**< Cycle Cpu_Run stop at (lowered by an earlier event scheduled meanwhile) */
+    bool Halted;                    /**< Waiting for an interrupt request (HALT) */
+    bool Locked;                    /**< Hung by an illegal opcode, only a reset recover (Halted is set) */
+    bool Ime;                       /**< Interrupt master enable (EI/DI/RETI) */
+    bool ImeDelay;                  /**< IME is set after the next instruction (EI) */
+    bool VolatileRead;              /**< A value derived from the cycle counter was read */
+    bool Break;                     /**< Cpu_Run stopped before a breakpoint, Cpu_Run or Cpu_Step stopped on request */
+    bool BreakRequest;              /**< Stop after the current instruction (watchpoint) */
+    Cpu_Cache_t * Cache;            /**< Instruction cache */
 } Cpu_Info_t;
 
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
 
 /******************************************************/
 /* Prototype                                          */
@@ -115,47 +176,161 @@ typedef struct tagCpu_Info_t
 
 /**
  * Initialize CPU
+ * @param ctx The emulator context
+ * @return 0 if successful, otherwise -1
  */
-extern void Cpu_Initialize(void);
+extern int Cpu_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Release CPU resource
+ * @param ctx The emulator context
+ */
+extern void Cpu_Finalize(Emu_Context_t * ctx);
 
 /**
  * Process 1 CPU instruction
+ * @param ctx The emulator context
  * @return The number of cycle used for the instruction
  */
-extern uint32_t Cpu_Step(void);
+extern uint32_t Cpu_Step(Emu_Context_t * ctx);
+
+/**
+ * Process CPU instruction until a cycle budget is consumed
+ * @param ctx The emulator context
+ * @param cycles The number of cycle to execute
+ * @return The number of cycle used
+ * @note Instruction are executed by translated block, the last one is fully
+ *       executed so the budget can be exceeded
+ * @note Stop early at an event scheduled during the run (Cpu.End)
+ * @note Stop before a block starting on a breakpoint and set Break, even as
+ *       the first block (use Cpu_Step to leave a breakpoint)
+ */
+extern uint32_t Cpu_Run(Emu_Context_t * ctx, uint32_t cycles);
+
+/**
+ * Execute a decoded instruction
+ * @param ctx The emulator context
+ * @param index The instruction dispatch index (0x100 + value for CB prefix)
+ * @param operand The instruction immediate operand
+ * @return The number of cycle used for the instruction
+ * @note PC must already point to the next instruction
+ */
+extern uint32_t Cpu_Interpret(Emu_Context_t * ctx, uint16_t index, uint16_t operand);
+
+/**
+ * Invalidate the decoded instruction overlapping an address
+ * @param ctx The emulator context
+ * @param addr The modified address
+ */
+extern void Cpu_InvalidateCache(Emu_Context_t * ctx, uint16_t addr);
+
+/**
+ * Invalidate the decoded instruction of an address range (e.g. bank switch)
+ * @param ctx The emulator context
+ * @param addr The first remapped address
+ * @param size The remapped range size
+ */
+extern void Cpu_InvalidateRange(Emu_Context_t * ctx, uint16_t addr, uint32_t size);
+
+/**
+ * Report a read whose value depends on the current cycle (not on a scheduled event)
+ * @param ctx The emulator context
+ * @note The loop doing the read will not be fast-forwarded to the next event
+ */
+extern void Cpu_NotifyVolatileRead(Emu_Context_t * ctx);
+
+/**
+ * Set or remove a breakpoint
+ * @param ctx The emulator context
+ * @param addr The instruction address
+ * @param enable true to set, false to remove
+ * @note A breakpoint always start a translated block, Cpu_Run only check the block
+ */
+extern void Cpu_SetBreakpoint(Emu_Context_t * ctx, uint16_t addr, bool enable);
+
+/**
+ * Remove every breakpoint
+ * @param ctx The emulator context
+ * @note The whole cache is flushed
+ */
+extern void Cpu_ClearBreakpoint(Emu_Context_t * ctx);
+
+/**
+ * Stop Cpu_Run after the current instruction (set Break)
+ * @param ctx The emulator context
+ * @note The running block is invalidated to leave it right after the instruction
+ */
+extern void Cpu_RequestBreak(Emu_Context_t * ctx);
+
+/**
+ * Check if an address has a breakpoint
+ * @param ctx The emulator context
+ * @param addr The instruction address
+ * @return true if a breakpoint is set
+ */
+extern bool Cpu_IsBreakpoint(Emu_Context_t const * ctx, uint16_t addr);
+
+/**
+ * Invalidate all decoded instruction
+ * @param ctx The emulator context
+ */
+extern void Cpu_FlushCache(Emu_Context_t * ctx);
+
+#if defined(CPU_DYNAREC)
+/**
+ * Compare the native translation of every instruction (after a flag setting one) with the interpreter
+ * @param ctx The emulator context
+ * @param count The number of random CPU state per instruction
+ * @param mismatch Set to true for each CPU_INDEX_NUM dispatch index giving a different state
+ * @return The number of mismatching index, -1 if the native code buffer is not available
+ * @note The CPU state, work RAM and high RAM are modified
+ */
+extern int Cpu_CheckDynarec(Emu_Context_t * ctx, uint32_t count, bool mismatch[CPU_INDEX_NUM]);
+#endif
+
+/**
+ * Evaluate the pending flag operation into the F register
+ * @param ctx The emulator context
+ * @note Required before reading AF from the register file
+ */
+extern void Cpu_SyncFlag(Emu_Context_t * ctx);
+
+/**
+ * Evaluate the 8 bit ALU flag of every operand pair (microbenchmark)
+ * @param ctx The emulator context
+ * @param count The number of pass over the operand pair
+ * @param table true to use the flag table, false for the per-flag set/clear code
+ * @return The checksum of the result and flag (identical for both method)
+ * @note A and F register are modified
+ */
+extern uint32_t Cpu_BenchAlu(Emu_Context_t * ctx, uint32_t count, bool table);
 
 /**
  * Get PC register
+ * @param ctx The emulator context
  * @return CPU PC register
  */
-inline uint16_t Cpu_GetProgramCounter(void);
+extern uint16_t Cpu_GetProgramCounter(Emu_Context_t const * ctx);
 
 /**
  * Get instruction opcode string and byte length
+ * @param ctx The emulator context
  * @param addr The opcode address
  * @param buffer The string buffer address
  * @param size The size pointer
  */
-extern void Cpu_GetOpcodeInfo(uint16_t addr, char *buffer, int *size);
+extern void Cpu_GetOpcodeInfo(Emu_Context_t * ctx, uint16_t addr, char *buffer, int *size);
 
 
 /******************************************************/
 /* Variable                                           */
 /******************************************************/
 
-/** CPU Info */
-extern Cpu_Info_t Cpu_Info;
-
 
 /******************************************************/
 /* Function                                           */
 /******************************************************/
 
-inline uint16_t Cpu_GetProgramCounter(void)
-{
-    return CPU_REG16(CPU_R_PC)->UWord;
-}
-
 
 #endif /* _CPU_H_ */
 
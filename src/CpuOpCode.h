@@ -0,0 +1,694 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _CPU_OPCODE_H_
+#define _CPU_OPCODE_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/*
+ * OpCode description, private to Cpu.c
+ *
+ * The OpCode table, the disassembly string, the cycle duration and the
+ * specialized execution callback are all expanded from the list below so
+ * they cannot drift apart. Each entry is:
+ *
+ *     X(value, size, cycle, taken, name, nameParam, execute, param0, param1)
+ *
+ * value     OpCode value (second Byte for the CB prefix list)
+ * size      OpCode Byte size (CB prefix included)
+ * cycle     Duration (conditional jump not taken)
+ * taken     Duration of a taken conditional jump (cycle otherwise)
+ * name      Disassembly format string
+ * nameParam Cpu_NameParam_t type of the disassembly parameter
+ * execute   Handler suffix: Cpu_Execute_<execute>() is inlined with constant
+ *           param0/param1 and the handler attribute is CPU_ATTR_<execute>
+ * param0    First handler parameter
+ * param1    Second handler parameter
+ */
+
+/**
+ * Attribute of each OpCode handler (Cpu_Attr_e bitmap)
+ */
+/* Misc/Control Command */
+#define CPU_ATTR_ILLEGAL          CPU_A_END
+#define CPU_ATTR_NOP              CPU_A_IDLE
+#define CPU_ATTR_STOP             CPU_A_END
+#define CPU_ATTR_HALT             CPU_A_END
+#define CPU_ATTR_DI               CPU_A_END
+#define CPU_ATTR_EI               CPU_A_END
+#define CPU_ATTR_PREFIX_CB        CPU_A_NONE
+#define CPU_ATTR_DAA              CPU_A_IDLE
+#define CPU_ATTR_CPL              CPU_A_IDLE
+#define CPU_ATTR_SCF              CPU_A_IDLE
+#define CPU_ATTR_CCF              CPU_A_IDLE
+
+/* Jump/Call Command */
+#define CPU_ATTR_JR_F_N           (CPU_A_END | CPU_A_JR)
+#define CPU_ATTR_JP_F_NN          CPU_A_END
+#define CPU_ATTR_JP_RR            CPU_A_END
+#define CPU_ATTR_CALL_F_NN        CPU_A_END
+#define CPU_ATTR_RET_F            CPU_A_END
+#define CPU_ATTR_RETI             CPU_A_END
+#define CPU_ATTR_RST_N            CPU_A_END
+
+/* 8 bit Load/Move/Store Command */
+#define CPU_ATTR_LD_R_R           CPU_A_IDLE
+#define CPU_ATTR_LD_R_N           CPU_A_IDLE
+#define CPU_ATTR_LD_R_pRR         CPU_A_IDLE
+#define CPU_ATTR_LD_R_pN          CPU_A_IDLE
+#define CPU_ATTR_LD_R_pR          CPU_A_IDLE
+#define CPU_ATTR_LD_R_pNN         CPU_A_IDLE
+#define CPU_ATTR_LDI_R_pRR        CPU_A_IDLE
+#define CPU_ATTR_LDD_R_pRR        CPU_A_IDLE
+#define CPU_ATTR_LD_pRR_R         CPU_A_NONE
+#define CPU_ATTR_LD_pRR_N         CPU_A_NONE
+#define CPU_ATTR_LD_pN_R          CPU_A_NONE
+#define CPU_ATTR_LD_pR_R          CPU_A_NONE
+#define CPU_ATTR_LD_pNN_R         CPU_A_NONE
+#define CPU_ATTR_LDI_pRR_R        CPU_A_NONE
+#define CPU_ATTR_LDD_pRR_R        CPU_A_NONE
+
+/* 16 bit Load/Move/Store Command */
+#define CPU_ATTR_LD_RR_NN         CPU_A_IDLE
+#define CPU_ATTR_LD_RR_RR         CPU_A_IDLE
+#define CPU_ATTR_LD_RR_RRN        CPU_A_IDLE
+#define CPU_ATTR_LD_pNN_RR        CPU_A_NONE
+#define CPU_ATTR_PUSH_RR          CPU_A_NONE
+#define CPU_ATTR_POP_RR           CPU_A_NONE
+
+/* 8 bit Arithmetic/Logical Command */
+#define CPU_ATTR_INC_R            CPU_A_IDLE
+#define CPU_ATTR_DEC_R            CPU_A_IDLE
+#define CPU_ATTR_INC_pRR          CPU_A_NONE
+#define CPU_ATTR_DEC_pRR          CPU_A_NONE
+#define CPU_ATTR_ADD_R            CPU_A_IDLE
+#define CPU_ATTR_ADD_pRR          CPU_A_IDLE
+#define CPU_ATTR_ADD_N            CPU_A_IDLE
+#define CPU_ATTR_SUB_R            CPU_A_IDLE
+#define CPU_ATTR_SUB_pRR          CPU_A_IDLE
+#define CPU_ATTR_SUB_N            CPU_A_IDLE
+#define CPU_ATTR_AND_R            CPU_A_IDLE
+#define CPU_ATTR_AND_pRR          CPU_A_IDLE
+#define CPU_ATTR_AND_N            CPU_A_IDLE
+#define CPU_ATTR_XOR_R            CPU_A_IDLE
+#define CPU_ATTR_XOR_pRR          CPU_A_IDLE
+#define CPU_ATTR_XOR_N            CPU_A_IDLE
+#define CPU_ATTR_OR_R             CPU_A_IDLE
+#define CPU_ATTR_OR_pRR           CPU_A_IDLE
+#define CPU_ATTR_OR_N             CPU_A_IDLE
+#define CPU_ATTR_CP_R             CPU_A_IDLE
+#define CPU_ATTR_CP_pRR           CPU_A_IDLE
+#define CPU_ATTR_CP_N             CPU_A_IDLE
+
+/* 16 bit Arithmetic/Logical Command */
+#define CPU_ATTR_INC_RR           CPU_A_IDLE
+#define CPU_ATTR_DEC_RR           CPU_A_IDLE
+#define CPU_ATTR_ADD_RR_RR        CPU_A_IDLE
+#define CPU_ATTR_ADD_RR_N         CPU_A_IDLE
+
+/* 8 bit Rotation/Shift/Bit Command */
+#define CPU_ATTR_ROTA             CPU_A_IDLE
+#define CPU_ATTR_ROT_R            CPU_A_IDLE
+#define CPU_ATTR_ROT_pRR          CPU_A_NONE
+#define CPU_ATTR_BIT_N_R          CPU_A_IDLE
+#define CPU_ATTR_BIT_N_pRR        CPU_A_IDLE
+#define CPU_ATTR_SET_N_R          CPU_A_IDLE
+#define CPU_ATTR_SET_N_pRR        CPU_A_NONE
+#define CPU_ATTR_RES_N_R          CPU_A_IDLE
+#define CPU_ATTR_RES_N_pRR        CPU_A_NONE
+
+/**
+ * Main OpCode list
+ * @param X The entry expansion macro
+ */
+#define CPU_OPCODE_MAIN(X) \
+    X(0x00, 1,  4,  4, "NOP",              CPU_P_NONE,  NOP,       CPU_NULL, CPU_NULL) \
+    X(0x01, 3, 12, 12, "LD BC,0x%04x",     CPU_P_UWORD, LD_RR_NN,  CPU_R_BC, CPU_NULL) \
+    X(0x02, 1,  8,  8, "LD (BC),A",        CPU_P_NONE,  LD_pRR_R,  CPU_R_BC, CPU_R_A) \
+    X(0x03, 1,  8,  8, "INC BC",           CPU_P_NONE,  INC_RR,    CPU_R_BC, CPU_NULL) \
+    X(0x04, 1,  4,  4, "INC B",            CPU_P_NONE,  INC_R,     CPU_R_B,  CPU_NULL) \
+    X(0x05, 1,  4,  4, "DEC B",            CPU_P_NONE,  DEC_R,     CPU_R_B,  CPU_NULL) \
+    X(0x06, 2,  8,  8, "LD B,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_B,  CPU_NULL) \
+    X(0x07, 1,  4,  4, "RLCA",             CPU_P_NONE,  ROTA,      CPU_R_A,  CPU_ROT_RLC) \
+    X(0x08, 3, 20, 20, "LD (0x%04x),SP",   CPU_P_UWORD, LD_pNN_RR, CPU_NULL, CPU_R_SP) \
+    X(0x09, 1,  8,  8, "ADD HL,BC",        CPU_P_NONE,  ADD_RR_RR, CPU_R_HL, CPU_R_BC) \
+    X(0x0A, 1,  8,  8, "LD A,(BC)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_A,  CPU_R_BC) \
+    X(0x0B, 1,  8,  8, "DEC BC",           CPU_P_NONE,  DEC_RR,    CPU_R_BC, CPU_NULL) \
+    X(0x0C, 1,  4,  4, "INC C",            CPU_P_NONE,  INC_R,     CPU_R_C,  CPU_NULL) \
+    X(0x0D, 1,  4,  4, "DEC C",            CPU_P_NONE,  DEC_R,     CPU_R_C,  CPU_NULL) \
+    X(0x0E, 2,  8,  8, "LD C,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_C,  CPU_NULL) \
+    X(0x0F, 1,  4,  4, "RRCA",             CPU_P_NONE,  ROTA,      CPU_R_A,  CPU_ROT_RRC) \
+    X(0x10, 2,  4,  4, "STOP",             CPU_P_NONE,  STOP,      CPU_NULL, CPU_NULL) \
+    X(0x11, 3, 12, 12, "LD DE,0x%04x",     CPU_P_UWORD, LD_RR_NN,  CPU_R_DE, CPU_NULL) \
+    X(0x12, 1,  8,  8, "LD (DE),A",        CPU_P_NONE,  LD_pRR_R,  CPU_R_DE, CPU_R_A) \
+    X(0x13, 1,  8,  8, "INC DE",           CPU_P_NONE,  INC_RR,    CPU_R_DE, CPU_NULL) \
+    X(0x14, 1,  4,  4, "INC D",            CPU_P_NONE,  INC_R,     CPU_R_D,  CPU_NULL) \
+    X(0x15, 1,  4,  4, "DEC D",            CPU_P_NONE,  DEC_R,     CPU_R_D,  CPU_NULL) \
+    X(0x16, 2,  8,  8, "LD D,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_D,  CPU_NULL) \
+    X(0x17, 1,  4,  4, "RLA",              CPU_P_NONE,  ROTA,      CPU_R_A,  CPU_ROT_RL) \
+    X(0x18, 2, 12, 12, "JR %d",            CPU_P_SBYTE, JR_F_N,    CPU_F_NO, CPU_F_NO) \
+    X(0x19, 1,  8,  8, "ADD HL,DE",        CPU_P_NONE,  ADD_RR_RR, CPU_R_HL, CPU_R_DE) \
+    X(0x1A, 1,  8,  8, "LD A,(DE)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_A,  CPU_R_DE) \
+    X(0x1B, 1,  8,  8, "DEC DE",           CPU_P_NONE,  DEC_RR,    CPU_R_DE, CPU_NULL) \
+    X(0x1C, 1,  4,  4, "INC E",            CPU_P_NONE,  INC_R,     CPU_R_E,  CPU_NULL) \
+    X(0x1D, 1,  4,  4, "DEC E",            CPU_P_NONE,  DEC_R,     CPU_R_E,  CPU_NULL) \
+    X(0x1E, 2,  8,  8, "LD E,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_E,  CPU_NULL) \
+    X(0x1F, 1,  4,  4, "RRA",              CPU_P_NONE,  ROTA,      CPU_R_A,  CPU_ROT_RR) \
+    X(0x20, 2,  8, 12, "JR NZ,%d",         CPU_P_SBYTE, JR_F_N,    CPU_F_Z,  CPU_F_NO) \
+    X(0x21, 3, 12, 12, "LD HL,0x%04x",     CPU_P_UWORD, LD_RR_NN,  CPU_R_HL, CPU_NULL) \
+    X(0x22, 1,  8,  8, "LD (HL+),A",       CPU_P_NONE,  LDI_pRR_R, CPU_R_HL, CPU_R_A) \
+    X(0x23, 1,  8,  8, "INC HL",           CPU_P_NONE,  INC_RR,    CPU_R_HL, CPU_NULL) \
+    X(0x24, 1,  4,  4, "INC H",            CPU_P_NONE,  INC_R,     CPU_R_H,  CPU_NULL) \
+    X(0x25, 1,  4,  4, "DEC H",            CPU_P_NONE,  DEC_R,     CPU_R_H,  CPU_NULL) \
+    X(0x26, 2,  8,  8, "LD H,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_H,  CPU_NULL) \
+    X(0x27, 1,  4,  4, "DAA",              CPU_P_NONE,  DAA,       CPU_NULL, CPU_NULL) \
+    X(0x28, 2,  8, 12, "JR Z,%d",          CPU_P_SBYTE, JR_F_N,    CPU_F_Z,  CPU_F_Z) \
+    X(0x29, 1,  8,  8, "ADD HL,HL",        CPU_P_NONE,  ADD_RR_RR, CPU_R_HL, CPU_R_HL) \
+    X(0x2A, 1,  8,  8, "LD A,(HL+)",       CPU_P_NONE,  LDI_R_pRR, CPU_R_A,  CPU_R_HL) \
+    X(0x2B, 1,  8,  8, "DEC HL",           CPU_P_NONE,  DEC_RR,    CPU_R_HL, CPU_NULL) \
+    X(0x2C, 1,  4,  4, "INC L",            CPU_P_NONE,  INC_R,     CPU_R_L,  CPU_NULL) \
+    X(0x2D, 1,  4,  4, "DEC L",            CPU_P_NONE,  DEC_R,     CPU_R_L,  CPU_NULL) \
+    X(0x2E, 2,  8,  8, "LD L,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_L,  CPU_NULL) \
+    X(0x2F, 1,  4,  4, "CPL",              CPU_P_NONE,  CPL,       CPU_NULL, CPU_NULL) \
+    X(0x30, 2,  8, 12, "JR NC,%d",         CPU_P_SBYTE, JR_F_N,    CPU_F_C,  CPU_F_NO) \
+    X(0x31, 3, 12, 12, "LD SP,0x%04x",     CPU_P_UWORD, LD_RR_NN,  CPU_R_SP, CPU_NULL) \
+    X(0x32, 1,  8,  8, "LD (HL-),A",       CPU_P_NONE,  LDD_pRR_R, CPU_R_HL, CPU_R_A) \
+    X(0x33, 1,  8,  8, "INC SP",           CPU_P_NONE,  INC_RR,    CPU_R_SP, CPU_NULL) \
+    X(0x34, 1, 12, 12, "INC (HL)",         CPU_P_NONE,  INC_pRR,   CPU_R_HL, CPU_NULL) \
+    X(0x35, 1, 12, 12, "DEC (HL)",         CPU_P_NONE,  DEC_pRR,   CPU_R_HL, CPU_NULL) \
+    X(0x36, 2, 12, 12, "LD (HL),0x%02x",   CPU_P_UBYTE, LD_pRR_N,  CPU_R_HL, CPU_NULL) \
+    X(0x37, 1,  4,  4, "SCF",              CPU_P_NONE,  SCF,       CPU_NULL, CPU_NULL) \
+    X(0x38, 2,  8, 12, "JR C,%d",          CPU_P_SBYTE, JR_F_N,    CPU_F_C,  CPU_F_C) \
+    X(0x39, 1,  8,  8, "ADD HL,SP",        CPU_P_NONE,  ADD_RR_RR, CPU_R_HL, CPU_R_SP) \
+    X(0x3A, 1,  8,  8, "LD A,(HL-)",       CPU_P_NONE,  LDD_R_pRR, CPU_R_A,  CPU_R_HL) \
+    X(0x3B, 1,  8,  8, "DEC SP",           CPU_P_NONE,  DEC_RR,    CPU_R_SP, CPU_NULL) \
+    X(0x3C, 1,  4,  4, "INC A",            CPU_P_NONE,  INC_R,     CPU_R_A,  CPU_NULL) \
+    X(0x3D, 1,  4,  4, "DEC A",            CPU_P_NONE,  DEC_R,     CPU_R_A,  CPU_NULL) \
+    X(0x3E, 2,  8,  8, "LD A,0x%02x",      CPU_P_UBYTE, LD_R_N,    CPU_R_A,  CPU_NULL) \
+    X(0x3F, 1,  4,  4, "CCF",              CPU_P_NONE,  CCF,       CPU_NULL, CPU_NULL) \
+    X(0x40, 1,  4,  4, "LD B,B",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_B) \
+    X(0x41, 1,  4,  4, "LD B,C",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_C) \
+    X(0x42, 1,  4,  4, "LD B,D",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_D) \
+    X(0x43, 1,  4,  4, "LD B,E",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_E) \
+    X(0x44, 1,  4,  4, "LD B,H",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_H) \
+    X(0x45, 1,  4,  4, "LD B,L",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_L) \
+    X(0x46, 1,  8,  8, "LD B,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_B,  CPU_R_HL) \
+    X(0x47, 1,  4,  4, "LD B,A",           CPU_P_NONE,  LD_R_R,    CPU_R_B,  CPU_R_A) \
+    X(0x48, 1,  4,  4, "LD C,B",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_B) \
+    X(0x49, 1,  4,  4, "LD C,C",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_C) \
+    X(0x4A, 1,  4,  4, "LD C,D",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_D) \
+    X(0x4B, 1,  4,  4, "LD C,E",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_E) \
+    X(0x4C, 1,  4,  4, "LD C,H",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_H) \
+    X(0x4D, 1,  4,  4, "LD C,L",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_L) \
+    X(0x4E, 1,  8,  8, "LD C,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_C,  CPU_R_HL) \
+    X(0x4F, 1,  4,  4, "LD C,A",           CPU_P_NONE,  LD_R_R,    CPU_R_C,  CPU_R_A) \
+    X(0x50, 1,  4,  4, "LD D,B",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_B) \
+    X(0x51, 1,  4,  4, "LD D,C",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_C) \
+    X(0x52, 1,  4,  4, "LD D,D",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_D) \
+    X(0x53, 1,  4,  4, "LD D,E",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_E) \
+    X(0x54, 1,  4,  4, "LD D,H",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_H) \
+    X(0x55, 1,  4,  4, "LD D,L",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_L) \
+    X(0x56, 1,  8,  8, "LD D,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_D,  CPU_R_HL) \
+    X(0x57, 1,  4,  4, "LD D,A",           CPU_P_NONE,  LD_R_R,    CPU_R_D,  CPU_R_A) \
+    X(0x58, 1,  4,  4, "LD E,B",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_B) \
+    X(0x59, 1,  4,  4, "LD E,C",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_C) \
+    X(0x5A, 1,  4,  4, "LD E,D",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_D) \
+    X(0x5B, 1,  4,  4, "LD E,E",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_E) \
+    X(0x5C, 1,  4,  4, "LD E,H",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_H) \
+    X(0x5D, 1,  4,  4, "LD E,L",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_L) \
+    X(0x5E, 1,  8,  8, "LD E,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_E,  CPU_R_HL) \
+    X(0x5F, 1,  4,  4, "LD E,A",           CPU_P_NONE,  LD_R_R,    CPU_R_E,  CPU_R_A) \
+    X(0x60, 1,  4,  4, "LD H,B",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_B) \
+    X(0x61, 1,  4,  4, "LD H,C",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_C) \
+    X(0x62, 1,  4,  4, "LD H,D",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_D) \
+    X(0x63, 1,  4,  4, "LD H,E",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_E) \
+    X(0x64, 1,  4,  4, "LD H,H",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_H) \
+    X(0x65, 1,  4,  4, "LD H,L",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_L) \
+    X(0x66, 1,  8,  8, "LD H,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_H,  CPU_R_HL) \
+    X(0x67, 1,  4,  4, "LD H,A",           CPU_P_NONE,  LD_R_R,    CPU_R_H,  CPU_R_A) \
+    X(0x68, 1,  4,  4, "LD L,B",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_B) \
+    X(0x69, 1,  4,  4, "LD L,C",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_C) \
+    X(0x6A, 1,  4,  4, "LD L,D",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_D) \
+    X(0x6B, 1,  4,  4, "LD L,E",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_E) \
+    X(0x6C, 1,  4,  4, "LD L,H",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_H) \
+    X(0x6D, 1,  4,  4, "LD L,L",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_L) \
+    X(0x6E, 1,  8,  8, "LD L,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_L,  CPU_R_HL) \
+    X(0x6F, 1,  4,  4, "LD L,A",           CPU_P_NONE,  LD_R_R,    CPU_R_L,  CPU_R_A) \
+    X(0x70, 1,  8,  8, "LD (HL),B",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_B) \
+    X(0x71, 1,  8,  8, "LD (HL),C",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_C) \
+    X(0x72, 1,  8,  8, "LD (HL),D",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_D) \
+    X(0x73, 1,  8,  8, "LD (HL),E",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_E) \
+    X(0x74, 1,  8,  8, "LD (HL),H",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_H) \
+    X(0x75, 1,  8,  8, "LD (HL),L",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_L) \
+    X(0x76, 1,  4,  4, "HALT",             CPU_P_NONE,  HALT,      CPU_NULL, CPU_NULL) \
+    X(0x77, 1,  8,  8, "LD (HL),A",        CPU_P_NONE,  LD_pRR_R,  CPU_R_HL, CPU_R_A) \
+    X(0x78, 1,  4,  4, "LD A,B",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_B) \
+    X(0x79, 1,  4,  4, "LD A,C",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_C) \
+    X(0x7A, 1,  4,  4, "LD A,D",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_D) \
+    X(0x7B, 1,  4,  4, "LD A,E",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_E) \
+    X(0x7C, 1,  4,  4, "LD A,H",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_H) \
+    X(0x7D, 1,  4,  4, "LD A,L",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_L) \
+    X(0x7E, 1,  8,  8, "LD A,(HL)",        CPU_P_NONE,  LD_R_pRR,  CPU_R_A,  CPU_R_HL) \
+    X(0x7F, 1,  4,  4, "LD A,A",           CPU_P_NONE,  LD_R_R,    CPU_R_A,  CPU_R_A) \
+    X(0x80, 1,  4,  4, "ADD A,B",          CPU_P_NONE,  ADD_R,     CPU_R_B,  CPU_NULL) \
+    X(0x81, 1,  4,  4, "ADD A,C",          CPU_P_NONE,  ADD_R,     CPU_R_C,  CPU_NULL) \
+    X(0x82, 1,  4,  4, "ADD A,D",          CPU_P_NONE,  ADD_R,     CPU_R_D,  CPU_NULL) \
+    X(0x83, 1,  4,  4, "ADD A,E",          CPU_P_NONE,  ADD_R,     CPU_R_E,  CPU_NULL) \
+    X(0x84, 1,  4,  4, "ADD A,H",          CPU_P_NONE,  ADD_R,     CPU_R_H,  CPU_NULL) \
+    X(0x85, 1,  4,  4, "ADD A,L",          CPU_P_NONE,  ADD_R,     CPU_R_L,  CPU_NULL) \
+    X(0x86, 1,  8,  8, "ADD A,(HL)",       CPU_P_NONE,  ADD_pRR,   CPU_R_HL, CPU_NULL) \
+    X(0x87, 1,  4,  4, "ADD A,A",          CPU_P_NONE,  ADD_R,     CPU_R_A,  CPU_NULL) \
+    X(0x88, 1,  4,  4, "ADC A,B",          CPU_P_NONE,  ADD_R,     CPU_R_B,  CPU_CARRY) \
+    X(0x89, 1,  4,  4, "ADC A,C",          CPU_P_NONE,  ADD_R,     CPU_R_C,  CPU_CARRY) \
+    X(0x8A, 1,  4,  4, "ADC A,D",          CPU_P_NONE,  ADD_R,     CPU_R_D,  CPU_CARRY) \
+    X(0x8B, 1,  4,  4, "ADC A,E",          CPU_P_NONE,  ADD_R,     CPU_R_E,  CPU_CARRY) \
+    X(0x8C, 1,  4,  4, "ADC A,H",          CPU_P_NONE,  ADD_R,     CPU_R_H,  CPU_CARRY) \
+    X(0x8D, 1,  4,  4, "ADC A,L",          CPU_P_NONE,  ADD_R,     CPU_R_L,  CPU_CARRY) \
+    X(0x8E, 1,  8,  8, "ADC A,(HL)",       CPU_P_NONE,  ADD_pRR,   CPU_R_HL, CPU_CARRY) \
+    X(0x8F, 1,  4,  4, "ADC A,A",          CPU_P_NONE,  ADD_R,     CPU_R_A,  CPU_CARRY) \
+    X(0x90, 1,  4,  4, "SUB B",            CPU_P_NONE,  SUB_R,     CPU_R_B,  CPU_NULL) \
+    X(0x91, 1,  4,  4, "SUB C",            CPU_P_NONE,  SUB_R,     CPU_R_C,  CPU_NULL) \
+    X(0x92, 1,  4,  4, "SUB D",            CPU_P_NONE,  SUB_R,     CPU_R_D,  CPU_NULL) \
+    X(0x93, 1,  4,  4, "SUB E",            CPU_P_NONE,  SUB_R,     CPU_R_E,  CPU_NULL) \
+    X(0x94, 1,  4,  4, "SUB H",            CPU_P_NONE,  SUB_R,     CPU_R_H,  CPU_NULL) \
+    X(0x95, 1,  4,  4, "SUB L",            CPU_P_NONE,  SUB_R,     CPU_R_L,  CPU_NULL) \
+    X(0x96, 1,  8,  8, "SUB (HL)",         CPU_P_NONE,  SUB_pRR,   CPU_R_HL, CPU_NULL) \
+    X(0x97, 1,  4,  4, "SUB A",            CPU_P_NONE,  SUB_R,     CPU_R_A,  CPU_NULL) \
+    X(0x98, 1,  4,  4, "SBC A,B",          CPU_P_NONE,  SUB_R,     CPU_R_B,  CPU_CARRY) \
+    X(0x99, 1,  4,  4, "SBC A,C",          CPU_P_NONE,  SUB_R,     CPU_R_C,  CPU_CARRY) \
+    X(0x9A, 1,  4,  4, "SBC A,D",          CPU_P_NONE,  SUB_R,     CPU_R_D,  CPU_CARRY) \
+    X(0x9B, 1,  4,  4, "SBC A,E",          CPU_P_NONE,  SUB_R,     CPU_R_E,  CPU_CARRY) \
+    X(0x9C, 1,  4,  4, "SBC A,H",          CPU_P_NONE,  SUB_R,     CPU_R_H,  CPU_CARRY) \
+    X(0x9D, 1,  4,  4, "SBC A,L",          CPU_P_NONE,  SUB_R,     CPU_R_L,  CPU_CARRY) \
+    X(0x9E, 1,  8,  8, "SBC A,(HL)",       CPU_P_NONE,  SUB_pRR,   CPU_R_HL, CPU_CARRY) \
+    X(0x9F, 1,  4,  4, "SBC A,A",          CPU_P_NONE,  SUB_R,     CPU_R_A,  CPU_CARRY) \
+    X(0xA0, 1,  4,  4, "AND B",            CPU_P_NONE,  AND_R,     CPU_R_B,  CPU_NULL) \
+    X(0xA1, 1,  4,  4, "AND C",            CPU_P_NONE,  AND_R,     CPU_R_C,  CPU_NULL) \
+    X(0xA2, 1,  4,  4, "AND D",            CPU_P_NONE,  AND_R,     CPU_R_D,  CPU_NULL) \
+    X(0xA3, 1,  4,  4, "AND E",            CPU_P_NONE,  AND_R,     CPU_R_E,  CPU_NULL) \
+    X(0xA4, 1,  4,  4, "AND H",            CPU_P_NONE,  AND_R,     CPU_R_H,  CPU_NULL) \
+    X(0xA5, 1,  4,  4, "AND L",            CPU_P_NONE,  AND_R,     CPU_R_L,  CPU_NULL) \
+    X(0xA6, 1,  8,  8, "AND (HL)",         CPU_P_NONE,  AND_pRR,   CPU_R_HL, CPU_NULL) \
+    X(0xA7, 1,  4,  4, "AND A",            CPU_P_NONE,  AND_R,     CPU_R_A,  CPU_NULL) \
+    X(0xA8, 1,  4,  4, "XOR B",            CPU_P_NONE,  XOR_R,     CPU_R_B,  CPU_NULL) \
+    X(0xA9, 1,  4,  4, "XOR C",            CPU_P_NONE,  XOR_R,     CPU_R_C,  CPU_NULL) \
+    X(0xAA, 1,  4,  4, "XOR D",            CPU_P_NONE,  XOR_R,     CPU_R_D,  CPU_NULL) \
+    X(0xAB, 1,  4,  4, "XOR E",            CPU_P_NONE,  XOR_R,     CPU_R_E,  CPU_NULL) \
+    X(0xAC, 1,  4,  4, "XOR H",            CPU_P_NONE,  XOR_R,     CPU_R_H,  CPU_NULL) \
+    X(0xAD, 1,  4,  4, "XOR L",            CPU_P_NONE,  XOR_R,     CPU_R_L,  CPU_NULL) \
+    X(0xAE, 1,  8,  8, "XOR (HL)",         CPU_P_NONE,  XOR_pRR,   CPU_R_HL, CPU_NULL) \
+    X(0xAF, 1,  4,  4, "XOR A",            CPU_P_NONE,  XOR_R,     CPU_R_A,  CPU_NULL) \
+    X(0xB0, 1,  4,  4, "OR B",             CPU_P_NONE,  OR_R,      CPU_R_B,  CPU_NULL) \
+    X(0xB1, 1,  4,  4, "OR C",             CPU_P_NONE,  OR_R,      CPU_R_C,  CPU_NULL) \
+    X(0xB2, 1,  4,  4, "OR D",             CPU_P_NONE,  OR_R,      CPU_R_D,  CPU_NULL) \
+    X(0xB3, 1,  4,  4, "OR E",             CPU_P_NONE,  OR_R,      CPU_R_E,  CPU_NULL) \
+    X(0xB4, 1,  4,  4, "OR H",             CPU_P_NONE,  OR_R,      CPU_R_H,  CPU_NULL) \
+    X(0xB5, 1,  4,  4, "OR L",             CPU_P_NONE,  OR_R,      CPU_R_L,  CPU_NULL) \
+    X(0xB6, 1,  8,  8, "OR (HL)",          CPU_P_NONE,  OR_pRR,    CPU_R_HL, CPU_NULL) \
+    X(0xB7, 1,  4,  4, "OR A",             CPU_P_NONE,  OR_R,      CPU_R_A,  CPU_NULL) \
+    X(0xB8, 1,  4,  4, "CP B",             CPU_P_NONE,  CP_R,      CPU_R_B,  CPU_NULL) \
+    X(0xB9, 1,  4,  4, "CP C",             CPU_P_NONE,  CP_R,      CPU_R_C,  CPU_NULL) \
+    X(0xBA, 1,  4,  4, "CP D",             CPU_P_NONE,  CP_R,      CPU_R_D,  CPU_NULL) \
+    X(0xBB, 1,  4,  4, "CP E",             CPU_P_NONE,  CP_R,      CPU_R_E,  CPU_NULL) \
+    X(0xBC, 1,  4,  4, "CP H",             CPU_P_NONE,  CP_R,      CPU_R_H,  CPU_NULL) \
+    X(0xBD, 1,  4,  4, "CP L",             CPU_P_NONE,  CP_R,      CPU_R_L,  CPU_NULL) \
+    X(0xBE, 1,  8,  8, "CP (HL)",          CPU_P_NONE,  CP_pRR,    CPU_R_HL, CPU_NULL) \
+    X(0xBF, 1,  4,  4, "CP A",             CPU_P_NONE,  CP_R,      CPU_R_A,  CPU_NULL) \
+    X(0xC0, 1,  8, 20, "RET NZ",           CPU_P_NONE,  RET_F,     CPU_F_Z,  CPU_F_NO) \
+    X(0xC1, 1, 12, 12, "POP BC",           CPU_P_NONE,  POP_RR,    CPU_R_BC, CPU_NULL) \
+    X(0xC2, 3, 12, 16, "JP NZ,0x%04x",     CPU_P_UWORD, JP_F_NN,   CPU_F_Z,  CPU_F_NO) \
+    X(0xC3, 3, 16, 16, "JP 0x%04x",        CPU_P_UWORD, JP_F_NN,   CPU_F_NO, CPU_F_NO) \
+    X(0xC4, 3, 12, 24, "CALL NZ,0x%04x",   CPU_P_UWORD, CALL_F_NN, CPU_F_Z,  CPU_F_NO) \
+    X(0xC5, 1, 16, 16, "PUSH BC",          CPU_P_NONE,  PUSH_RR,   CPU_R_BC, CPU_NULL) \
+    X(0xC6, 2,  8,  8, "ADD A,0x%02x",     CPU_P_UBYTE, ADD_N,     CPU_NULL, CPU_NULL) \
+    X(0xC7, 1, 16, 16, "RST 00H",          CPU_P_NONE,  RST_N,     0x00,     CPU_NULL) \
+    X(0xC8, 1,  8, 20, "RET Z",            CPU_P_NONE,  RET_F,     CPU_F_Z,  CPU_F_Z) \
+    X(0xC9, 1, 16, 16, "RET",              CPU_P_NONE,  RET_F,     CPU_F_NO, CPU_F_NO) \
+    X(0xCA, 3, 12, 16, "JP Z,0x%04x",      CPU_P_UWORD, JP_F_NN,   CPU_F_Z,  CPU_F_Z) \
+    X(0xCB, 2,  4,  4, "PREFIX CB",        CPU_P_NONE,  PREFIX_CB, CPU_NULL, CPU_NULL) \
+    X(0xCC, 3, 12, 24, "CALL Z,0x%04x",    CPU_P_UWORD, CALL_F_NN, CPU_F_Z,  CPU_F_Z) \
+    X(0xCD, 3, 24, 24, "CALL 0x%04x",      CPU_P_UWORD, CALL_F_NN, CPU_F_NO, CPU_F_NO) \
+    X(0xCE, 2,  8,  8, "ADC A,0x%02x",     CPU_P_UBYTE, ADD_N,     CPU_NULL, CPU_CARRY) \
+    X(0xCF, 1, 16, 16, "RST 08H",          CPU_P_NONE,  RST_N,     0x08,     CPU_NULL) \
+    X(0xD0, 1,  8, 20, "RET NC",           CPU_P_NONE,  RET_F,     CPU_F_C,  CPU_F_NO) \
+    X(0xD1, 1, 12, 12, "POP DE",           CPU_P_NONE,  POP_RR,    CPU_R_DE, CPU_NULL) \
+    X(0xD2, 3, 12, 16, "JP NC,0x%04x",     CPU_P_UWORD, JP_F_NN,   CPU_F_C,  CPU_F_NO) \
+    X(0xD3, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xD3,     CPU_NULL) \
+    X(0xD4, 3, 12, 24, "CALL NC,0x%04x",   CPU_P_UWORD, CALL_F_NN, CPU_F_C,  CPU_F_NO) \
+    X(0xD5, 1, 16, 16, "PUSH DE",          CPU_P_NONE,  PUSH_RR,   CPU_R_DE, CPU_NULL) \
+    X(0xD6, 2,  8,  8, "SUB 0x%02x",       CPU_P_UBYTE, SUB_N,     CPU_NULL, CPU_NULL) \
+    X(0xD7, 1, 16, 16, "RST 10H",          CPU_P_NONE,  RST_N,     0x10,     CPU_NULL) \
+    X(0xD8, 1,  8, 20, "RET C",            CPU_P_NONE,  RET_F,     CPU_F_C,  CPU_F_C) \
+    X(0xD9, 1, 16, 16, "RETI",             CPU_P_NONE,  RETI,      CPU_NULL, CPU_NULL) \
+    X(0xDA, 3, 12, 16, "JP C,0x%04x",      CPU_P_UWORD, JP_F_NN,   CPU_F_C,  CPU_F_C) \
+    X(0xDB, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xDB,     CPU_NULL) \
+    X(0xDC, 3, 12, 24, "CALL C,0x%04x",    CPU_P_UWORD, CALL_F_NN, CPU_F_C,  CPU_F_C) \
+    X(0xDD, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xDD,     CPU_NULL) \
+    X(0xDE, 2,  8,  8, "SBC A,0x%02x",     CPU_P_UBYTE, SUB_N,     CPU_NULL, CPU_CARRY) \
+    X(0xDF, 1, 16, 16, "RST 18H",          CPU_P_NONE,  RST_N,     0x18,     CPU_NULL) \
+    X(0xE0, 2, 12, 12, "LD (0xff%02x),A",  CPU_P_UBYTE, LD_pN_R,   CPU_NULL, CPU_R_A) \
+    X(0xE1, 1, 12, 12, "POP HL",           CPU_P_NONE,  POP_RR,    CPU_R_HL, CPU_NULL) \
+    X(0xE2, 1,  8,  8, "LD (0xff00+C),A",  CPU_P_NONE,  LD_pR_R,   CPU_R_C,  CPU_R_A) \
+    X(0xE3, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xE3,     CPU_NULL) \
+    X(0xE4, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xE4,     CPU_NULL) \
+    X(0xE5, 1, 16, 16, "PUSH HL",          CPU_P_NONE,  PUSH_RR,   CPU_R_HL, CPU_NULL) \
+    X(0xE6, 2,  8,  8, "AND 0x%02x",       CPU_P_UBYTE, AND_N,     CPU_NULL, CPU_NULL) \
+    X(0xE7, 1, 16, 16, "RST 20H",          CPU_P_NONE,  RST_N,     0x20,     CPU_NULL) \
+    X(0xE8, 2, 16, 16, "ADD SP,%d",        CPU_P_SBYTE, ADD_RR_N,  CPU_R_SP, CPU_NULL) \
+    X(0xE9, 1,  4,  4, "JP (HL)",          CPU_P_NONE,  JP_RR,     CPU_R_HL, CPU_NULL) \
+    X(0xEA, 3, 16, 16, "LD (0x%04x),A",    CPU_P_UWORD, LD_pNN_R,  CPU_NULL, CPU_R_A) \
+    X(0xEB, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xEB,     CPU_NULL) \
+    X(0xEC, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xEC,     CPU_NULL) \
+    X(0xED, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xED,     CPU_NULL) \
+    X(0xEE, 2,  8,  8, "XOR 0x%02x",       CPU_P_UBYTE, XOR_N,     CPU_NULL, CPU_NULL) \
+    X(0xEF, 1, 16, 16, "RST 28H",          CPU_P_NONE,  RST_N,     0x28,     CPU_NULL) \
+    X(0xF0, 2, 12, 12, "LD A,(0xff%02x)",  CPU_P_UBYTE, LD_R_pN,   CPU_R_A,  CPU_NULL) \
+    X(0xF1, 1, 12, 12, "POP AF",           CPU_P_NONE,  POP_RR,    CPU_R_AF, CPU_NULL) \
+    X(0xF2, 1,  8,  8, "LD A,(0xff00+C)",  CPU_P_NONE,  LD_R_pR,   CPU_R_A,  CPU_R_C) \
+    X(0xF3, 1,  4,  4, "DI",               CPU_P_NONE,  DI,        CPU_NULL, CPU_NULL) \
+    X(0xF4, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xF4,     CPU_NULL) \
+    X(0xF5, 1, 16, 16, "PUSH AF",          CPU_P_NONE,  PUSH_RR,   CPU_R_AF, CPU_NULL) \
+    X(0xF6, 2,  8,  8, "OR 0x%02x",        CPU_P_UBYTE, OR_N,      CPU_NULL, CPU_NULL) \
+    X(0xF7, 1, 16, 16, "RST 30H",          CPU_P_NONE,  RST_N,     0x30,     CPU_NULL) \
+    X(0xF8, 2, 12, 12, "LD HL,SP+%d",      CPU_P_SBYTE, LD_RR_RRN, CPU_R_HL, CPU_R_SP) \
+    X(0xF9, 1,  8,  8, "LD SP,HL",         CPU_P_NONE,  LD_RR_RR,  CPU_R_SP, CPU_R_HL) \
+    X(0xFA, 3, 16, 16, "LD A,(0x%04x)",    CPU_P_UWORD, LD_R_pNN,  CPU_R_A,  CPU_NULL) \
+    X(0xFB, 1,  4,  4, "EI",               CPU_P_NONE,  EI,        CPU_NULL, CPU_NULL) \
+    X(0xFC, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xFC,     CPU_NULL) \
+    X(0xFD, 1,  4,  4, "UNKNOWN",          CPU_P_NONE,  ILLEGAL,   0xFD,     CPU_NULL) \
+    X(0xFE, 2,  8,  8, "CP 0x%02x",        CPU_P_UBYTE, CP_N,      CPU_NULL, CPU_NULL) \
+    X(0xFF, 1, 16, 16, "RST 38H",          CPU_P_NONE,  RST_N,     0x38,     CPU_NULL)
+
+/**
+ * CB prefix OpCode list
+ * @param X The entry expansion macro
+ */
+#define CPU_OPCODE_PREFIX(X) \
+    X(0x00, 2,  8,  8, "RLC B",            CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_RLC) \
+    X(0x01, 2,  8,  8, "RLC C",            CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_RLC) \
+    X(0x02, 2,  8,  8, "RLC D",            CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_RLC) \
+    X(0x03, 2,  8,  8, "RLC E",            CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_RLC) \
+    X(0x04, 2,  8,  8, "RLC H",            CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_RLC) \
+    X(0x05, 2,  8,  8, "RLC L",            CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_RLC) \
+    X(0x06, 2, 16, 16, "RLC (HL)",         CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_RLC) \
+    X(0x07, 2,  8,  8, "RLC A",            CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_RLC) \
+    X(0x08, 2,  8,  8, "RRC B",            CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_RRC) \
+    X(0x09, 2,  8,  8, "RRC C",            CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_RRC) \
+    X(0x0A, 2,  8,  8, "RRC D",            CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_RRC) \
+    X(0x0B, 2,  8,  8, "RRC E",            CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_RRC) \
+    X(0x0C, 2,  8,  8, "RRC H",            CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_RRC) \
+    X(0x0D, 2,  8,  8, "RRC L",            CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_RRC) \
+    X(0x0E, 2, 16, 16, "RRC (HL)",         CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_RRC) \
+    X(0x0F, 2,  8,  8, "RRC A",            CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_RRC) \
+    X(0x10, 2,  8,  8, "RL B",             CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_RL) \
+    X(0x11, 2,  8,  8, "RL C",             CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_RL) \
+    X(0x12, 2,  8,  8, "RL D",             CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_RL) \
+    X(0x13, 2,  8,  8, "RL E",             CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_RL) \
+    X(0x14, 2,  8,  8, "RL H",             CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_RL) \
+    X(0x15, 2,  8,  8, "RL L",             CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_RL) \
+    X(0x16, 2, 16, 16, "RL (HL)",          CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_RL) \
+    X(0x17, 2,  8,  8, "RL A",             CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_RL) \
+    X(0x18, 2,  8,  8, "RR B",             CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_RR) \
+    X(0x19, 2,  8,  8, "RR C",             CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_RR) \
+    X(0x1A, 2,  8,  8, "RR D",             CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_RR) \
+    X(0x1B, 2,  8,  8, "RR E",             CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_RR) \
+    X(0x1C, 2,  8,  8, "RR H",             CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_RR) \
+    X(0x1D, 2,  8,  8, "RR L",             CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_RR) \
+    X(0x1E, 2, 16, 16, "RR (HL)",          CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_RR) \
+    X(0x1F, 2,  8,  8, "RR A",             CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_RR) \
+    X(0x20, 2,  8,  8, "SLA B",            CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_SLA) \
+    X(0x21, 2,  8,  8, "SLA C",            CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_SLA) \
+    X(0x22, 2,  8,  8, "SLA D",            CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_SLA) \
+    X(0x23, 2,  8,  8, "SLA E",            CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_SLA) \
+    X(0x24, 2,  8,  8, "SLA H",            CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_SLA) \
+    X(0x25, 2,  8,  8, "SLA L",            CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_SLA) \
+    X(0x26, 2, 16, 16, "SLA (HL)",         CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_SLA) \
+    X(0x27, 2,  8,  8, "SLA A",            CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_SLA) \
+    X(0x28, 2,  8,  8, "SRA B",            CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_SRA) \
+    X(0x29, 2,  8,  8, "SRA C",            CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_SRA) \
+    X(0x2A, 2,  8,  8, "SRA D",            CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_SRA) \
+    X(0x2B, 2,  8,  8, "SRA E",            CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_SRA) \
+    X(0x2C, 2,  8,  8, "SRA H",            CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_SRA) \
+    X(0x2D, 2,  8,  8, "SRA L",            CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_SRA) \
+    X(0x2E, 2, 16, 16, "SRA (HL)",         CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_SRA) \
+    X(0x2F, 2,  8,  8, "SRA A",            CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_SRA) \
+    X(0x30, 2,  8,  8, "SWAP B",           CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_SWAP) \
+    X(0x31, 2,  8,  8, "SWAP C",           CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_SWAP) \
+    X(0x32, 2,  8,  8, "SWAP D",           CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_SWAP) \
+    X(0x33, 2,  8,  8, "SWAP E",           CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_SWAP) \
+    X(0x34, 2,  8,  8, "SWAP H",           CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_SWAP) \
+    X(0x35, 2,  8,  8, "SWAP L",           CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_SWAP) \
+    X(0x36, 2, 16, 16, "SWAP (HL)",        CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_SWAP) \
+    X(0x37, 2,  8,  8, "SWAP A",           CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_SWAP) \
+    X(0x38, 2,  8,  8, "SRL B",            CPU_P_NONE,  ROT_R,     CPU_R_B,  CPU_ROT_SRL) \
+    X(0x39, 2,  8,  8, "SRL C",            CPU_P_NONE,  ROT_R,     CPU_R_C,  CPU_ROT_SRL) \
+    X(0x3A, 2,  8,  8, "SRL D",            CPU_P_NONE,  ROT_R,     CPU_R_D,  CPU_ROT_SRL) \
+    X(0x3B, 2,  8,  8, "SRL E",            CPU_P_NONE,  ROT_R,     CPU_R_E,  CPU_ROT_SRL) \
+    X(0x3C, 2,  8,  8, "SRL H",            CPU_P_NONE,  ROT_R,     CPU_R_H,  CPU_ROT_SRL) \
+    X(0x3D, 2,  8,  8, "SRL L",            CPU_P_NONE,  ROT_R,     CPU_R_L,  CPU_ROT_SRL) \
+    X(0x3E, 2, 16, 16, "SRL (HL)",         CPU_P_NONE,  ROT_pRR,   CPU_R_HL, CPU_ROT_SRL) \
+    X(0x3F, 2,  8,  8, "SRL A",            CPU_P_NONE,  ROT_R,     CPU_R_A,  CPU_ROT_SRL) \
+    X(0x40, 2,  8,  8, "BIT 0,B",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_B) \
+    X(0x41, 2,  8,  8, "BIT 0,C",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_C) \
+    X(0x42, 2,  8,  8, "BIT 0,D",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_D) \
+    X(0x43, 2,  8,  8, "BIT 0,E",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_E) \
+    X(0x44, 2,  8,  8, "BIT 0,H",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_H) \
+    X(0x45, 2,  8,  8, "BIT 0,L",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_L) \
+    X(0x46, 2, 12, 12, "BIT 0,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x01,     CPU_R_HL) \
+    X(0x47, 2,  8,  8, "BIT 0,A",          CPU_P_NONE,  BIT_N_R,   0x01,     CPU_R_A) \
+    X(0x48, 2,  8,  8, "BIT 1,B",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_B) \
+    X(0x49, 2,  8,  8, "BIT 1,C",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_C) \
+    X(0x4A, 2,  8,  8, "BIT 1,D",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_D) \
+    X(0x4B, 2,  8,  8, "BIT 1,E",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_E) \
+    X(0x4C, 2,  8,  8, "BIT 1,H",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_H) \
+    X(0x4D, 2,  8,  8, "BIT 1,L",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_L) \
+    X(0x4E, 2, 12, 12, "BIT 1,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x02,     CPU_R_HL) \
+    X(0x4F, 2,  8,  8, "BIT 1,A",          CPU_P_NONE,  BIT_N_R,   0x02,     CPU_R_A) \
+    X(0x50, 2,  8,  8, "BIT 2,B",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_B) \
+    X(0x51, 2,  8,  8, "BIT 2,C",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_C) \
+    X(0x52, 2,  8,  8, "BIT 2,D",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_D) \
+    X(0x53, 2,  8,  8, "BIT 2,E",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_E) \
+    X(0x54, 2,  8,  8, "BIT 2,H",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_H) \
+    X(0x55, 2,  8,  8, "BIT 2,L",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_L) \
+    X(0x56, 2, 12, 12, "BIT 2,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x04,     CPU_R_HL) \
+    X(0x57, 2,  8,  8, "BIT 2,A",          CPU_P_NONE,  BIT_N_R,   0x04,     CPU_R_A) \
+    X(0x58, 2,  8,  8, "BIT 3,B",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_B) \
+    X(0x59, 2,  8,  8, "BIT 3,C",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_C) \
+    X(0x5A, 2,  8,  8, "BIT 3,D",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_D) \
+    X(0x5B, 2,  8,  8, "BIT 3,E",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_E) \
+    X(0x5C, 2,  8,  8, "BIT 3,H",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_H) \
+    X(0x5D, 2,  8,  8, "BIT 3,L",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_L) \
+    X(0x5E, 2, 12, 12, "BIT 3,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x08,     CPU_R_HL) \
+    X(0x5F, 2,  8,  8, "BIT 3,A",          CPU_P_NONE,  BIT_N_R,   0x08,     CPU_R_A) \
+    X(0x60, 2,  8,  8, "BIT 4,B",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_B) \
+    X(0x61, 2,  8,  8, "BIT 4,C",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_C) \
+    X(0x62, 2,  8,  8, "BIT 4,D",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_D) \
+    X(0x63, 2,  8,  8, "BIT 4,E",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_E) \
+    X(0x64, 2,  8,  8, "BIT 4,H",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_H) \
+    X(0x65, 2,  8,  8, "BIT 4,L",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_L) \
+    X(0x66, 2, 12, 12, "BIT 4,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x10,     CPU_R_HL) \
+    X(0x67, 2,  8,  8, "BIT 4,A",          CPU_P_NONE,  BIT_N_R,   0x10,     CPU_R_A) \
+    X(0x68, 2,  8,  8, "BIT 5,B",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_B) \
+    X(0x69, 2,  8,  8, "BIT 5,C",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_C) \
+    X(0x6A, 2,  8,  8, "BIT 5,D",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_D) \
+    X(0x6B, 2,  8,  8, "BIT 5,E",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_E) \
+    X(0x6C, 2,  8,  8, "BIT 5,H",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_H) \
+    X(0x6D, 2,  8,  8, "BIT 5,L",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_L) \
+    X(0x6E, 2, 12, 12, "BIT 5,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x20,     CPU_R_HL) \
+    X(0x6F, 2,  8,  8, "BIT 5,A",          CPU_P_NONE,  BIT_N_R,   0x20,     CPU_R_A) \
+    X(0x70, 2,  8,  8, "BIT 6,B",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_B) \
+    X(0x71, 2,  8,  8, "BIT 6,C",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_C) \
+    X(0x72, 2,  8,  8, "BIT 6,D",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_D) \
+    X(0x73, 2,  8,  8, "BIT 6,E",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_E) \
+    X(0x74, 2,  8,  8, "BIT 6,H",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_H) \
+    X(0x75, 2,  8,  8, "BIT 6,L",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_L) \
+    X(0x76, 2, 12, 12, "BIT 6,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x40,     CPU_R_HL) \
+    X(0x77, 2,  8,  8, "BIT 6,A",          CPU_P_NONE,  BIT_N_R,   0x40,     CPU_R_A) \
+    X(0x78, 2,  8,  8, "BIT 7,B",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_B) \
+    X(0x79, 2,  8,  8, "BIT 7,C",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_C) \
+    X(0x7A, 2,  8,  8, "BIT 7,D",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_D) \
+    X(0x7B, 2,  8,  8, "BIT 7,E",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_E) \
+    X(0x7C, 2,  8,  8, "BIT 7,H",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_H) \
+    X(0x7D, 2,  8,  8, "BIT 7,L",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_L) \
+    X(0x7E, 2, 12, 12, "BIT 7,(HL)",       CPU_P_NONE,  BIT_N_pRR, 0x80,     CPU_R_HL) \
+    X(0x7F, 2,  8,  8, "BIT 7,A",          CPU_P_NONE,  BIT_N_R,   0x80,     CPU_R_A) \
+    X(0x80, 2,  8,  8, "RES 0,B",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_B) \
+    X(0x81, 2,  8,  8, "RES 0,C",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_C) \
+    X(0x82, 2,  8,  8, "RES 0,D",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_D) \
+    X(0x83, 2,  8,  8, "RES 0,E",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_E) \
+    X(0x84, 2,  8,  8, "RES 0,H",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_H) \
+    X(0x85, 2,  8,  8, "RES 0,L",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_L) \
+    X(0x86, 2, 16, 16, "RES 0,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x01,     CPU_R_HL) \
+    X(0x87, 2,  8,  8, "RES 0,A",          CPU_P_NONE,  RES_N_R,   0x01,     CPU_R_A) \
+    X(0x88, 2,  8,  8, "RES 1,B",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_B) \
+    X(0x89, 2,  8,  8, "RES 1,C",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_C) \
+    X(0x8A, 2,  8,  8, "RES 1,D",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_D) \
+    X(0x8B, 2,  8,  8, "RES 1,E",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_E) \
+    X(0x8C, 2,  8,  8, "RES 1,H",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_H) \
+    X(0x8D, 2,  8,  8, "RES 1,L",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_L) \
+    X(0x8E, 2, 16, 16, "RES 1,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x02,     CPU_R_HL) \
+    X(0x8F, 2,  8,  8, "RES 1,A",          CPU_P_NONE,  RES_N_R,   0x02,     CPU_R_A) \
+    X(0x90, 2,  8,  8, "RES 2,B",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_B) \
+    X(0x91, 2,  8,  8, "RES 2,C",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_C) \
+    X(0x92, 2,  8,  8, "RES 2,D",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_D) \
+    X(0x93, 2,  8,  8, "RES 2,E",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_E) \
+    X(0x94, 2,  8,  8, "RES 2,H",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_H) \
+    X(0x95, 2,  8,  8, "RES 2,L",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_L) \
+    X(0x96, 2, 16, 16, "RES 2,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x04,     CPU_R_HL) \
+    X(0x97, 2,  8,  8, "RES 2,A",          CPU_P_NONE,  RES_N_R,   0x04,     CPU_R_A) \
+    X(0x98, 2,  8,  8, "RES 3,B",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_B) \
+    X(0x99, 2,  8,  8, "RES 3,C",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_C) \
+    X(0x9A, 2,  8,  8, "RES 3,D",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_D) \
+    X(0x9B, 2,  8,  8, "RES 3,E",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_E) \
+    X(0x9C, 2,  8,  8, "RES 3,H",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_H) \
+    X(0x9D, 2,  8,  8, "RES 3,L",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_L) \
+    X(0x9E, 2, 16, 16, "RES 3,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x08,     CPU_R_HL) \
+    X(0x9F, 2,  8,  8, "RES 3,A",          CPU_P_NONE,  RES_N_R,   0x08,     CPU_R_A) \
+    X(0xA0, 2,  8,  8, "RES 4,B",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_B) \
+    X(0xA1, 2,  8,  8, "RES 4,C",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_C) \
+    X(0xA2, 2,  8,  8, "RES 4,D",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_D) \
+    X(0xA3, 2,  8,  8, "RES 4,E",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_E) \
+    X(0xA4, 2,  8,  8, "RES 4,H",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_H) \
+    X(0xA5, 2,  8,  8, "RES 4,L",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_L) \
+    X(0xA6, 2, 16, 16, "RES 4,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x10,     CPU_R_HL) \
+    X(0xA7, 2,  8,  8, "RES 4,A",          CPU_P_NONE,  RES_N_R,   0x10,     CPU_R_A) \
+    X(0xA8, 2,  8,  8, "RES 5,B",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_B) \
+    X(0xA9, 2,  8,  8, "RES 5,C",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_C) \
+    X(0xAA, 2,  8,  8, "RES 5,D",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_D) \
+    X(0xAB, 2,  8,  8, "RES 5,E",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_E) \
+    X(0xAC, 2,  8,  8, "RES 5,H",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_H) \
+    X(0xAD, 2,  8,  8, "RES 5,L",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_L) \
+    X(0xAE, 2, 16, 16, "RES 5,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x20,     CPU_R_HL) \
+    X(0xAF, 2,  8,  8, "RES 5,A",          CPU_P_NONE,  RES_N_R,   0x20,     CPU_R_A) \
+    X(0xB0, 2,  8,  8, "RES 6,B",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_B) \
+    X(0xB1, 2,  8,  8, "RES 6,C",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_C) \
+    X(0xB2, 2,  8,  8, "RES 6,D",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_D) \
+    X(0xB3, 2,  8,  8, "RES 6,E",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_E) \
+    X(0xB4, 2,  8,  8, "RES 6,H",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_H) \
+    X(0xB5, 2,  8,  8, "RES 6,L",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_L) \
+    X(0xB6, 2, 16, 16, "RES 6,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x40,     CPU_R_HL) \
+    X(0xB7, 2,  8,  8, "RES 6,A",          CPU_P_NONE,  RES_N_R,   0x40,     CPU_R_A) \
+    X(0xB8, 2,  8,  8, "RES 7,B",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_B) \
+    X(0xB9, 2,  8,  8, "RES 7,C",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_C) \
+    X(0xBA, 2,  8,  8, "RES 7,D",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_D) \
+    X(0xBB, 2,  8,  8, "RES 7,E",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_E) \
+    X(0xBC, 2,  8,  8, "RES 7,H",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_H) \
+    X(0xBD, 2,  8,  8, "RES 7,L",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_L) \
+    X(0xBE, 2, 16, 16, "RES 7,(HL)",       CPU_P_NONE,  RES_N_pRR, 0x80,     CPU_R_HL) \
+    X(0xBF, 2,  8,  8, "RES 7,A",          CPU_P_NONE,  RES_N_R,   0x80,     CPU_R_A) \
+    X(0xC0, 2,  8,  8, "SET 0,B",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_B) \
+    X(0xC1, 2,  8,  8, "SET 0,C",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_C) \
+    X(0xC2, 2,  8,  8, "SET 0,D",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_D) \
+    X(0xC3, 2,  8,  8, "SET 0,E",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_E) \
+    X(0xC4, 2,  8,  8, "SET 0,H",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_H) \
+    X(0xC5, 2,  8,  8, "SET 0,L",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_L) \
+    X(0xC6, 2, 16, 16, "SET 0,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x01,     CPU_R_HL) \
+    X(0xC7, 2,  8,  8, "SET 0,A",          CPU_P_NONE,  SET_N_R,   0x01,     CPU_R_A) \
+    X(0xC8, 2,  8,  8, "SET 1,B",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_B) \
+    X(0xC9, 2,  8,  8, "SET 1,C",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_C) \
+    X(0xCA, 2,  8,  8, "SET 1,D",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_D) \
+    X(0xCB, 2,  8,  8, "SET 1,E",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_E) \
+    X(0xCC, 2,  8,  8, "SET 1,H",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_H) \
+    X(0xCD, 2,  8,  8, "SET 1,L",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_L) \
+    X(0xCE, 2, 16, 16, "SET 1,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x02,     CPU_R_HL) \
+    X(0xCF, 2,  8,  8, "SET 1,A",          CPU_P_NONE,  SET_N_R,   0x02,     CPU_R_A) \
+    X(0xD0, 2,  8,  8, "SET 2,B",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_B) \
+    X(0xD1, 2,  8,  8, "SET 2,C",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_C) \
+    X(0xD2, 2,  8,  8, "SET 2,D",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_D) \
+    X(0xD3, 2,  8,  8, "SET 2,E",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_E) \
+    X(0xD4, 2,  8,  8, "SET 2,H",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_H) \
+    X(0xD5, 2,  8,  8, "SET 2,L",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_L) \
+    X(0xD6, 2, 16, 16, "SET 2,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x04,     CPU_R_HL) \
+    X(0xD7, 2,  8,  8, "SET 2,A",          CPU_P_NONE,  SET_N_R,   0x04,     CPU_R_A) \
+    X(0xD8, 2,  8,  8, "SET 3,B",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_B) \
+    X(0xD9, 2,  8,  8, "SET 3,C",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_C) \
+    X(0xDA, 2,  8,  8, "SET 3,D",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_D) \
+    X(0xDB, 2,  8,  8, "SET 3,E",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_E) \
+    X(0xDC, 2,  8,  8, "SET 3,H",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_H) \
+    X(0xDD, 2,  8,  8, "SET 3,L",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_L) \
+    X(0xDE, 2, 16, 16, "SET 3,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x08,     CPU_R_HL) \
+    X(0xDF, 2,  8,  8, "SET 3,A",          CPU_P_NONE,  SET_N_R,   0x08,     CPU_R_A) \
+    X(0xE0, 2,  8,  8, "SET 4,B",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_B) \
+    X(0xE1, 2,  8,  8, "SET 4,C",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_C) \
+    X(0xE2, 2,  8,  8, "SET 4,D",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_D) \
+    X(0xE3, 2,  8,  8, "SET 4,E",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_E) \
+    X(0xE4, 2,  8,  8, "SET 4,H",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_H) \
+    X(0xE5, 2,  8,  8, "SET 4,L",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_L) \
+    X(0xE6, 2, 16, 16, "SET 4,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x10,     CPU_R_HL) \
+    X(0xE7, 2,  8,  8, "SET 4,A",          CPU_P_NONE,  SET_N_R,   0x10,     CPU_R_A) \
+    X(0xE8, 2,  8,  8, "SET 5,B",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_B) \
+    X(0xE9, 2,  8,  8, "SET 5,C",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_C) \
+    X(0xEA, 2,  8,  8, "SET 5,D",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_D) \
+    X(0xEB, 2,  8,  8, "SET 5,E",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_E) \
+    X(0xEC, 2,  8,  8, "SET 5,H",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_H) \
+    X(0xED, 2,  8,  8, "SET 5,L",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_L) \
+    X(0xEE, 2, 16, 16, "SET 5,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x20,     CPU_R_HL) \
+    X(0xEF, 2,  8,  8, "SET 5,A",          CPU_P_NONE,  SET_N_R,   0x20,     CPU_R_A) \
+    X(0xF0, 2,  8,  8, "SET 6,B",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_B) \
+    X(0xF1, 2,  8,  8, "SET 6,C",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_C) \
+    X(0xF2, 2,  8,  8, "SET 6,D",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_D) \
+    X(0xF3, 2,  8,  8, "SET 6,E",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_E) \
+    X(0xF4, 2,  8,  8, "SET 6,H",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_H) \
+    X(0xF5, 2,  8,  8, "SET 6,L",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_L) \
+    X(0xF6, 2, 16, 16, "SET 6,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x40,     CPU_R_HL) \
+    X(0xF7, 2,  8,  8, "SET 6,A",          CPU_P_NONE,  SET_N_R,   0x40,     CPU_R_A) \
+    X(0xF8, 2,  8,  8, "SET 7,B",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_B) \
+    X(0xF9, 2,  8,  8, "SET 7,C",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_C) \
+    X(0xFA, 2,  8,  8, "SET 7,D",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_D) \
+    X(0xFB, 2,  8,  8, "SET 7,E",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_E) \
+    X(0xFC, 2,  8,  8, "SET 7,H",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_H) \
+    X(0xFD, 2,  8,  8, "SET 7,L",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_L) \
+    X(0xFE, 2, 16, 16, "SET 7,(HL)",       CPU_P_NONE,  SET_N_pRR, 0x80,     CPU_R_HL) \
+    X(0xFF, 2,  8,  8, "SET 7,A",          CPU_P_NONE,  SET_N_R,   0x80,     CPU_R_A)
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _CPU_OPCODE_H_ */
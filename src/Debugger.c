@@ -22,19 +22,27 @@
  */
 
 
+/* Required for clock_gettime */
+#define _POSIX_C_SOURCE 199309L
+
+
 /******************************************************/
 /* Include                                            */
 /******************************************************/
 
+#include <ctype.h>
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <Memory.h>
-#include <Debugger.h>
-#include <Cpu.h>
+#include <time.h>
+#include <Emu.h>
+#include <Rewind.h>
+#include <State.h>
+#include <Tile.h>
 
 
 /******************************************************/
@@ -48,14 +56,35 @@
 #define DEBUGGER_BUFFER_SIZE        256
 
 /** Max argument number */
-#define DEBUGGER_ARG_COUNT          4
-
-/** Max number of breakpoint */
-#define DEBUGGER_BREAKPOINT_COUNT   16
+#define DEBUGGER_ARG_COUNT          8
 
 /** Memory print line count */
 #define DEBUGGER_MEM_LINE_COUNT     4
 
+/** Cycle budget of each run iteration without breakpoint */
+#define DEBUGGER_RUN_CYCLE          70224
+
+/** Default cycle budget of a benchmark run */
+#define DEBUGGER_BENCH_CYCLE        200000
+
+/** Number of benchmark run */
+#define DEBUGGER_BENCH_COUNT        50
+
+/** Default number of random CPU state per instruction of the dynarec check */
+#define DEBUGGER_DYNAREC_PASS       64
+
+/** Default number of frame of the render benchmark */
+#define DEBUGGER_RENDER_FRAME       1000
+
+/** Default number of pass over the operand pair of the ALU benchmark */
+#define DEBUGGER_ALU_PASS           20
+
+/** Number of ALU operation evaluated per operand pair (see Cpu_BenchAlu) */
+#define DEBUGGER_ALU_OPERATION      10
+
+/** Size of the VRAM tile data area */
+#define DEBUGGER_TILE_DATA_SIZE     0x1800
+
 
 /******************************************************/
 /* Type                                               */
@@ -63,9 +92,10 @@
 
 /**
  * Callback type to Execute a Debugger command
+ * @param ctx The emulator context
  * @param arg command argument string
  */
-typedef void (*Debugger_Callback_t)(int argc, char const * argv[]);
+typedef void (*Debugger_Callback_t)(Emu_Context_t * ctx, int argc, char const * argv[]);
 
 /**
  * Debugger command type
@@ -79,58 +109,52 @@ typedef struct tagDebugger_Command_t
     Debugger_Callback_t Callback;   /**< Callback */
 } Debugger_Command_t;
 
-/**
- * Debugger state type
- */
-typedef enum tagDebugger_State_e
-{
-    DEBUGGER_STATE_RUN,     /**< Run wihtout interruption */
-    DEBUGGER_STATE_BREAK,   /**< Pause the program for debug */
-    DEBUGGER_STATE_EXIT     /**< Quit the debugger */
-} Debugger_State_e;
-
-/**
- * Debugger info type
- */
-typedef struct tagDebugger_Info_t
-{
-    Debugger_State_e State;                             /**< Debugger state */
-    int MemoryAddress;                                  /**< Memory address to display */
-    int BreakListCount;                                 /**< Breakpoint set count */
-    uint16_t BreakListAddr[DEBUGGER_BREAKPOINT_COUNT];  /**< Breakpoint list */
-} Debugger_Info_t;
-
 
 /******************************************************/
 /* Prototype                                          */
 /******************************************************/
 
 /* Command callback */
-static void Debugger_CommandRun(int argc, char const * argv[]);
-static void Debugger_CommandStep(int argc, char const * argv[]);
-static void Debugger_CommandReset(int argc, char const * argv[]);
-static void Debugger_CommandBreak(int argc, char const * argv[]);
-static void Debugger_CommandClear(int argc, char const * argv[]);
-static void Debugger_CommandMem(int argc, char const * argv[]);
-static void Debugger_CommandCpu(int argc, char const * argv[]);
-static void Debugger_CommandQuit(int argc, char const * argv[]);
-static void Debugger_CommandHelp(int argc, char const * argv[]);
+static void Debugger_CommandRun(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandStep(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandReset(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandSave(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandLoad(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandBack(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandRewind(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandBench(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandRender(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandAlu(Emu_Context_t * ctx, int argc, char const * argv[]);
+#if defined(CPU_DYNAREC)
+static void Debugger_CommandDynarec(Emu_Context_t * ctx, int argc, char const * argv[]);
+#endif
+static void Debugger_CommandBreak(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandWatch(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandClear(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandMem(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandCpu(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandTrace(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandScreen(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandFrame(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandQuit(Emu_Context_t * ctx, int argc, char const * argv[]);
+static void Debugger_CommandHelp(Emu_Context_t * ctx, int argc, char const * argv[]);
 
 /* Utility */
 static char * Debugger_GetUserInput(char * buffer);
-static bool Debugger_IsBreakpoint(uint16_t addr);
-static void Debugger_PrintState(void);
+static bool Debugger_IsBreakpoint(Emu_Context_t * ctx, uint16_t addr);
+static int Debugger_CompileCondition(char const * expr, Debugger_Condition_t * cond);
+static bool Debugger_CheckCondition(Emu_Context_t * ctx, Debugger_Condition_t const * cond);
+static void Debugger_PrintBreakpoint(Emu_Context_t * ctx);
+static void Debugger_PrintWatchpoint(Emu_Context_t * ctx);
+static bool Debugger_IsWatchHit(Emu_Context_t * ctx);
+static void Debugger_PrintState(Emu_Context_t * ctx);
+static double Debugger_GetTime(void);
 
 
 /******************************************************/
 /* Variable                                           */
 /******************************************************/
 
-/**
- * Debugger Info
- */
-static Debugger_Info_t Debugger_Info;
-
 /**
  * Debugger Command
  */
@@ -140,20 +164,46 @@ Debugger_Command_t const Debugger_Command[] =
     {"run", "r", "",                 "Run the program to be debugged.",         Debugger_CommandRun},
     {"step", "s", "[step #]",        "Go to next instruction.",                 Debugger_CommandStep},
     {"reset", "rst", "",             "Reset the program.",                      Debugger_CommandReset},
+    {"save", "", "<file>",           "Save the machine state.",                 Debugger_CommandSave},
+    {"load", "", "<file>",           "Restore a saved machine state.",          Debugger_CommandLoad},
+    {"back", "", "[frame #]",        "Go back in time. (default: 1 frame)",     Debugger_CommandBack},
+    {"rewind", "", "[frame #] [KiB]", "Snapshot every N frame. (0: off)",       Debugger_CommandRewind},
+    {"bench", "", "[cycle #]",       "Measure the CPU dispatch speed.",         Debugger_CommandBench},
+    {"render", "", "[frame #]",      "Measure the tile decoder and render speed.", Debugger_CommandRender},
+    {"alu", "", "[pass #]",          "Measure the ALU flag table speed.",       Debugger_CommandAlu},
+#if defined(CPU_DYNAREC)
+    {"dynarec", "", "[pass #]",      "Compare native code with the interpreter.", Debugger_CommandDynarec},
+#endif
 
     /* Breakpoint */
-    {"break", "b", "<addr>",         "Set a new breakpoint.",                   Debugger_CommandBreak},
-    {"clear", "c", "",               "Remove all breakpoint.",                  Debugger_CommandClear},
+    {"break", "b", "<addr> [if exp]", "Set a breakpoint. (exp: A==0x3e, (addr)<5)", Debugger_CommandBreak},
+    {"watch", "w", "<addr> [rw] [d]", "Stop on r|w|rw access. (default: w, any d)", Debugger_CommandWatch},
+    {"clear", "c", "",               "Remove all breakpoint and watchpoint.",   Debugger_CommandClear},
 
     /* Memory */
     {"mem", "", "<addr> [size]",     "Print memory area. (default: size=1)",    Debugger_CommandMem},
     {"cpu", "", "",                  "Print CPU register.",                     Debugger_CommandCpu},
+    {"trace", "t", "[file|off]",     "Trace memory access to file. (no arg: flush)", Debugger_CommandTrace},
+    {"screen", "", "<file>",         "Save the framebuffer to a PGM image.",    Debugger_CommandScreen},
+    {"frame", "", "[interval]",      "Render every Nth frame. (0: none)",       Debugger_CommandFrame},
 
     /* Misc */
     {"help", "h", "",                "Print this help.",                        Debugger_CommandHelp},
     {"quit", "q", "",                "Close the application.",                  Debugger_CommandQuit}
 };
 
+/** 8 bit register name (Cpu_RegName_e order) */
+static char const * const Debugger_Reg8Name[] = {"F", "A", "C", "B", "E", "D", "L", "H"};
+
+/** 16 bit register name (Cpu_RegName_e order) */
+static char const * const Debugger_Reg16Name[CPU_REG_NUM] = {"AF", "BC", "DE", "HL", "SP", "PC"};
+
+/** Comparison operator (Debugger_Compare_e order) */
+static char const * const Debugger_CompareName[] = {"==", "!=", "<", "<=", ">", ">="};
+
+/** Watched access name (Memory_Watch_e order) */
+static char const * const Debugger_WatchName[] = {"", "r", "w", "rw"};
+
 
 /******************************************************/
 /* Function                                           */
@@ -207,18 +257,26 @@ void Debugger_RunShell(int argc, char const *argv[])
     char buffer[DEBUGGER_BUFFER_SIZE];
 
     /* Initialize */
-    Debugger_CommandReset(0, NULL);
+    Emu_Context_t * ctx = Emu_Create();
+    if(ctx == NULL)
+    {
+        DEBUGGER_ERROR("Cannot create emulator context\n");
+        return;
+    }
+    ctx->Debugger.CartridgeFile = (argc >= 2) ? argv[1] : NULL;
+    Rewind_Start(ctx, REWIND_DEFAULT_INTERVAL, REWIND_DEFAULT_BUDGET);
+    Debugger_CommandReset(ctx, 0, NULL);
 
     printf("Print 'help' to list all availlable command.\n");
 
-    while(Debugger_Info.State != DEBUGGER_STATE_EXIT)
+    while(ctx->Debugger.State != DEBUGGER_STATE_EXIT)
     {
-        Debugger_Info.State = DEBUGGER_STATE_RUN;
+        ctx->Debugger.State = DEBUGGER_STATE_RUN;
 
         /* Get user input */
         if(Debugger_GetUserInput(buffer) == NULL)
         {
-            return;
+            break;
         }
 
         /* Remember current string before handling it */
@@ -241,7 +299,7 @@ void Debugger_RunShell(int argc, char const *argv[])
             com_argv[com_argc] = pch;
             com_argc ++;
 
-            if(com_argc > DEBUGGER_ARG_COUNT)
+            if(com_argc == DEBUGGER_ARG_COUNT)
             {
                 /* Ignore extra argument */
                 break;
@@ -272,7 +330,7 @@ void Debugger_RunShell(int argc, char const *argv[])
         /* Execute command */
         if(found == 1)
         {
-            Debugger_Command[i].Callback(com_argc, (char const **)com_argv);
+            Debugger_Command[i].Callback(ctx, com_argc, (char const **)com_argv);
             strncpy(buffer_prev, buffer_curr, DEBUGGER_BUFFER_SIZE);
         }
         else
@@ -280,6 +338,8 @@ void Debugger_RunShell(int argc, char const *argv[])
             printf("Unknown command. Print 'help' to list availlable command.\n");
         }
     }
+
+    Emu_Destroy(ctx);
 }
 
 
@@ -293,13 +353,25 @@ void Debugger_Log(char const *fmt, ...)
 }
 
 
-static bool Debugger_IsBreakpoint(uint16_t addr)
+/**
+ * Check if the program stop at an address
+ * @param ctx The emulator context
+ * @param addr The instruction address
+ * @return true if a breakpoint is set and its condition is true
+ */
+static bool Debugger_IsBreakpoint(Emu_Context_t * ctx, uint16_t addr)
 {
-    for(int i=0; i<Debugger_Info.BreakListCount; i++)
+    /* The CPU bitmap filter the address without breakpoint */
+    if(!Cpu_IsBreakpoint(ctx, addr))
+    {
+        return false;
+    }
+
+    for(int i=0; i<ctx->Debugger.BreakListCount; i++)
     {
-        if(addr == Debugger_Info.BreakListAddr[i])
+        if(addr == ctx->Debugger.BreakList[i].Addr)
         {
-            return true;
+            return Debugger_CheckCondition(ctx, &ctx->Debugger.BreakList[i].Condition);
         }
     }
 
@@ -307,6 +379,218 @@ static bool Debugger_IsBreakpoint(uint16_t addr)
 }
 
 
+/**
+ * Compile a breakpoint condition
+ * @param expr The condition string without space ("A==0x3e", "(0xc000)!=0", "HL>=0x9800")
+ * @param cond The compiled condition
+ * @return 0 if successful, otherwise -1
+ */
+static int Debugger_CompileCondition(char const * expr, Debugger_Condition_t * cond)
+{
+    /* Split the operand and the operator */
+    size_t const len = strcspn(expr, "=!<>");
+    char name[DEBUGGER_BUFFER_SIZE];
+    if((len == 0) || (expr[len] == '\0'))
+    {
+        return -1;
+    }
+    for(size_t i=0; i<len; i++)
+    {
+        name[i] = (char)toupper((unsigned char)expr[i]);
+    }
+    name[len] = '\0';
+
+    /* Operand: memory Byte or register */
+    cond->Source = DEBUGGER_SOURCE_NONE;
+    if((name[0] == '(') && (name[len - 1] == ')'))
+    {
+        char * end;
+        cond->Source  = DEBUGGER_SOURCE_MEMORY;
+        cond->Operand = (uint16_t)strtol(&name[1], &end, 0);
+        if(end != &name[len - 1])
+        {
+            return -1;
+        }
+    }
+    for(int i=0; i<(int)ARRAY_SIZE(Debugger_Reg16Name); i++)
+    {
+        if(strcmp(name, Debugger_Reg16Name[i]) == 0)
+        {
+            cond->Source  = DEBUGGER_SOURCE_REG16;
+            cond->Operand = i;
+        }
+    }
+    for(int i=0; i<(int)ARRAY_SIZE(Debugger_Reg8Name); i++)
+    {
+        if(strcmp(name, Debugger_Reg8Name[i]) == 0)
+        {
+            cond->Source  = DEBUGGER_SOURCE_REG8;
+            cond->Operand = i;
+        }
+    }
+    if(cond->Source == DEBUGGER_SOURCE_NONE)
+    {
+        return -1;
+    }
+
+    /* Operator: the longest match first ("<=" before "<") */
+    char const * value = NULL;
+    for(int i=(int)ARRAY_SIZE(Debugger_CompareName)-1; i>=0; i--)
+    {
+        size_t const size = strlen(Debugger_CompareName[i]);
+        if(strncmp(&expr[len], Debugger_CompareName[i], size) == 0)
+        {
+            cond->Compare = i;
+            value = &expr[len + size];
+            break;
+        }
+    }
+    if((value == NULL) || (*value == '\0'))
+    {
+        return -1;
+    }
+
+    /* Value */
+    char * end;
+    cond->Value = (uint16_t)strtol(value, &end, 0);
+    return (*end == '\0') ? 0 : -1;
+}
+
+
+/**
+ * Evaluate a breakpoint condition
+ * @param ctx The emulator context
+ * @param cond The compiled condition
+ * @return true if the program must stop
+ */
+static bool Debugger_CheckCondition(Emu_Context_t * ctx, Debugger_Condition_t const * cond)
+{
+    uint16_t data;
+
+    switch(cond->Source)
+    {
+        case DEBUGGER_SOURCE_NONE:
+            return true;
+        case DEBUGGER_SOURCE_REG8:
+            Cpu_SyncFlag(ctx);
+            data = CPU_REG8(ctx, cond->Operand)->UByte;
+            break;
+        case DEBUGGER_SOURCE_REG16:
+            Cpu_SyncFlag(ctx);
+            data = CPU_REG16(ctx, cond->Operand)->UWord;
+            break;
+        default:
+        {
+            /* Keep the debugger own access out of the trace and watchpoint */
+            bool const trace = ctx->Trace.Enabled;
+            ctx->Trace.Enabled = false;
+            ctx->Memory.WatchEnabled = false;
+            data = Memory_Read(ctx, cond->Operand);
+            ctx->Trace.Enabled = trace;
+            ctx->Memory.WatchEnabled = true;
+            break;
+        }
+    }
+
+    switch(cond->Compare)
+    {
+        case DEBUGGER_COMPARE_EQ: return data == cond->Value;
+        case DEBUGGER_COMPARE_NE: return data != cond->Value;
+        case DEBUGGER_COMPARE_LT: return data <  cond->Value;
+        case DEBUGGER_COMPARE_LE: return data <= cond->Value;
+        case DEBUGGER_COMPARE_GT: return data >  cond->Value;
+        default:                  return data >= cond->Value;
+    }
+}
+
+
+/**
+ * Print the breakpoint list
+ * @param ctx The emulator context
+ */
+static void Debugger_PrintBreakpoint(Emu_Context_t * ctx)
+{
+    printf("Breakpoint list:\n");
+    for(int i=0; i<ctx->Debugger.BreakListCount; i++)
+    {
+        Debugger_Breakpoint_t const * bp = &ctx->Debugger.BreakList[i];
+        Debugger_Condition_t const * cond = &bp->Condition;
+
+        printf("#%d: 0x%04x", i, bp->Addr);
+        switch(cond->Source)
+        {
+            case DEBUGGER_SOURCE_REG8:
+                printf(" if %s%s0x%02x", Debugger_Reg8Name[cond->Operand], Debugger_CompareName[cond->Compare], cond->Value);
+                break;
+            case DEBUGGER_SOURCE_REG16:
+                printf(" if %s%s0x%04x", Debugger_Reg16Name[cond->Operand], Debugger_CompareName[cond->Compare], cond->Value);
+                break;
+            case DEBUGGER_SOURCE_MEMORY:
+                printf(" if (0x%04x)%s0x%02x", cond->Operand, Debugger_CompareName[cond->Compare], cond->Value);
+                break;
+            default:
+                break;
+        }
+        printf("\n");
+    }
+}
+
+
+/**
+ * Print the watchpoint list
+ * @param ctx The emulator context
+ */
+static void Debugger_PrintWatchpoint(Emu_Context_t * ctx)
+{
+    printf("Watchpoint list:\n");
+    for(int i=0; i<ctx->Memory.WatchCount; i++)
+    {
+        Memory_Watch_t const * watch = &ctx->Memory.Watch[i];
+
+        printf("#%d: 0x%04x %-2s", i, watch->Addr, Debugger_WatchName[watch->Kind]);
+        if(watch->Value != MEMORY_WATCH_ANY)
+        {
+            printf(" 0x%02x", watch->Value);
+        }
+        printf("\n");
+    }
+}
+
+
+/**
+ * Report and acknowledge a watchpoint hit
+ * @param ctx The emulator context
+ * @return true if a watchpoint was hit
+ */
+static bool Debugger_IsWatchHit(Emu_Context_t * ctx)
+{
+    Memory_Watch_t * hit = &ctx->Memory.WatchHit;
+
+    if(hit->Kind == MEMORY_WATCH_NONE)
+    {
+        return false;
+    }
+
+    printf("Watchpoint: %s 0x%02x at 0x%04x\n", (hit->Kind == MEMORY_WATCH_READ) ? "read" : "write", hit->Value, hit->Addr);
+    hit->Kind = MEMORY_WATCH_NONE;
+
+    return true;
+}
+
+
+/**
+ * Get a monotonic time
+ * @return The time in second
+ */
+static double Debugger_GetTime(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
 /**
  * Print the following information:
  * ┌────────┬──────────────────────────────────────────────────┐
@@ -328,27 +612,32 @@ static bool Debugger_IsBreakpoint(uint16_t addr)
  * │ PC │ 0x0000  │ │   0x000a │ JR NZ,-5           │ 20 fb    │
  * └────┴─────────┘ └──────────┴────────────────────┴──────────┘
  */
-static void Debugger_PrintState(void)
+static void Debugger_PrintState(Emu_Context_t * ctx)
 {
+    /* Keep the debugger own access out of the trace and watchpoint */
+    bool const trace = ctx->Trace.Enabled;
+    ctx->Trace.Enabled = false;
+    ctx->Memory.WatchEnabled = false;
+
     /* Print memory header */
     printf("┌────────┬──────────────────────────────────────────────────┐\n");
     printf("│ Memory │ 00 01 02 03 04 05 06 07  08 09 0a 0b 0c 0d 0e 0f │\n");
     printf("├────────┼──────────────────────────────────────────────────┤\n");
 
     /* Print memory */
-    uint16_t mem_start = Debugger_Info.MemoryAddress & 0xFFF0;
+    uint16_t mem_start = ctx->Debugger.MemoryAddress & 0xFFF0;
     uint16_t mem_end   = mem_start + (0x0010 * DEBUGGER_MEM_LINE_COUNT);
     for(uint16_t i=mem_start; i<mem_end; i += 0x0010)
     {
         printf("│ 0x%04x │ ", i);
         for(uint16_t j=0x0000; j<0x0008; j++)
         {
-            printf("%02x ", Memory_Read(i + j));
+            printf("%02x ", Memory_Read(ctx, i + j));
         }
         printf(" ");
         for(uint16_t j=0x0008; j<0x0010; j++)
         {
-            printf("%02x ", Memory_Read(i + j));
+            printf("%02x ", Memory_Read(ctx, i + j));
         }
         printf("│\n");
     }
@@ -361,24 +650,25 @@ static void Debugger_PrintState(void)
 
     /* Print Cpu data and Program data */
     char const *cpu_reg[CPU_REG_NUM] = {"AF", "BC", "DE", "HL", "SP", "PC"};
-    uint16_t    cpu_pc = CPU_REG16(CPU_R_PC)->UWord;
+    uint16_t    cpu_pc = CPU_REG16(ctx, CPU_R_PC)->UWord;
+    Cpu_SyncFlag(ctx);
     for(int i=0; i<CPU_REG_NUM; i++)
     {
         /* CPU */
-        printf("│ %2s │ 0x%04x  │ ", cpu_reg[i], CPU_REG16(i)->UWord);
+        printf("│ %2s │ 0x%04x  │ ", cpu_reg[i], CPU_REG16(ctx, i)->UWord);
 
         /* Program */
         char buffer[DEBUGGER_BUFFER_SIZE];
         int size;
-        Cpu_GetOpcodeInfo(cpu_pc, buffer, &size);
-        printf("│ %c ", Debugger_IsBreakpoint(cpu_pc) ? 'o':' ');
+        Cpu_GetOpcodeInfo(ctx, cpu_pc, buffer, &size);
+        printf("│ %c ", Cpu_IsBreakpoint(ctx, cpu_pc) ? 'o':' ');
         printf("0x%04x │", cpu_pc);
         printf(" %-18s │ ", buffer);
 
         /* Print opcode byte */
         for(int j=0; j<size; j++)
         {
-            printf("%02x ", Memory_Read(cpu_pc + j));
+            printf("%02x ", Memory_Read(ctx, cpu_pc + j));
         }
         for(int j=size; j<3; j++)
         {
@@ -392,6 +682,11 @@ static void Debugger_PrintState(void)
 
     /* Print CPU and Program footer */
     printf("└────┴─────────┘ └──────────┴────────────────────┴──────────┘\n");
+    printf("Cycle: %" PRIu64 " (idle: %" PRIu64 ")%s%s\n", ctx->Cpu.Cycle, ctx->Cpu.IdleCycle,
+           ctx->Cpu.Ime ? " IME" : "", ctx->Cpu.Locked ? " LOCKED" : (ctx->Cpu.Halted ? " HALT" : ""));
+
+    ctx->Trace.Enabled = trace;
+    ctx->Memory.WatchEnabled = true;
 }
 
 
@@ -402,7 +697,7 @@ static void Debugger_PrintState(void)
 /**
  * Run the program until breakpoint
  */
-static void Debugger_CommandStep(int argc, char const * argv[])
+static void Debugger_CommandStep(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     if(argc > 2)
     {
@@ -419,124 +714,519 @@ static void Debugger_CommandStep(int argc, char const * argv[])
 
     for(int i=0; i<step; i++)
     {
-        Cpu_Step();
+        Emu_Step(ctx);
+        Rewind_Update(ctx);
 
-        if(Debugger_IsBreakpoint(CPU_REG16(CPU_R_PC)->UWord))
+        if(Debugger_IsWatchHit(ctx) || Debugger_IsBreakpoint(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord))
         {
             break;
         }
     }
 
     /* Display CPU after stepping */
-    Debugger_PrintState();
+    Debugger_PrintState(ctx);
 }
 
 /**
  * Run the program until breakpoint
  */
-static void Debugger_CommandRun(int argc, char const * argv[])
+static void Debugger_CommandRun(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     /* Unused param */
     (void) argc;
     (void) argv;
 
-    for(;;)
+    /* Leave the current breakpoint, then execute by cycle budget up to the next one (a locked CPU never reach it) */
+    Emu_Step(ctx);
+    while(!Debugger_IsWatchHit(ctx) && !ctx->Cpu.Locked)
     {
-        Cpu_Step();
+        Emu_Run(ctx, DEBUGGER_RUN_CYCLE);
+        Rewind_Update(ctx);
 
-        if(Debugger_IsBreakpoint(CPU_REG16(CPU_R_PC)->UWord))
+        if(ctx->Cpu.Break && (ctx->Memory.WatchHit.Kind == MEMORY_WATCH_NONE))
         {
-            break;
+            if(Debugger_IsBreakpoint(ctx, CPU_REG16(ctx, CPU_R_PC)->UWord))
+            {
+                break;
+            }
+
+            /* Condition is false: go past the breakpoint */
+            Emu_Step(ctx);
         }
     }
 
     /* Display CPU after stepping */
-    Debugger_PrintState();
+    Debugger_PrintState(ctx);
 }
 
 /**
  * Reset the program
  */
-static void Debugger_CommandReset(int argc, char const * argv[])
+static void Debugger_CommandReset(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     /* Unused param */
     (void) argc;
     (void) argv;
 
-    /* @todo find a better way to do it */
-    Memory_Initialize();
-    Cpu_Initialize();
-    Memory_LoadFile("rom/bootstrap.bin", 0);
-}
+    Emu_Reset(ctx);
+    if(ctx->Debugger.CartridgeFile != NULL)
+    {
+        Cartridge_Load(ctx, ctx->Debugger.CartridgeFile);
+    }
+    else
+    {
+        Cartridge_Initialize(ctx);
+    }
+    Memory_LoadBoot(ctx, "rom/bootstrap.bin");
 
+    /* The history restart from the boot */
+    Rewind_Clear(ctx);
+    Rewind_Update(ctx);
+}
 
 /**
- * Set break point
+ * Save the machine state
  */
-static void Debugger_CommandBreak(int argc, char const * argv[])
+static void Debugger_CommandSave(Emu_Context_t * ctx, int argc, char const * argv[])
 {
-    /* breakpoint presence */
-    int found = 0;
+    if(argc != 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
 
+    if(State_SaveFile(ctx, argv[1]) == 0)
+    {
+        printf("State saved to %s.\n", argv[1]);
+    }
+}
+
+/**
+ * Restore a saved machine state
+ */
+static void Debugger_CommandLoad(Emu_Context_t * ctx, int argc, char const * argv[])
+{
     if(argc != 2)
     {
         printf("Wrong number of argument\n");
         return;
     }
 
+    if(State_LoadFile(ctx, argv[1]) == 0)
+    {
+        Rewind_Clear(ctx);
+        Rewind_Update(ctx);
+        Debugger_PrintState(ctx);
+    }
+}
+
+/**
+ * Restore a recent snapshot
+ */
+static void Debugger_CommandBack(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    uint64_t frames = 1;
+    if(argc == 2)
+    {
+        frames = strtoull(argv[1], NULL, 0);
+    }
+
+    if(Rewind_Back(ctx, frames) == 0)
+    {
+        printf("Back to frame %" PRIu64 ".\n", Ppu_GetFrameCount(ctx));
+        Debugger_PrintState(ctx);
+    }
+}
+
+/**
+ * Print or set the snapshot interval and memory budget
+ */
+static void Debugger_CommandRewind(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    Rewind_Info_t const * rw = &ctx->Rewind;
+
+    if(argc > 3)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    if(argc >= 2)
+    {
+        size_t budget = (rw->Budget != 0) ? rw->Budget : REWIND_DEFAULT_BUDGET;
+        if(argc == 3)
+        {
+            budget = (size_t)strtoul(argv[2], NULL, 0) * 1024;
+        }
+        Rewind_Start(ctx, strtoul(argv[1], NULL, 0), budget);
+    }
+
+    if(rw->Interval == 0)
+    {
+        printf("Rewind off.\n");
+        return;
+    }
+
+    /* The newest snapshot is kept in full, the older one as delta */
+    uint32_t const count = rw->EntryCount + (rw->Captured ? 1 : 0);
+    uint64_t const oldest = (rw->EntryCount != 0) ? rw->Entry[rw->EntryFirst].Cycle : rw->ImageCycle;
+    printf("Rewind every %" PRIu32 " frame: %" PRIu32 " snapshot over %" PRIu64 " frame, %zu/%zu KiB history.\n",
+           rw->Interval, count, (rw->ImageCycle - oldest) / PPU_FRAME_CYCLE, rw->RingUsed / 1024, rw->RingSize / 1024);
+}
+
+
+/**
+ * Compare Cpu_Step table dispatch with Cpu_Run block dispatch
+ */
+static void Debugger_CommandBench(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    /* Get the number of cycle to execute from reset */
+    uint32_t cycles = DEBUGGER_BENCH_CYCLE;
+    if(argc == 2)
+    {
+        cycles = strtol(argv[1], NULL, 0);
+    }
+
+    double step_time = 0;
+    double block_time = 0;
+    double block_cycle = 0;
+    for(int i=0; i<DEBUGGER_BENCH_COUNT; i++)
+    {
+        /* Table dispatch */
+        Debugger_CommandReset(ctx, 0, NULL);
+        double start = Debugger_GetTime();
+        for(uint32_t cycle=0; cycle<cycles; )
+        {
+            cycle += Cpu_Step(ctx);
+        }
+        step_time += Debugger_GetTime() - start;
+
+        /* Block dispatch */
+        Debugger_CommandReset(ctx, 0, NULL);
+        start = Debugger_GetTime();
+        uint32_t const spent = Cpu_Run(ctx, cycles);
+        block_time += Debugger_GetTime() - start;
+
+        /* Fast-forwarded cycle are not executed: only count the dispatched one */
+        block_cycle += spent - ctx->Cpu.IdleCycle;
+    }
+
+#if defined(CPU_DISPATCH_GOTO)
+    char const * dispatch = "goto";
+#else
+    char const * dispatch = "switch";
+#endif
+
+    double const step_rate = (double)cycles * DEBUGGER_BENCH_COUNT / step_time;
+    double const block_rate = block_cycle / block_time;
+    printf("Table dispatch:          %8.2f MHz\n", step_rate / 1e6);
+    printf("Block dispatch (%-6s): %8.2f MHz (x%.2f)\n", dispatch, block_rate / 1e6, block_rate / step_rate);
+
+    /* Leave the program in its initial state */
+    Debugger_CommandReset(ctx, 0, NULL);
+}
+
+#if defined(CPU_DYNAREC)
+/**
+ * Compare the native translation of every instruction with the interpreter
+ */
+static void Debugger_CommandDynarec(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    uint32_t passes = DEBUGGER_DYNAREC_PASS;
+    if(argc == 2)
+    {
+        passes = strtol(argv[1], NULL, 0);
+    }
+
+    bool mismatch[CPU_INDEX_NUM];
+    int const failed = Cpu_CheckDynarec(ctx, passes, mismatch);
+    if(failed < 0)
+    {
+        printf("Dynarec not available\n");
+    }
+    else
+    {
+        for(int index=0; index<CPU_INDEX_NUM; index++)
+        {
+            if(mismatch[index])
+            {
+                printf("Mismatch: %s%02X\n", (index >= 0x100) ? "CB " : "", index & 0xFF);
+            }
+        }
+        printf("%d mismatching instruction %s\n", failed, (failed == 0) ? "(match)" : "(MISMATCH)");
+    }
+
+    /* Leave the program in its initial state */
+    Debugger_CommandReset(ctx, 0, NULL);
+}
+#endif
+
+
+/**
+ * Compare the tile decoder on a busy frame
+ */
+static void Debugger_CommandRender(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    uint32_t frames = DEBUGGER_RENDER_FRAME;
+    if(argc == 2)
+    {
+        frames = strtol(argv[1], NULL, 0);
+    }
+
+    /* Busy scene: random tile and sprite, background with window, signed tile index */
+    uint32_t seed = 1;
+    for(uint32_t addr=0x8000; addr<0xA000; addr++)
+    {
+        seed = seed * 1103515245 + 12345;
+        Memory_Write(ctx, (uint16_t)addr, (uint8_t)(seed >> 16));
+    }
+    for(uint32_t addr=0xFE00; addr<0xFEA0; addr++)
+    {
+        seed = seed * 1103515245 + 12345;
+        Memory_Write(ctx, (uint16_t)addr, (uint8_t)(seed >> 16));
+    }
+    Memory_Write(ctx, PPU_REG_BGP, 0xE4);
+    Memory_Write(ctx, PPU_REG_OBP0, 0xE4);
+    Memory_Write(ctx, PPU_REG_OBP1, 0x1B);
+    Memory_Write(ctx, PPU_REG_SCX, 3);
+    Memory_Write(ctx, PPU_REG_WY, 72);
+    Memory_Write(ctx, PPU_REG_WX, 87);
+    Memory_Write(ctx, PPU_REG_LCDC, 0xE3);
+
+    Tile_Kernel_e const selected = Tile_GetKernel();
+    uint8_t const * vram = MEMORY_BANK(ctx, MEMORY_BANK_VRAM);
+    for(int kernel=0; kernel<TILE_KERNEL_COUNT; kernel++)
+    {
+        if(Tile_SetKernel((Tile_Kernel_e)kernel) != 0)
+        {
+            continue;
+        }
+
+        /* Decode the whole tile data (0x8000-0x97FF) once per frame */
+        uint8_t pixel[TILE_ROW_WIDTH];
+        uint8_t volatile sink;
+        double start = Debugger_GetTime();
+        for(uint32_t frame=0; frame<frames; frame++)
+        {
+            for(uint32_t row=0; row<DEBUGGER_TILE_DATA_SIZE; row+=2)
+            {
+                Tile_DecodeRow(vram[row], vram[row + 1], pixel);
+                sink = pixel[frame % TILE_ROW_WIDTH];
+            }
+        }
+        double const decode_time = Debugger_GetTime() - start;
+        (void) sink;
+
+        /* Cold tile cache: every frame decode its tile with the kernel */
+        double render_time = 0;
+        for(uint32_t frame=0; frame<frames; frame++)
+        {
+            Ppu_FlushTileCache(ctx);
+            start = Debugger_GetTime();
+            Ppu_RenderFrame(ctx);
+            render_time += Debugger_GetTime() - start;
+        }
+
+        double const rows = (double)frames * (DEBUGGER_TILE_DATA_SIZE / 2);
+        printf("%-6s: %6.2f ns/row %8.2f us/frame%s\n", Tile_GetName((Tile_Kernel_e)kernel),
+               decode_time * 1e9 / rows, render_time * 1e6 / frames,
+               (kernel == (int)selected) ? " (selected)" : "");
+    }
+
+    Tile_SetKernel(selected);
+
+    /* Warm tile cache: no decoding once the VRAM is unchanged */
+    Ppu_RenderFrame(ctx);
+    double const start = Debugger_GetTime();
+    for(uint32_t frame=0; frame<frames; frame++)
+    {
+        Ppu_RenderFrame(ctx);
+    }
+    printf("cached: %27.2f us/frame\n", (Debugger_GetTime() - start) * 1e6 / frames);
+
+    /* Leave the program in its initial state */
+    Debugger_CommandReset(ctx, 0, NULL);
+}
+
+
+/**
+ * Compare the ALU flag table with the per-flag set/clear code
+ */
+static void Debugger_CommandAlu(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    uint32_t passes = DEBUGGER_ALU_PASS;
+    if(argc == 2)
+    {
+        passes = strtol(argv[1], NULL, 0);
+    }
+
+    double start = Debugger_GetTime();
+    uint32_t const reference = Cpu_BenchAlu(ctx, passes, false);
+    double const reference_time = Debugger_GetTime() - start;
+
+    start = Debugger_GetTime();
+    uint32_t const table = Cpu_BenchAlu(ctx, passes, true);
+    double const table_time = Debugger_GetTime() - start;
+
+    double const ops = (double)passes * DEBUGGER_ALU_OPERATION * 0x10000;
+    printf("Per-flag code: %6.2f ns/op\n", reference_time * 1e9 / ops);
+    printf("Flag table:    %6.2f ns/op (x%.2f)\n", table_time * 1e9 / ops, reference_time / table_time);
+    printf("Checksum:      0x%08" PRIx32 " %s\n", table, (table == reference) ? "(match)" : "(MISMATCH)");
+
+    /* Leave the program in its initial state */
+    Debugger_CommandReset(ctx, 0, NULL);
+}
+
+/**
+ * Set break point
+ */
+static void Debugger_CommandBreak(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if((argc != 2) && ((argc < 4) || (strcmp(argv[2], "if") != 0)))
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
     /* Get breakpoint addresss */
     uint16_t addr = (uint16_t)strtol(argv[1], NULL, 0);
 
-    /* Check Table overflow */
-    if(Debugger_Info.BreakListCount == DEBUGGER_BREAKPOINT_COUNT)
+    /* Compile the condition once, it is only evaluated when the address is reached */
+    Debugger_Condition_t cond = {DEBUGGER_SOURCE_NONE, DEBUGGER_COMPARE_EQ, 0, 0};
+    if(argc > 2)
     {
-        found = 1;
-        printf("Cannot register more than %d breakpoint.\n", DEBUGGER_BREAKPOINT_COUNT);
+        char expr[DEBUGGER_BUFFER_SIZE] = "";
+        for(int i=3; i<argc; i++)
+        {
+            strncat(expr, argv[i], sizeof(expr) - strlen(expr) - 1);
+        }
+        if(Debugger_CompileCondition(expr, &cond) != 0)
+        {
+            printf("Invalid condition: %s\n", expr);
+            return;
+        }
     }
 
     /* Check for breakpoint presence */
-    for(int i=0; i<Debugger_Info.BreakListCount; i++)
+    int index = 0;
+    while((index < ctx->Debugger.BreakListCount) && (addr != ctx->Debugger.BreakList[index].Addr))
     {
-        if(addr == Debugger_Info.BreakListAddr[i])
+        index ++;
+    }
+
+    /* Register breakpoint if not found, otherwise replace its condition */
+    if(index == DEBUGGER_BREAKPOINT_COUNT)
+    {
+        printf("Cannot register more than %d breakpoint.\n", DEBUGGER_BREAKPOINT_COUNT);
+    }
+    else
+    {
+        if(index == ctx->Debugger.BreakListCount)
         {
-            found = 1;
-            break;
+            ctx->Debugger.BreakListCount ++;
+            Cpu_SetBreakpoint(ctx, addr, true);
         }
+        ctx->Debugger.BreakList[index].Addr = addr;
+        ctx->Debugger.BreakList[index].Condition = cond;
     }
-   
-    /* Register breakpoint if not found */
-    if(found == 0)
+
+    /* Print breakpoint list */
+    Debugger_PrintBreakpoint(ctx);
+}
+
+/**
+ * Set watchpoint
+ */
+static void Debugger_CommandWatch(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if((argc < 2) || (argc > 4))
     {
-        Debugger_Info.BreakListAddr[Debugger_Info.BreakListCount] = addr;
-        Debugger_Info.BreakListCount ++;
+        printf("Wrong number of argument\n");
+        return;
     }
 
-    /* Print breakpoint list */
-    printf("Breakpoint list:\n");
-    for(int i=0; i<Debugger_Info.BreakListCount; i++)
+    /* Get watched address, access and data */
+    uint16_t addr  = (uint16_t)strtol(argv[1], NULL, 0);
+    uint8_t kind   = MEMORY_WATCH_WRITE;
+    uint16_t value = MEMORY_WATCH_ANY;
+    if(argc >= 3)
+    {
+        kind = MEMORY_WATCH_NONE;
+        for(int i=0; i<(int)ARRAY_SIZE(Debugger_WatchName); i++)
+        {
+            if(strcmp(argv[2], Debugger_WatchName[i]) == 0)
+            {
+                kind = i;
+            }
+        }
+    }
+    if(argc == 4)
+    {
+        value = (uint8_t)strtol(argv[3], NULL, 0);
+    }
+
+    if(Memory_SetWatch(ctx, addr, kind, value) != 0)
     {
-        printf("#%d: 0x%04x\n", i, Debugger_Info.BreakListAddr[i]);
+        printf("Cannot register the watchpoint. (access: r|w|rw, max: %d)\n", MEMORY_WATCH_COUNT);
     }
+
+    /* Print watchpoint list */
+    Debugger_PrintWatchpoint(ctx);
 }
 
 /**
- * Clear all breakpoint
+ * Clear all breakpoint and watchpoint
  */
-static void Debugger_CommandClear(int argc, char const * argv[])
+static void Debugger_CommandClear(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     /* Unused parameter */
     (void) argc;
     (void) argv;
 
-    Debugger_Info.BreakListCount = 0;
-    printf("Breakpoint removed.\n");
+    for(int i=0; i<ctx->Debugger.BreakListCount; i++)
+    {
+        Cpu_SetBreakpoint(ctx, ctx->Debugger.BreakList[i].Addr, false);
+    }
+    ctx->Debugger.BreakListCount = 0;
+    Memory_ClearWatch(ctx);
+    printf("Breakpoint and watchpoint removed.\n");
 }
 
 
 /**
  * Print Memory
  */
-static void Debugger_CommandMem(int argc, char const * argv[])
+static void Debugger_CommandMem(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     if((argc != 2) && (argc != 3))
     {
@@ -547,29 +1237,93 @@ static void Debugger_CommandMem(int argc, char const * argv[])
     /* Get the memory addresss and size */
     uint16_t addr = (uint16_t)strtol(argv[1], NULL, 0);
 
-    Debugger_Info.MemoryAddress = addr;
-    Debugger_PrintState();
+    ctx->Debugger.MemoryAddress = addr;
+    Debugger_PrintState(ctx);
 }
 
 /**
  * Print CPU
  */
-static void Debugger_CommandCpu(int argc, char const * argv[])
+static void Debugger_CommandCpu(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     /* Unused parameter */
     (void) argc;
     (void) argv;
 
     /* Print CPU */
-    Debugger_PrintState();
+    Debugger_PrintState(ctx);
+}
+
+/**
+ * Start, stop or flush the memory access trace
+ */
+static void Debugger_CommandTrace(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    if(argc == 1)
+    {
+        uint64_t const count = Trace_Flush(ctx);
+        printf("Trace flushed: %" PRIu64 " record (%" PRIu64 " lost).\n", count, ctx->Trace.Lost);
+    }
+    else if(strcmp(argv[1], "off") == 0)
+    {
+        Trace_Stop(ctx);
+        printf("Trace stopped.\n");
+    }
+    else if(Trace_Start(ctx, argv[1], true) == 0)
+    {
+        printf("Tracing memory access to %s.\n", argv[1]);
+    }
+}
+
+/**
+ * Save the framebuffer
+ */
+static void Debugger_CommandScreen(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc != 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    if(Ppu_SaveFrame(ctx, argv[1]) == 0)
+    {
+        printf("Frame %" PRIu64 " saved to %s.\n", Ppu_GetFrameCount(ctx), argv[1]);
+    }
+}
+
+/**
+ * Print or set the render interval
+ */
+static void Debugger_CommandFrame(Emu_Context_t * ctx, int argc, char const * argv[])
+{
+    if(argc > 2)
+    {
+        printf("Wrong number of argument\n");
+        return;
+    }
+
+    if(argc == 2)
+    {
+        Ppu_SetRenderInterval(ctx, strtoul(argv[1], NULL, 0));
+    }
+
+    printf("Frame %" PRIu64 ", render interval %" PRIu32 ".\n", Ppu_GetFrameCount(ctx), ctx->Ppu.RenderInterval);
 }
 
 /**
  * Print help
  */
-static void Debugger_CommandHelp(int argc, char const * argv[])
+static void Debugger_CommandHelp(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     /* Unused parameter */
+    (void) ctx;
     (void) argc;
     (void) argv;
 
@@ -588,13 +1342,13 @@ static void Debugger_CommandHelp(int argc, char const * argv[])
 /**
  * Quit the debugger
  */
-static void Debugger_CommandQuit(int argc, char const * argv[])
+static void Debugger_CommandQuit(Emu_Context_t * ctx, int argc, char const * argv[])
 {
     /* Unused parameter */
     (void) argc;
     (void) argv;
 
     /* Make the program exit */
-    Debugger_Info.State = DEBUGGER_STATE_EXIT;
+    ctx->Debugger.State = DEBUGGER_STATE_EXIT;
 }
 
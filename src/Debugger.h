@@ -81,10 +81,85 @@
 #endif
 
 
+/** Max number of breakpoint */
+#define DEBUGGER_BREAKPOINT_COUNT   256
+
+
 /******************************************************/
 /* Type                                               */
 /******************************************************/
 
+/**
+ * Debugger state type
+ */
+typedef enum tagDebugger_State_e
+{
+    DEBUGGER_STATE_RUN,     /**< Run wihtout interruption */
+    DEBUGGER_STATE_BREAK,   /**< Pause the program for debug */
+    DEBUGGER_STATE_EXIT     /**< Quit the debugger */
+} Debugger_State_e;
+
+/**
+ * Breakpoint condition operand source type
+ */
+typedef enum tagDebugger_Source_e
+{
+    DEBUGGER_SOURCE_NONE,   /**< Unconditional breakpoint */
+    DEBUGGER_SOURCE_REG8,   /**< 8 bit register (Cpu_RegName_e) */
+    DEBUGGER_SOURCE_REG16,  /**< 16 bit register (Cpu_RegName_e) */
+    DEBUGGER_SOURCE_MEMORY  /**< Memory Byte */
+} Debugger_Source_e;
+
+/**
+ * Breakpoint condition comparison type
+ */
+typedef enum tagDebugger_Compare_e
+{
+    DEBUGGER_COMPARE_EQ,    /**< == */
+    DEBUGGER_COMPARE_NE,    /**< != */
+    DEBUGGER_COMPARE_LT,    /**< < */
+    DEBUGGER_COMPARE_LE,    /**< <= */
+    DEBUGGER_COMPARE_GT,    /**< > */
+    DEBUGGER_COMPARE_GE     /**< >= */
+} Debugger_Compare_e;
+
+/**
+ * Breakpoint condition compiled from "<reg|(addr)> <op> <value>"
+ */
+typedef struct tagDebugger_Condition_t
+{
+    uint8_t Source;     /**< Debugger_Source_e operand source */
+    uint8_t Compare;    /**< Debugger_Compare_e comparison */
+    uint16_t Operand;   /**< Register id or memory address */
+    uint16_t Value;     /**< Value to compare with */
+} Debugger_Condition_t;
+
+/**
+ * Breakpoint type
+ */
+typedef struct tagDebugger_Breakpoint_t
+{
+    uint16_t Addr;                      /**< Instruction address */
+    Debugger_Condition_t Condition;     /**< Condition evaluated when the address is reached */
+} Debugger_Breakpoint_t;
+
+/**
+ * Debugger info type
+ * @note Breakpoint address are also set in the CPU bitmap, the list is only
+ *       searched on a hit
+ */
+typedef struct tagDebugger_Info_t
+{
+    Debugger_State_e State;                                     /**< Debugger state */
+    int MemoryAddress;                                          /**< Memory address to display */
+    int BreakListCount;                                         /**< Breakpoint set count */
+    Debugger_Breakpoint_t BreakList[DEBUGGER_BREAKPOINT_COUNT]; /**< Breakpoint list */
+    char const * CartridgeFile;                                 /**< Cartridge inserted at reset (NULL if none) */
+} Debugger_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
 
 /******************************************************/
 /* Prototype                                          */
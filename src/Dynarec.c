@@ -0,0 +1,1160 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#if defined(CPU_DYNAREC)
+
+#if !defined(__x86_64__)
+#  error "CPU_DYNAREC requires an x86-64 host"
+#endif
+
+/* Required for MAP_ANONYMOUS */
+#define _DEFAULT_SOURCE
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <Emu.h>
+#include <Dynarec.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Native code buffer size */
+#define DYNAREC_BUFFER_SIZE     (4 * 1024 * 1024)
+
+/** Worst case native code size of one instruction */
+#define DYNAREC_INST_SIZE_MAX   256
+
+/** Worst case native code size of the block prologue and epilogue */
+#define DYNAREC_BLOCK_SIZE_MAX  128
+
+/** Max number of instruction in a block */
+#define DYNAREC_BLOCK_LENGTH    64
+
+/** Unmapped register marker */
+#define DYNAREC_R_NONE          0xFF
+
+/** Operand marker: immediate operand of the instruction */
+#define DYNAREC_R_IMM           0xFE
+
+/** Operand marker: memory data zero extended to edi */
+#define DYNAREC_R_MEM           0xFD
+
+/** Pending flag operation left by the interpreter (unknown at translation) */
+#define DYNAREC_FLAG_UNKNOWN    0xFF
+
+/** Flag operation defining the carry: evaluated before an operation keeping it (INC/DEC/BIT) */
+#define DYNAREC_FLAG_CARRY      ((1 << CPU_FLAG_OP_ADD) | (1 << CPU_FLAG_OP_SUB) | (1 << CPU_FLAG_OP_AND) | \
+                                 (1 << CPU_FLAG_OP_LOGIC) | (1 << CPU_FLAG_OP_ADD16) | (1 << CPU_FLAG_OP_ROT) | \
+                                 (1 << CPU_FLAG_OP_ROTA))
+
+/** Extra cycle of a taken conditional jump (JR F,N) */
+#define DYNAREC_TAKEN_CYCLE     4
+
+/**
+ * Get the byte offset of a register in the emulator context
+ * @param reg The 16 bit register Cpu_RegName_e id
+ */
+#define DYNAREC_OFFSET(reg)     ((uint8_t)(offsetof(Emu_Context_t, Cpu.Reg) + (reg) * sizeof(Cpu_Reg16_t)))
+
+/**
+ * Get the byte offset of a 8 bit register in the emulator context
+ * @param reg The 8 bit register Cpu_RegName_e id
+ */
+#define DYNAREC_OFFSET8(reg)    ((uint8_t)(offsetof(Emu_Context_t, Cpu.Reg) + (reg)))
+
+/**
+ * Get the 64 bit immediate of a C function
+ * @param function The function called by the native code
+ */
+#define DYNAREC_ADDR(function)  ((uint64_t)(uintptr_t)(function))
+
+/**
+ * Get the byte offset of a lazy flag field in the emulator context
+ * @param field The Cpu_Flag_t member
+ */
+#define DYNAREC_FLAG_OFFSET(field)  ((uint8_t)offsetof(Emu_Context_t, Cpu.Flag.field))
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** x86-64 register encoding */
+typedef enum tagDynarec_Host_e
+{
+    DYNAREC_H_AX = 0,   /**< AF (AL:F, AH:A) */
+    DYNAREC_H_CX = 1,   /**< DE (CL:E, CH:D) */
+    DYNAREC_H_DX = 2,   /**< HL (DL:L, DH:H) */
+    DYNAREC_H_BX = 3,   /**< BC (BL:C, BH:B) */
+    DYNAREC_H_AH = 4,   /**< A register */
+    DYNAREC_H_CH = 5,   /**< D register */
+    DYNAREC_H_DH = 6,   /**< H register */
+    DYNAREC_H_BH = 7,   /**< B register */
+    DYNAREC_H_AL = 0,   /**< F register */
+    DYNAREC_H_CL = 1,   /**< E register */
+    DYNAREC_H_DL = 2,   /**< L register */
+    DYNAREC_H_BL = 3    /**< C register */
+} Dynarec_Host_e;
+
+/** x86-64 jump condition code */
+typedef enum tagDynarec_Cond_e
+{
+    DYNAREC_CC_E      = 0x04,   /**< Equal (ZF set) */
+    DYNAREC_CC_NE     = 0x05,   /**< Not equal (ZF clear) */
+    DYNAREC_CC_ALWAYS = 0x10,   /**< Always (inverse of DYNAREC_CC_NEVER) */
+    DYNAREC_CC_NEVER  = 0x11    /**< Never (inverse of DYNAREC_CC_ALWAYS) */
+} Dynarec_Cond_e;
+
+/** Block translation state */
+typedef struct tagDynarec_State_t
+{
+    uint32_t Cycle;                             /**< Cycle of the native instruction not added to r12d yet */
+    bool PcSet;                                 /**< The last instruction already set PC */
+    uint8_t FlagOp;                             /**< Cpu_FlagOp_e operation pending (DYNAREC_FLAG_UNKNOWN: set by the interpreter) */
+    int ExitCount;                              /**< Number of exit with the register file up to date */
+    int StoreCount;                             /**< Number of exit with the state in the host register */
+    uint8_t * Exit[DYNAREC_BLOCK_LENGTH];       /**< Jump offset to patch with the epilogue */
+    uint8_t * ExitStore[DYNAREC_BLOCK_LENGTH];  /**< Jump offset to patch with the register store before the epilogue */
+} Dynarec_State_t;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/* Code emission */
+static inline void Dynarec_Emit8(Dynarec_Info_t * info, uint8_t data);
+static inline void Dynarec_Emit16(Dynarec_Info_t * info, uint16_t data);
+static inline void Dynarec_Emit32(Dynarec_Info_t * info, uint32_t data);
+static inline void Dynarec_Emit64(Dynarec_Info_t * info, uint64_t data);
+static uint8_t * Dynarec_EmitJump(Dynarec_Info_t * info, uint8_t cond);
+static void Dynarec_PatchJump(uint8_t * patch, uint8_t const * target);
+static void Dynarec_EmitLoad(Dynarec_Info_t * info);
+static void Dynarec_EmitStore(Dynarec_Info_t * info);
+static void Dynarec_EmitPc(Dynarec_Info_t * info, uint16_t pc);
+static void Dynarec_EmitCycle(Dynarec_Info_t * info, Dynarec_State_t * state);
+static void Dynarec_EmitCall(Dynarec_Info_t * info, uint64_t function);
+static void Dynarec_EmitCheck(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, bool stored);
+static void Dynarec_EmitSyncFlag(Dynarec_Info_t * info, Dynarec_State_t * state);
+static void Dynarec_EmitCarryFlag(Dynarec_Info_t * info, Dynarec_State_t * state);
+static uint8_t Dynarec_EmitCondition(Dynarec_Info_t * info, Dynarec_State_t * state, int cc);
+static uint8_t * Dynarec_EmitPage(Dynarec_Info_t * info, uint32_t table);
+static void Dynarec_EmitRead(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, uint8_t dst, bool last);
+static void Dynarec_EmitWrite(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, uint8_t src);
+static void Dynarec_EmitAlu(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, int alu, uint8_t src);
+static bool Dynarec_EmitNative(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst);
+static void Dynarec_EmitInterpret(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+/** Host register of each 16 bit register (AF, BC, DE, HL) */
+static uint8_t const Dynarec_Reg16[] =
+{
+    DYNAREC_H_AX, DYNAREC_H_BX, DYNAREC_H_CX, DYNAREC_H_DX
+};
+
+/** Host register of each 8 bit register in opcode encoding order (B, C, D, E, H, L, (HL), A) */
+static uint8_t const Dynarec_Reg8[] =
+{
+    DYNAREC_H_BH, DYNAREC_H_BL, DYNAREC_H_CH, DYNAREC_H_CL,
+    DYNAREC_H_DH, DYNAREC_H_DL, DYNAREC_R_NONE, DYNAREC_H_AH
+};
+
+/** 8 bit register Cpu_RegName_e id of each host 8 bit register (AL, CL, DL, BL, AH, CH, DH, BH) */
+static uint8_t const Dynarec_Host8[] =
+{
+    CPU_R_F, CPU_R_E, CPU_R_L, CPU_R_C, CPU_R_A, CPU_R_D, CPU_R_H, CPU_R_B
+};
+
+/* Register are addressed with a 8 bit displacement from the context */
+_Static_assert(offsetof(Emu_Context_t, Cpu.Reg) + CPU_REG_NUM * sizeof(Cpu_Reg16_t) <= 0x80,
+               "CPU register must be the first member of the emulator context");
+_Static_assert(offsetof(Emu_Context_t, Cpu.Flag) + sizeof(Cpu_Flag_t) <= 0x80,
+               "CPU lazy flag must follow the CPU register in the emulator context");
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+int Dynarec_Initialize(Dynarec_Info_t * info)
+{
+    if(info->Buffer == NULL)
+    {
+        void * buffer = mmap(NULL, DYNAREC_BUFFER_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(buffer == MAP_FAILED)
+        {
+            DEBUGGER_WARNING("Dynarec disabled: cannot map code buffer\n");
+            return -1;
+        }
+
+        info->Buffer = buffer;
+    }
+
+    Dynarec_Flush(info);
+    return 0;
+}
+
+
+void Dynarec_Finalize(Dynarec_Info_t * info)
+{
+    if(info->Buffer != NULL)
+    {
+        munmap(info->Buffer, DYNAREC_BUFFER_SIZE);
+        info->Buffer = NULL;
+    }
+}
+
+
+void Dynarec_Flush(Dynarec_Info_t * info)
+{
+    info->Used = 0;
+}
+
+
+Dynarec_Block_t Dynarec_Translate(Dynarec_Info_t * info, Dynarec_Inst_t const * inst, int count,
+                                  uint8_t const * valid, uint8_t const * code)
+{
+    Dynarec_State_t state;
+    state.Cycle = 0;
+    state.PcSet = false;
+    state.FlagOp = DYNAREC_FLAG_UNKNOWN;
+    state.ExitCount = 0;
+    state.StoreCount = 0;
+
+    /* Check remaining space */
+    size_t const size_max = DYNAREC_BLOCK_SIZE_MAX + count * DYNAREC_INST_SIZE_MAX;
+    if((info->Buffer == NULL) || (count > DYNAREC_BLOCK_LENGTH) ||
+       (info->Used + size_max > DYNAREC_BUFFER_SIZE))
+    {
+        return NULL;
+    }
+
+    uint8_t * const start = info->Buffer + info->Used;
+    info->Ptr = start;
+
+    /* Prologue: push rbx; push rbp; push r12; push r13; push r14 (the stack stay 16 byte aligned for the call) */
+    Dynarec_Emit8(info, 0x53);
+    Dynarec_Emit8(info, 0x55);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x54);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x55);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x56);
+
+    /* mov rbp,rdi; xor r12d,r12d; mov r13,valid; mov r14,code */
+    Dynarec_Emit8(info, 0x48); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0xFD);
+    Dynarec_Emit8(info, 0x45); Dynarec_Emit8(info, 0x31); Dynarec_Emit8(info, 0xE4);
+    Dynarec_Emit8(info, 0x49); Dynarec_Emit8(info, 0xBD); Dynarec_Emit64(info, DYNAREC_ADDR(valid));
+    Dynarec_Emit8(info, 0x49); Dynarec_Emit8(info, 0xBE); Dynarec_Emit64(info, DYNAREC_ADDR(code));
+    Dynarec_EmitLoad(info);
+
+    for(int i=0; i<count; i++)
+    {
+        state.PcSet = false;
+        if(Dynarec_EmitNative(info, &state, &inst[i]))
+        {
+            state.Cycle += inst[i].Cycle;
+            continue;
+        }
+
+        /* Account the native instruction executed so far */
+        Dynarec_EmitCycle(info, &state);
+        Dynarec_EmitInterpret(info, &state, &inst[i]);
+    }
+
+    /* Account the remaining native instruction */
+    Dynarec_EmitCycle(info, &state);
+
+    /* The last interpreted instruction or native jump already set PC */
+    if(!state.PcSet)
+    {
+        Dynarec_EmitPc(info, inst[count - 1].Next);
+    }
+
+    /* Exit with the state in the host register */
+    uint8_t * const exit_store = info->Ptr;
+    Dynarec_EmitStore(info);
+
+    /* Epilogue: mov eax,r12d; pop r14; pop r13; pop r12; pop rbp; pop rbx; ret */
+    uint8_t * const exit = info->Ptr;
+    Dynarec_Emit8(info, 0x44); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0xE0);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x5E);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x5D);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x5C);
+    Dynarec_Emit8(info, 0x5D);
+    Dynarec_Emit8(info, 0x5B);
+    Dynarec_Emit8(info, 0xC3);
+
+    /* Resolve the invalidated block exit */
+    for(int i=0; i<state.ExitCount; i++)
+    {
+        Dynarec_PatchJump(state.Exit[i], exit);
+    }
+    for(int i=0; i<state.StoreCount; i++)
+    {
+        Dynarec_PatchJump(state.ExitStore[i], exit_store);
+    }
+
+    info->Used += info->Ptr - start;
+
+    return (Dynarec_Block_t)(void *)start;
+}
+
+
+static inline void Dynarec_Emit8(Dynarec_Info_t * info, uint8_t data)
+{
+    *info->Ptr++ = data;
+}
+
+
+static inline void Dynarec_Emit16(Dynarec_Info_t * info, uint16_t data)
+{
+    Dynarec_Emit8(info, (uint8_t)(data));
+    Dynarec_Emit8(info, (uint8_t)(data >> 8));
+}
+
+
+static inline void Dynarec_Emit32(Dynarec_Info_t * info, uint32_t data)
+{
+    Dynarec_Emit16(info, (uint16_t)(data));
+    Dynarec_Emit16(info, (uint16_t)(data >> 16));
+}
+
+
+static inline void Dynarec_Emit64(Dynarec_Info_t * info, uint64_t data)
+{
+    Dynarec_Emit32(info, (uint32_t)(data));
+    Dynarec_Emit32(info, (uint32_t)(data >> 32));
+}
+
+
+/**
+ * Emit a forward jump
+ * @param cond The Dynarec_Cond_e condition (DYNAREC_CC_ALWAYS for jmp)
+ * @return The address of the 32 bit offset to patch
+ */
+static uint8_t * Dynarec_EmitJump(Dynarec_Info_t * info, uint8_t cond)
+{
+    /* jmp rel32 or jcc rel32 */
+    if(cond == DYNAREC_CC_ALWAYS)
+    {
+        Dynarec_Emit8(info, 0xE9);
+    }
+    else
+    {
+        Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0x80 | cond);
+    }
+
+    uint8_t * const patch = info->Ptr;
+    Dynarec_Emit32(info, 0);
+
+    return patch;
+}
+
+
+/**
+ * Resolve a forward jump
+ * @param patch The 32 bit offset returned by Dynarec_EmitJump
+ * @param target The jump target
+ */
+static void Dynarec_PatchJump(uint8_t * patch, uint8_t const * target)
+{
+    int32_t const rel = (int32_t)(target - (patch + 4));
+    patch[0] = (uint8_t)(rel);
+    patch[1] = (uint8_t)(rel >> 8);
+    patch[2] = (uint8_t)(rel >> 16);
+    patch[3] = (uint8_t)(rel >> 24);
+}
+
+
+/**
+ * Load AF, BC, DE, HL from the register file to the host register
+ */
+static void Dynarec_EmitLoad(Dynarec_Info_t * info)
+{
+    /* mov r16,[rbp+disp8] */
+    for(int i=CPU_R_AF; i<=CPU_R_HL; i++)
+    {
+        Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x8B);
+        Dynarec_Emit8(info, 0x45 | (Dynarec_Reg16[i] << 3));
+        Dynarec_Emit8(info, DYNAREC_OFFSET(i));
+    }
+}
+
+
+/**
+ * Store AF, BC, DE, HL from the host register to the register file
+ */
+static void Dynarec_EmitStore(Dynarec_Info_t * info)
+{
+    /* mov [rbp+disp8],r16 */
+    for(int i=CPU_R_AF; i<=CPU_R_HL; i++)
+    {
+        Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x89);
+        Dynarec_Emit8(info, 0x45 | (Dynarec_Reg16[i] << 3));
+        Dynarec_Emit8(info, DYNAREC_OFFSET(i));
+    }
+}
+
+
+/**
+ * Set PC in the register file
+ * @param pc The PC value
+ */
+static void Dynarec_EmitPc(Dynarec_Info_t * info, uint16_t pc)
+{
+    /* mov word [rbp+PC],imm16 */
+    Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0xC7); Dynarec_Emit8(info, 0x45);
+    Dynarec_Emit8(info, DYNAREC_OFFSET(CPU_R_PC));
+    Dynarec_Emit16(info, pc);
+}
+
+
+/**
+ * Add the cycle of the native instruction executed so far to the block cycle count
+ */
+static void Dynarec_EmitCycle(Dynarec_Info_t * info, Dynarec_State_t * state)
+{
+    /* add r12d,imm32 */
+    if(state->Cycle != 0)
+    {
+        Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x81); Dynarec_Emit8(info, 0xC4);
+        Dynarec_Emit32(info, state->Cycle);
+        state->Cycle = 0;
+    }
+}
+
+
+/**
+ * Emit a call to a C function with the context as first parameter, the other are set in esi/edx
+ * @param function The function address
+ * @note The host register must be stored first, the call clobber them
+ */
+static void Dynarec_EmitCall(Dynarec_Info_t * info, uint64_t function)
+{
+    /* mov rdi,rbp; mov rax,function; call rax */
+    Dynarec_Emit8(info, 0x48); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0xEF);
+    Dynarec_Emit8(info, 0x48); Dynarec_Emit8(info, 0xB8); Dynarec_Emit64(info, function);
+    Dynarec_Emit8(info, 0xFF); Dynarec_Emit8(info, 0xD0);
+}
+
+
+/**
+ * Leave the block if a handler called by the instruction invalidated it (self-modifying write, watchpoint)
+ * @param inst The instruction calling the handler
+ * @param stored true if the register file is up to date, false if the state is in the host register
+ */
+static void Dynarec_EmitCheck(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, bool stored)
+{
+    /* cmp byte [r13],0; jne valid; add r12d,cycle; jmp exit */
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0x7D);
+    Dynarec_Emit8(info, 0x00); Dynarec_Emit8(info, 0x00);
+    Dynarec_Emit8(info, 0x75); Dynarec_Emit8(info, 0x0C);
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x81); Dynarec_Emit8(info, 0xC4);
+    Dynarec_Emit32(info, state->Cycle + inst->Cycle);
+
+    uint8_t * const patch = Dynarec_EmitJump(info, DYNAREC_CC_ALWAYS);
+    if(stored)
+    {
+        state->Exit[state->ExitCount ++] = patch;
+    }
+    else
+    {
+        state->ExitStore[state->StoreCount ++] = patch;
+    }
+}
+
+
+/**
+ * Evaluate the pending flag operation to the F register (AL)
+ */
+static void Dynarec_EmitSyncFlag(Dynarec_Info_t * info, Dynarec_State_t * state)
+{
+    /* cmp byte [rbp+Flag.Op],CPU_FLAG_OP_NONE; je synced; Cpu_SyncFlag(ctx) */
+    Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0x7D);
+    Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Op)); Dynarec_Emit8(info, CPU_FLAG_OP_NONE);
+    uint8_t * const synced = Dynarec_EmitJump(info, DYNAREC_CC_E);
+
+    Dynarec_EmitStore(info);
+    Dynarec_EmitCall(info, DYNAREC_ADDR(Cpu_SyncFlag));
+    Dynarec_EmitLoad(info);
+
+    Dynarec_PatchJump(synced, info->Ptr);
+    state->FlagOp = CPU_FLAG_OP_NONE;
+}
+
+
+/**
+ * Evaluate the pending carry to the F register (AL) before an operation keeping it (INC/DEC/BIT)
+ * @note Same as the Cpu_SetFlag synchronization, ZNH are redefined by the new operation
+ */
+static void Dynarec_EmitCarryFlag(Dynarec_Info_t * info, Dynarec_State_t * state)
+{
+    switch(state->FlagOp)
+    {
+        case CPU_FLAG_OP_NONE:
+        case CPU_FLAG_OP_INC:
+        case CPU_FLAG_OP_DEC:
+        case CPU_FLAG_OP_BIT:
+            /* F register carry is up to date */
+            break;
+
+        case CPU_FLAG_OP_ADD:
+        case CPU_FLAG_OP_SUB:
+            /* and al,~CPU_F_C; test byte [rbp+Flag.Result+1],1; jz done; or al,CPU_F_C */
+            Dynarec_Emit8(info, 0x24); Dynarec_Emit8(info, (uint8_t)~CPU_F_C);
+            Dynarec_Emit8(info, 0xF6); Dynarec_Emit8(info, 0x45);
+            Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result) + 1); Dynarec_Emit8(info, 0x01);
+            Dynarec_Emit8(info, 0x74); Dynarec_Emit8(info, 0x02);
+            Dynarec_Emit8(info, 0x0C); Dynarec_Emit8(info, CPU_F_C);
+            break;
+
+        case CPU_FLAG_OP_AND:
+        case CPU_FLAG_OP_LOGIC:
+            /* and al,~CPU_F_C */
+            Dynarec_Emit8(info, 0x24); Dynarec_Emit8(info, (uint8_t)~CPU_F_C);
+            break;
+
+        default:
+        {
+            /* Left by the interpreter: movzx esi,byte [rbp+Flag.Op]; mov edi,DYNAREC_FLAG_CARRY; bt edi,esi; jnc done */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0x75);
+            Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Op));
+            Dynarec_Emit8(info, 0xBF); Dynarec_Emit32(info, DYNAREC_FLAG_CARRY);
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xA3); Dynarec_Emit8(info, 0xF7);
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0x83);
+            uint8_t * const done = info->Ptr;
+            Dynarec_Emit32(info, 0);
+
+            Dynarec_EmitStore(info);
+            Dynarec_EmitCall(info, DYNAREC_ADDR(Cpu_SyncFlag));
+            Dynarec_EmitLoad(info);
+
+            Dynarec_PatchJump(done, info->Ptr);
+            break;
+        }
+    }
+}
+
+
+/**
+ * Test a jump condition
+ * @param cc The condition (opcode bit 3-4: NZ, Z, NC, C)
+ * @return The Dynarec_Cond_e condition of a taken jump
+ */
+static uint8_t Dynarec_EmitCondition(Dynarec_Info_t * info, Dynarec_State_t * state, int cc)
+{
+    bool const carry = (cc & 0x02) != 0;
+    uint8_t set = DYNAREC_CC_NE;
+
+    /* Only the F register hold the flag (the native code never leave a rotation or ADD16 pending) */
+    if((state->FlagOp == DYNAREC_FLAG_UNKNOWN) || (state->FlagOp == CPU_FLAG_OP_ADD16) ||
+       (state->FlagOp == CPU_FLAG_OP_ROT) || (state->FlagOp == CPU_FLAG_OP_ROTA))
+    {
+        Dynarec_EmitSyncFlag(info, state);
+    }
+
+    if(!carry)
+    {
+        switch(state->FlagOp)
+        {
+            case CPU_FLAG_OP_NONE:
+                /* test al,CPU_F_Z */
+                Dynarec_Emit8(info, 0xA8); Dynarec_Emit8(info, CPU_F_Z);
+                set = DYNAREC_CC_NE;
+                break;
+            default:
+                /* Z is set by a null result: cmp byte [rbp+Flag.Result],0 */
+                Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0x7D);
+                Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result)); Dynarec_Emit8(info, 0x00);
+                set = DYNAREC_CC_E;
+                break;
+        }
+    }
+    else
+    {
+        switch(state->FlagOp)
+        {
+            case CPU_FLAG_OP_AND:
+            case CPU_FLAG_OP_LOGIC:
+                set = DYNAREC_CC_NEVER;
+                break;
+            case CPU_FLAG_OP_ADD:
+            case CPU_FLAG_OP_SUB:
+                /* Carry out in result bit 8: test byte [rbp+Flag.Result+1],1 */
+                Dynarec_Emit8(info, 0xF6); Dynarec_Emit8(info, 0x45);
+                Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result) + 1); Dynarec_Emit8(info, 0x01);
+                set = DYNAREC_CC_NE;
+                break;
+            default:
+                /* test al,CPU_F_C */
+                Dynarec_Emit8(info, 0xA8); Dynarec_Emit8(info, CPU_F_C);
+                set = DYNAREC_CC_NE;
+                break;
+        }
+    }
+
+    /* NZ and NC jump if the flag is clear */
+    return ((cc & 0x01) != 0) ? set : (set ^ 1);
+}
+
+
+/**
+ * Get the host memory pointer of the page of the address in esi to rdi
+ * @param table The offset of the page table (Memory.Read or Memory.Write) in the context
+ * @return The jump offset to patch with the slow path (page without host memory)
+ */
+static uint8_t * Dynarec_EmitPage(Dynarec_Info_t * info, uint32_t table)
+{
+    /* mov edi,esi; shr edi,8; mov rdi,[rbp+rdi*8+table]; test rdi,rdi; jz slow */
+    Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0xF7);
+    Dynarec_Emit8(info, 0xC1); Dynarec_Emit8(info, 0xEF); Dynarec_Emit8(info, 0x08);
+    Dynarec_Emit8(info, 0x48); Dynarec_Emit8(info, 0x8B); Dynarec_Emit8(info, 0xBC); Dynarec_Emit8(info, 0xFD);
+    Dynarec_Emit32(info, table);
+    Dynarec_Emit8(info, 0x48); Dynarec_Emit8(info, 0x85); Dynarec_Emit8(info, 0xFF);
+    uint8_t * const slow = Dynarec_EmitJump(info, DYNAREC_CC_E);
+
+    /* movzx r8d,sil; add rdi,r8 */
+    Dynarec_Emit8(info, 0x44); Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xC6);
+    Dynarec_Emit8(info, 0x4C); Dynarec_Emit8(info, 0x01); Dynarec_Emit8(info, 0xC7);
+
+    return slow;
+}
+
+
+/**
+ * Read the memory at the address in esi, as Memory_Read
+ * @param inst The reading instruction
+ * @param dst The host 8 bit register receiving the data, DYNAREC_R_MEM to zero extend it to edi
+ * @param last true if the read complete the instruction, otherwise the block is checked after it (Dynarec_EmitCheck)
+ */
+static void Dynarec_EmitRead(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, uint8_t dst, bool last)
+{
+    uint8_t * slow[2];
+    int count = 0;
+
+#if !defined(TRACE_DISABLED)
+    /* Traced access: cmp byte [rbp+Trace.Enabled],0; jne slow */
+    Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0xBD);
+    Dynarec_Emit32(info, offsetof(Emu_Context_t, Trace.Enabled)); Dynarec_Emit8(info, 0x00);
+    slow[count ++] = Dynarec_EmitJump(info, DYNAREC_CC_NE);
+#endif
+
+    /* Fast path: mov r8,[rdi] or movzx edi,byte [rdi] */
+    slow[count ++] = Dynarec_EmitPage(info, offsetof(Emu_Context_t, Memory.Read));
+    if(dst == DYNAREC_R_MEM)
+    {
+        Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0x3F);
+    }
+    else
+    {
+        Dynarec_Emit8(info, 0x8A); Dynarec_Emit8(info, (dst << 3) | 0x07);
+    }
+    uint8_t * const done = Dynarec_EmitJump(info, DYNAREC_CC_ALWAYS);
+
+    /* Slow path: read handler with the register file up to date */
+    for(int i=0; i<count; i++)
+    {
+        Dynarec_PatchJump(slow[i], info->Ptr);
+    }
+    Dynarec_EmitStore(info);
+    Dynarec_EmitPc(info, inst->Next);
+    Dynarec_EmitCall(info, DYNAREC_ADDR(Memory_Read));
+
+    /* movzx edi,al or mov [rbp+reg],al */
+    if(dst == DYNAREC_R_MEM)
+    {
+        Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xF8);
+    }
+    else
+    {
+        Dynarec_Emit8(info, 0x88); Dynarec_Emit8(info, 0x45); Dynarec_Emit8(info, DYNAREC_OFFSET8(Dynarec_Host8[dst]));
+    }
+
+    if(last)
+    {
+        Dynarec_EmitCheck(info, state, inst, true);
+    }
+    Dynarec_EmitLoad(info);
+
+    Dynarec_PatchJump(done, info->Ptr);
+}
+
+
+/**
+ * Write the memory at the address in esi, as Memory_Write
+ * @param inst The writing instruction (the write complete it)
+ * @param src The host 8 bit register to write, DYNAREC_R_IMM for the immediate operand
+ */
+static void Dynarec_EmitWrite(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, uint8_t src)
+{
+    uint8_t * slow[3];
+    int count = 0;
+
+#if !defined(TRACE_DISABLED)
+    /* Traced access: cmp byte [rbp+Trace.Enabled],0; jne slow */
+    Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0xBD);
+    Dynarec_Emit32(info, offsetof(Emu_Context_t, Trace.Enabled)); Dynarec_Emit8(info, 0x00);
+    slow[count ++] = Dynarec_EmitJump(info, DYNAREC_CC_NE);
+#endif
+
+    /* Cached code must be invalidated by Memory_Write: cmp byte [r14+rsi],0; jne slow */
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0x3C); Dynarec_Emit8(info, 0x36);
+    Dynarec_Emit8(info, 0x00);
+    slow[count ++] = Dynarec_EmitJump(info, DYNAREC_CC_NE);
+
+    /* Fast path: mov [rdi],r8 or mov byte [rdi],imm8 */
+    slow[count ++] = Dynarec_EmitPage(info, offsetof(Emu_Context_t, Memory.Write));
+    if(src == DYNAREC_R_IMM)
+    {
+        Dynarec_Emit8(info, 0xC6); Dynarec_Emit8(info, 0x07); Dynarec_Emit8(info, (uint8_t)inst->Operand);
+    }
+    else
+    {
+        Dynarec_Emit8(info, 0x88); Dynarec_Emit8(info, (src << 3) | 0x07);
+    }
+    uint8_t * const done = Dynarec_EmitJump(info, DYNAREC_CC_ALWAYS);
+
+    /* Slow path: write handler with the register file up to date, mov edx,imm32 or movzx edx,r8 */
+    for(int i=0; i<count; i++)
+    {
+        Dynarec_PatchJump(slow[i], info->Ptr);
+    }
+    Dynarec_EmitStore(info);
+    Dynarec_EmitPc(info, inst->Next);
+    if(src == DYNAREC_R_IMM)
+    {
+        Dynarec_Emit8(info, 0xBA); Dynarec_Emit32(info, (uint8_t)inst->Operand);
+    }
+    else
+    {
+        Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xD0 | src);
+    }
+    Dynarec_EmitCall(info, DYNAREC_ADDR(Memory_Write));
+    Dynarec_EmitCheck(info, state, inst, true);
+    Dynarec_EmitLoad(info);
+
+    Dynarec_PatchJump(done, info->Ptr);
+}
+
+
+/**
+ * 8 bit ALU operation on A, the lazy flag is set as Cpu_AluAdd, Cpu_AluSub and Cpu_AluLogic
+ * @param inst The instruction
+ * @param alu The operation (opcode bit 3-5: ADD, ADC, SUB, SBC, AND, XOR, OR, CP)
+ * @param src The operand host 8 bit register, DYNAREC_R_IMM or DYNAREC_R_MEM
+ * @note The carry of ADC/SBC is made available (Dynarec_EmitSyncFlag) before a memory operand is read
+ */
+static void Dynarec_EmitAlu(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst, int alu, uint8_t src)
+{
+    /* AND, XOR, OR: and/xor/or ah,src; mov [rbp+Flag.Result],ah */
+    if((alu >= 4) && (alu <= 6))
+    {
+        static uint8_t const opcode[] = {0x20, 0x30, 0x08};
+        uint8_t const index = alu - 4;
+
+        if(src == DYNAREC_R_IMM)
+        {
+            static uint8_t const ext[] = {4, 6, 1};
+            Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0xC4 | (ext[index] << 3));
+            Dynarec_Emit8(info, (uint8_t)inst->Operand);
+        }
+        else if(src == DYNAREC_R_MEM)
+        {
+            /* No REX encoding mix AH and DIL: go through the operand field */
+            Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0x7D);
+            Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Data1));
+            Dynarec_Emit8(info, opcode[index] | 0x02); Dynarec_Emit8(info, 0x65);
+            Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Data1));
+        }
+        else
+        {
+            Dynarec_Emit8(info, opcode[index]); Dynarec_Emit8(info, 0xC0 | (src << 3) | DYNAREC_H_AH);
+        }
+
+        uint8_t const op = (alu == 4) ? CPU_FLAG_OP_AND : CPU_FLAG_OP_LOGIC;
+        Dynarec_Emit8(info, 0x88); Dynarec_Emit8(info, 0x65); Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result));
+        Dynarec_Emit8(info, 0xC6); Dynarec_Emit8(info, 0x45);
+        Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Op)); Dynarec_Emit8(info, op);
+        state->FlagOp = op;
+        return;
+    }
+
+    /* ADD, ADC, SUB, SBC, CP: movzx esi,ah; edi = operand; mov [rbp+Flag.Data0],si; mov [rbp+Flag.Data1],di */
+    Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xF4);
+    if(src == DYNAREC_R_IMM)
+    {
+        Dynarec_Emit8(info, 0xBF); Dynarec_Emit32(info, (uint8_t)inst->Operand);
+    }
+    else if(src != DYNAREC_R_MEM)
+    {
+        Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xF8 | src);
+    }
+    Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0x75);
+    Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Data0));
+    Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0x7D);
+    Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Data1));
+
+    /* ADC, SBC: carry to CF */
+    bool const carry = (alu == 1) || (alu == 3);
+    if(carry)
+    {
+        switch(state->FlagOp)
+        {
+            case CPU_FLAG_OP_ADD:
+            case CPU_FLAG_OP_SUB:
+                /* bt word [rbp+Flag.Result],8 */
+                Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xBA);
+                Dynarec_Emit8(info, 0x65); Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result)); Dynarec_Emit8(info, 0x08);
+                break;
+            case CPU_FLAG_OP_AND:
+            case CPU_FLAG_OP_LOGIC:
+                /* clc */
+                Dynarec_Emit8(info, 0xF8);
+                break;
+            default:
+                /* F register carry is up to date: bt eax,4 */
+                Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xBA); Dynarec_Emit8(info, 0xE0); Dynarec_Emit8(info, 0x04);
+                break;
+        }
+    }
+
+    /* add/adc/sub/sbb esi,edi; mov [rbp+Flag.Result],si */
+    static uint8_t const opcode[] = {0x01, 0x11, 0x29, 0x19, 0, 0, 0, 0x29};
+    Dynarec_Emit8(info, opcode[alu]); Dynarec_Emit8(info, 0xFE);
+    Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0x75);
+    Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result));
+
+    /* CP only set the flag: mov ah,[rbp+Flag.Result] */
+    if(alu != 7)
+    {
+        Dynarec_Emit8(info, 0x8A); Dynarec_Emit8(info, 0x65); Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result));
+    }
+
+    uint8_t const op = (alu <= 1) ? CPU_FLAG_OP_ADD : CPU_FLAG_OP_SUB;
+    Dynarec_Emit8(info, 0xC6); Dynarec_Emit8(info, 0x45);
+    Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Op)); Dynarec_Emit8(info, op);
+    state->FlagOp = op;
+}
+
+
+/**
+ * Emit native code of an instruction
+ * @param inst The instruction to translate
+ * @return false if the instruction has no native translation
+ */
+static bool Dynarec_EmitNative(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst)
+{
+    uint16_t const op = inst->Index;
+
+    /* NOP */
+    if(op == 0x00)
+    {
+        return true;
+    }
+
+    /* LD R,R: mov r8,r8, LD R,(HL) and LD (HL),R: memory access (HALT is interpreted) */
+    if((op >= 0x40) && (op <= 0x7F) && (op != 0x76))
+    {
+        uint8_t const dst = Dynarec_Reg8[(op >> 3) & 0x07];
+        uint8_t const src = Dynarec_Reg8[op & 0x07];
+
+        if((dst == DYNAREC_R_NONE) || (src == DYNAREC_R_NONE))
+        {
+            /* movzx esi,dx */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB7); Dynarec_Emit8(info, 0xF0 | DYNAREC_H_DX);
+            if(src == DYNAREC_R_NONE)
+            {
+                Dynarec_EmitRead(info, state, inst, dst, true);
+            }
+            else
+            {
+                Dynarec_EmitWrite(info, state, inst, src);
+            }
+            return true;
+        }
+
+        Dynarec_Emit8(info, 0x88); Dynarec_Emit8(info, 0xC0 | (src << 3) | dst);
+        return true;
+    }
+
+    /* LD R,N: mov r8,imm8, LD (HL),N: memory access */
+    if((op < 0x40) && ((op & 0xC7) == 0x06))
+    {
+        uint8_t const dst = Dynarec_Reg8[(op >> 3) & 0x07];
+        if(dst == DYNAREC_R_NONE)
+        {
+            /* movzx esi,dx */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB7); Dynarec_Emit8(info, 0xF0 | DYNAREC_H_DX);
+            Dynarec_EmitWrite(info, state, inst, DYNAREC_R_IMM);
+            return true;
+        }
+
+        Dynarec_Emit8(info, 0xB0 + dst); Dynarec_Emit8(info, (uint8_t)inst->Operand);
+        return true;
+    }
+
+    /* LD (BC),A / LD (DE),A / LD (HL+),A / LD (HL-),A / LD A,(BC) / LD A,(DE) / LD A,(HL+) / LD A,(HL-) */
+    if((op < 0x40) && (((op & 0x0F) == 0x02) || ((op & 0x0F) == 0x0A)))
+    {
+        int const rr = op >> 4;
+        uint8_t const reg = (rr < 2) ? Dynarec_Reg16[CPU_R_BC + rr] : DYNAREC_H_DX;
+
+        /* movzx esi,r16; inc dx or dec dx: the access use HL before the update */
+        Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB7); Dynarec_Emit8(info, 0xF0 | reg);
+        if(rr >= 2)
+        {
+            Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0xFF); Dynarec_Emit8(info, (rr == 2) ? 0xC2 : 0xCA);
+        }
+
+        if((op & 0x08) == 0)
+        {
+            Dynarec_EmitWrite(info, state, inst, DYNAREC_H_AH);
+        }
+        else
+        {
+            Dynarec_EmitRead(info, state, inst, DYNAREC_H_AH, true);
+        }
+        return true;
+    }
+
+    /* LD (0xFF00+N),A / LD A,(0xFF00+N) / LD (0xFF00+C),A / LD A,(0xFF00+C) / LD (NN),A / LD A,(NN) */
+    if((op == 0xE0) || (op == 0xF0) || (op == 0xE2) || (op == 0xF2) || (op == 0xEA) || (op == 0xFA))
+    {
+        if((op & 0x0F) == 0x02)
+        {
+            /* movzx esi,bl; or esi,0xFF00 */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xF0 | DYNAREC_H_BL);
+            Dynarec_Emit8(info, 0x81); Dynarec_Emit8(info, 0xCE); Dynarec_Emit32(info, 0xFF00);
+        }
+        else
+        {
+            /* mov esi,imm32 */
+            uint16_t const addr = ((op & 0x0F) == 0x00) ? (0xFF00 | (uint8_t)inst->Operand) : inst->Operand;
+            Dynarec_Emit8(info, 0xBE); Dynarec_Emit32(info, addr);
+        }
+
+        if(op < 0xF0)
+        {
+            Dynarec_EmitWrite(info, state, inst, DYNAREC_H_AH);
+        }
+        else
+        {
+            Dynarec_EmitRead(info, state, inst, DYNAREC_H_AH, true);
+        }
+        return true;
+    }
+
+    /* LD RR,NN: mov r16,imm16 or mov word [rbp+SP],imm16 */
+    if((op < 0x40) && ((op & 0xCF) == 0x01))
+    {
+        int const rr = op >> 4;
+        if(rr < 3)
+        {
+            Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0xB8 + Dynarec_Reg16[CPU_R_BC + rr]);
+        }
+        else
+        {
+            Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0xC7); Dynarec_Emit8(info, 0x45);
+            Dynarec_Emit8(info, DYNAREC_OFFSET(CPU_R_SP));
+        }
+        Dynarec_Emit16(info, inst->Operand);
+        return true;
+    }
+
+    /* INC RR/DEC RR: inc/dec r16 or inc/dec word [rbp+SP] */
+    if((op < 0x40) && (((op & 0xCF) == 0x03) || ((op & 0xCF) == 0x0B)))
+    {
+        int const rr = op >> 4;
+        uint8_t const ext = ((op & 0x08) == 0) ? 0 : 1;
+        Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0xFF);
+        if(rr < 3)
+        {
+            Dynarec_Emit8(info, 0xC0 | (ext << 3) | Dynarec_Reg16[CPU_R_BC + rr]);
+        }
+        else
+        {
+            Dynarec_Emit8(info, 0x45 | (ext << 3));
+            Dynarec_Emit8(info, DYNAREC_OFFSET(CPU_R_SP));
+        }
+        return true;
+    }
+
+    /* INC R/DEC R: inc/dec r8; mov [rbp+Flag.Result],r8 (INC (HL)/DEC (HL) are interpreted) */
+    if((op < 0x40) && (((op & 0xC7) == 0x04) || ((op & 0xC7) == 0x05)))
+    {
+        uint8_t const reg = Dynarec_Reg8[(op >> 3) & 0x07];
+        if(reg == DYNAREC_R_NONE)
+        {
+            return false;
+        }
+
+        uint8_t const dec = op & 0x01;
+        Dynarec_EmitCarryFlag(info, state);
+        Dynarec_Emit8(info, 0xFE); Dynarec_Emit8(info, 0xC0 | (dec << 3) | reg);
+        Dynarec_Emit8(info, 0x88); Dynarec_Emit8(info, 0x45 | (reg << 3)); Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result));
+        Dynarec_Emit8(info, 0xC6); Dynarec_Emit8(info, 0x45); Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Op));
+        Dynarec_Emit8(info, (dec != 0) ? CPU_FLAG_OP_DEC : CPU_FLAG_OP_INC);
+        state->FlagOp = (dec != 0) ? CPU_FLAG_OP_DEC : CPU_FLAG_OP_INC;
+        return true;
+    }
+
+    /* ALU R / ALU (HL) / ALU N: ADD, ADC, SUB, SBC, AND, XOR, OR, CP */
+    if(((op >= 0x80) && (op <= 0xBF)) || ((op >= 0xC0) && (op <= 0xFF) && ((op & 0xC7) == 0xC6)))
+    {
+        int const alu = (op >> 3) & 0x07;
+        uint8_t src = (op >= 0xC0) ? DYNAREC_R_IMM : Dynarec_Reg8[op & 0x07];
+
+        /* The carry evaluation may call Cpu_SyncFlag: done before edi hold the operand */
+        if(((alu == 1) || (alu == 3)) && ((state->FlagOp == DYNAREC_FLAG_UNKNOWN) || (state->FlagOp == CPU_FLAG_OP_ADD16) ||
+                                          (state->FlagOp == CPU_FLAG_OP_ROT) || (state->FlagOp == CPU_FLAG_OP_ROTA)))
+        {
+            Dynarec_EmitSyncFlag(info, state);
+        }
+
+        if(src == DYNAREC_R_NONE)
+        {
+            /* movzx esi,dx */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB7); Dynarec_Emit8(info, 0xF0 | DYNAREC_H_DX);
+            Dynarec_EmitRead(info, state, inst, DYNAREC_R_MEM, false);
+            src = DYNAREC_R_MEM;
+        }
+
+        Dynarec_EmitAlu(info, state, inst, alu, src);
+        if(src == DYNAREC_R_MEM)
+        {
+            Dynarec_EmitCheck(info, state, inst, false);
+        }
+        return true;
+    }
+
+    /* BIT N,R / BIT N,(HL): esi = data & mask; mov [rbp+Flag.Result],si */
+    if((op >= 0x140) && (op <= 0x17F))
+    {
+        uint8_t const src = Dynarec_Reg8[op & 0x07];
+        uint8_t const mask = 1 << ((op >> 3) & 0x07);
+
+        Dynarec_EmitCarryFlag(info, state);
+        if(src == DYNAREC_R_NONE)
+        {
+            /* movzx esi,dx; read to edi; mov esi,edi */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB7); Dynarec_Emit8(info, 0xF0 | DYNAREC_H_DX);
+            Dynarec_EmitRead(info, state, inst, DYNAREC_R_MEM, false);
+            Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0xFE);
+        }
+        else
+        {
+            /* movzx esi,r8 */
+            Dynarec_Emit8(info, 0x0F); Dynarec_Emit8(info, 0xB6); Dynarec_Emit8(info, 0xF0 | src);
+        }
+
+        /* and esi,mask */
+        Dynarec_Emit8(info, 0x81); Dynarec_Emit8(info, 0xE6); Dynarec_Emit32(info, mask);
+        Dynarec_Emit8(info, 0x66); Dynarec_Emit8(info, 0x89); Dynarec_Emit8(info, 0x75);
+        Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Result));
+        Dynarec_Emit8(info, 0xC6); Dynarec_Emit8(info, 0x45);
+        Dynarec_Emit8(info, DYNAREC_FLAG_OFFSET(Op)); Dynarec_Emit8(info, CPU_FLAG_OP_BIT);
+        state->FlagOp = CPU_FLAG_OP_BIT;
+
+        if(src == DYNAREC_R_NONE)
+        {
+            Dynarec_EmitCheck(info, state, inst, false);
+        }
+        return true;
+    }
+
+    /* JR N / JR F,N / JP NN / JP F,NN: set PC, a taken conditional jump add its extra cycle */
+    bool const jr = (op == 0x18) || ((op < 0x100) && ((op & 0xE7) == 0x20));
+    bool const jp = (op == 0xC3) || ((op < 0x100) && ((op & 0xE7) == 0xC2));
+    if(jr || jp)
+    {
+        uint16_t const target = jr ? (uint16_t)(inst->Next + (int8_t)inst->Operand) : inst->Operand;
+        bool const conditional = (op != 0x18) && (op != 0xC3);
+        uint8_t const cond = conditional ? Dynarec_EmitCondition(info, state, (op >> 3) & 0x03) : DYNAREC_CC_ALWAYS;
+
+        if(cond == DYNAREC_CC_ALWAYS)
+        {
+            Dynarec_EmitPc(info, target);
+            state->Cycle += conditional ? DYNAREC_TAKEN_CYCLE : 0;
+        }
+        else if(cond == DYNAREC_CC_NEVER)
+        {
+            Dynarec_EmitPc(info, inst->Next);
+        }
+        else
+        {
+            /* mov word [rbp+PC],next; jncc skip; mov word [rbp+PC],target; add r12d,DYNAREC_TAKEN_CYCLE */
+            Dynarec_EmitPc(info, inst->Next);
+            Dynarec_Emit8(info, 0x70 | (cond ^ 1)); Dynarec_Emit8(info, 0x0A);
+            Dynarec_EmitPc(info, target);
+            Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x83); Dynarec_Emit8(info, 0xC4);
+            Dynarec_Emit8(info, DYNAREC_TAKEN_CYCLE);
+        }
+
+        state->PcSet = true;
+        return true;
+    }
+
+    return false;
+}
+
+
+/**
+ * Emit a call to the interpreter for an instruction
+ * @param inst The instruction to interpret
+ */
+static void Dynarec_EmitInterpret(Dynarec_Info_t * info, Dynarec_State_t * state, Dynarec_Inst_t const * inst)
+{
+    Dynarec_EmitStore(info);
+    Dynarec_EmitPc(info, inst->Next);
+
+    /* mov esi,index; mov edx,operand; Cpu_Interpret(ctx, index, operand); add r12d,eax */
+    Dynarec_Emit8(info, 0xBE); Dynarec_Emit32(info, inst->Index);
+    Dynarec_Emit8(info, 0xBA); Dynarec_Emit32(info, inst->Operand);
+    Dynarec_EmitCall(info, DYNAREC_ADDR(Cpu_Interpret));
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x01); Dynarec_Emit8(info, 0xC4);
+
+    /* The instruction may have modified its own block: cmp byte [r13],0; je exit */
+    Dynarec_Emit8(info, 0x41); Dynarec_Emit8(info, 0x80); Dynarec_Emit8(info, 0x7D);
+    Dynarec_Emit8(info, 0x00); Dynarec_Emit8(info, 0x00);
+    state->Exit[state->ExitCount ++] = Dynarec_EmitJump(info, DYNAREC_CC_E);
+
+    Dynarec_EmitLoad(info);
+    state->PcSet = true;
+    state->FlagOp = DYNAREC_FLAG_UNKNOWN;
+}
+
+
+#endif /* CPU_DYNAREC */
@@ -0,0 +1,121 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _DYNAREC_H_
+#define _DYNAREC_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Cpu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Number of block execution before native translation */
+#define DYNAREC_THRESHOLD   64
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/**
+ * Translated native block
+ * @param ctx The emulator context
+ * @return The number of cycle used to execute the block
+ */
+typedef uint32_t (*Dynarec_Block_t)(Emu_Context_t * ctx);
+
+/** Native code buffer */
+typedef struct tagDynarec_Info_t
+{
+    uint8_t * Buffer;   /**< Executable code buffer */
+    size_t Used;        /**< Code buffer used size */
+    uint8_t * Ptr;      /**< Code emission pointer */
+} Dynarec_Info_t;
+
+/** Instruction to translate */
+typedef struct tagDynarec_Inst_t
+{
+    uint16_t Index;     /**< Instruction dispatch index (0x100 + value for CB prefix) */
+    uint16_t Operand;   /**< Immediate operand */
+    uint16_t Next;      /**< Address of the next instruction */
+    uint8_t  Cycle;     /**< Instruction cycle duration */
+} Dynarec_Inst_t;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Initialize the native code buffer
+ * @param info The native code buffer
+ * @return 0 if successful, otherwise -1
+ */
+extern int Dynarec_Initialize(Dynarec_Info_t * info);
+
+/**
+ * Release the native code buffer
+ * @param info The native code buffer
+ */
+extern void Dynarec_Finalize(Dynarec_Info_t * info);
+
+/**
+ * Drop all translated native block
+ * @param info The native code buffer
+ */
+extern void Dynarec_Flush(Dynarec_Info_t * info);
+
+/**
+ * Translate a block of instruction to native code
+ * @param info The native code buffer
+ * @param inst The instruction list
+ * @param count The number of instruction
+ * @param valid The block validity flag checked after each interpreted instruction or memory handler
+ * @param code The per-address cached code count (a write to a non zero address goes through Memory_Write)
+ * @return The native block, NULL if the code buffer is full
+ * @note Unsupported instruction are delegated to Cpu_Interpret
+ */
+extern Dynarec_Block_t Dynarec_Translate(Dynarec_Info_t * info, Dynarec_Inst_t const * inst, int count,
+                                         uint8_t const * valid, uint8_t const * code);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _DYNAREC_H_ */
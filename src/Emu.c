@@ -0,0 +1,239 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** I/O register value */
+typedef struct tagEmu_IoValue_t
+{
+    uint16_t Addr;  /**< Register address */
+    uint8_t Data;   /**< Register value */
+} Emu_IoValue_t;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+/** Non zero I/O register left by the DMG boot ROM */
+static Emu_IoValue_t const Emu_BootIo[] =
+{
+    {0xFF10, 0x80}, {0xFF11, 0xBF}, {0xFF12, 0xF3}, {0xFF14, 0xBF},     /* Sound channel 1 */
+    {0xFF16, 0x3F}, {0xFF19, 0xBF},                                     /* Sound channel 2 */
+    {0xFF1A, 0x7F}, {0xFF1B, 0xFF}, {0xFF1C, 0x9F}, {0xFF1E, 0xBF},     /* Sound channel 3 */
+    {0xFF20, 0xFF}, {0xFF23, 0xBF},                                     /* Sound channel 4 */
+    {0xFF24, 0x77}, {0xFF25, 0xF3}, {0xFF26, 0xF1},                     /* Sound control */
+    {PPU_REG_BGP, 0xFC}, {PPU_REG_OBP0, 0xFF}, {PPU_REG_OBP1, 0xFF},    /* Palette */
+    {PPU_REG_LCDC, 0x91}                                                /* LCD control */
+};
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+Emu_Context_t * Emu_Create(void)
+{
+    Emu_Context_t * ctx = calloc(1, sizeof(Emu_Context_t));
+    if(ctx == NULL)
+    {
+        DEBUGGER_ERROR("Emu_Create Error: out of memory\n");
+        return NULL;
+    }
+
+    /* The CPU cache must exist before any memory mapping */
+    if(Cpu_Initialize(ctx) != 0)
+    {
+        Emu_Destroy(ctx);
+        return NULL;
+    }
+
+    /* The page table must be set up before the cartridge map its bank */
+    if(Memory_Initialize(ctx) != 0)
+    {
+        Emu_Destroy(ctx);
+        return NULL;
+    }
+
+    if(Cartridge_Initialize(ctx) != 0)
+    {
+        Emu_Destroy(ctx);
+        return NULL;
+    }
+
+    Ppu_SetRenderInterval(ctx, PPU_RENDER_ALL);
+    Emu_Reset(ctx);
+
+    return ctx;
+}
+
+
+void Emu_Destroy(Emu_Context_t * ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+
+    Trace_Stop(ctx);
+    Rewind_Stop(ctx);
+    Cartridge_Finalize(ctx);
+    Memory_Finalize(ctx);
+    Cpu_Finalize(ctx);
+    free(ctx);
+}
+
+
+Emu_Context_t * Emu_Fork(Emu_Context_t * ctx, Emu_Context_t * fork)
+{
+    assert(fork != ctx);
+
+    if(fork == NULL)
+    {
+        fork = Emu_Create();
+        if(fork == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    /* A reused context drop its debug setting, the watch redirection before the bank are shared */
+    Trace_Stop(fork);
+    Memory_ClearWatch(fork);
+    fork->Debugger.BreakListCount = 0;
+
+    /* Also drop the translation of the previous program */
+    Cpu_ClearBreakpoint(fork);
+
+    Memory_Share(fork, ctx);
+    Cartridge_Share(fork, ctx);
+
+    /* The fork keep its own instruction cache */
+    Cpu_Cache_t * const cache = fork->Cpu.Cache;
+    fork->Cpu = ctx->Cpu;
+    fork->Cpu.Cache = cache;
+    fork->Cpu.Break = false;
+    fork->Cpu.BreakRequest = false;
+
+    /* Plain value: event callback are shared code */
+    fork->Scheduler = ctx->Scheduler;
+    fork->Interrupt = ctx->Interrupt;
+    fork->Timer = ctx->Timer;
+    fork->Ppu = ctx->Ppu;
+    Interrupt_Update(fork);
+
+    /* A reused context drop the history of its previous machine */
+    Rewind_Clear(fork);
+
+    return fork;
+}
+
+
+void Emu_Reset(Emu_Context_t * ctx)
+{
+    Cpu_Initialize(ctx);
+    Scheduler_Initialize(ctx);
+    Memory_Initialize(ctx);
+    Interrupt_Initialize(ctx);
+    Cartridge_Reset(ctx);
+    Timer_Initialize(ctx);
+    Ppu_Initialize(ctx);
+}
+
+
+void Emu_SkipBoot(Emu_Context_t * ctx)
+{
+    CPU_REG16(ctx, CPU_R_AF)->UWord = 0x01B0;
+    CPU_REG16(ctx, CPU_R_BC)->UWord = 0x0013;
+    CPU_REG16(ctx, CPU_R_DE)->UWord = 0x00D8;
+    CPU_REG16(ctx, CPU_R_HL)->UWord = 0x014D;
+    CPU_REG16(ctx, CPU_R_SP)->UWord = 0xFFFE;
+    CPU_REG16(ctx, CPU_R_PC)->UWord = 0x0100;
+
+    /* The LCD is switched on last, with its palette set */
+    for(size_t i=0; i<sizeof(Emu_BootIo) / sizeof(Emu_BootIo[0]); i++)
+    {
+        Memory_Write(ctx, Emu_BootIo[i].Addr, Emu_BootIo[i].Data);
+    }
+}
+
+
+uint64_t Emu_Run(Emu_Context_t * ctx, uint64_t cycles)
+{
+    uint64_t const start = ctx->Cpu.Cycle;
+    uint64_t const end = start + cycles;
+
+    while(ctx->Cpu.Cycle < end)
+    {
+        /* Run the CPU up to the next event, never tick the peripheral */
+        uint64_t next = Scheduler_GetDeadline(ctx);
+        if(next > end)
+        {
+            next = end;
+        }
+        if(next > ctx->Cpu.Cycle)
+        {
+            uint64_t const budget = next - ctx->Cpu.Cycle;
+            Cpu_Run(ctx, (budget > UINT32_MAX) ? UINT32_MAX : (uint32_t)budget);
+            if(ctx->Cpu.Break)
+            {
+                break;
+            }
+        }
+
+        Scheduler_Dispatch(ctx);
+    }
+
+    return ctx->Cpu.Cycle - start;
+}
+
+
+uint32_t Emu_Step(Emu_Context_t * ctx)
+{
+    uint32_t const cycle = Cpu_Step(ctx);
+    Scheduler_Dispatch(ctx);
+    return cycle;
+}
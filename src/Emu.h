@@ -0,0 +1,143 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _EMU_H_
+#define _EMU_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+/* Forward declaration for the module prototype */
+typedef struct tagEmu_Context_t Emu_Context_t;
+
+#include <Cpu.h>
+#include <Memory.h>
+#include <Debugger.h>
+#include <Cartridge.h>
+#include <Trace.h>
+#include <Rewind.h>
+#include <Scheduler.h>
+#include <Interrupt.h>
+#include <Timer.h>
+#include <Ppu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/**
+ * Emulator context: state of one emulated machine
+ * @note The most accessed state come first to share the same cache line
+ */
+struct tagEmu_Context_t
+{
+    Cpu_Info_t       Cpu;       /**< CPU register and cache */
+    Scheduler_Info_t Scheduler; /**< Pending hardware event */
+    Interrupt_Info_t Interrupt; /**< Interrupt enable and request */
+    Memory_Info_t    Memory;    /**< Memory map */
+    Cartridge_Info_t Cartridge; /**< Cartridge ROM, RAM and bank controller */
+    Timer_Info_t     Timer;     /**< Divider and timer */
+    Ppu_Info_t       Ppu;       /**< LCD controller and framebuffer */
+    Debugger_Info_t  Debugger;  /**< Debugger state */
+    Trace_Info_t     Trace;     /**< Memory access trace */
+    Rewind_Info_t    Rewind;    /**< Snapshot history */
+};
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Create an emulator context
+ * @return The initialized context, NULL if out of memory
+ */
+extern Emu_Context_t * Emu_Create(void);
+
+/**
+ * Release an emulator context
+ * @param ctx The context to release
+ */
+extern void Emu_Destroy(Emu_Context_t * ctx);
+
+/**
+ * Clone a running machine
+ * @param ctx The emulator context to fork
+ * @param fork A context to reuse for the fork (its previous machine is dropped), NULL to create one
+ * @return The fork, NULL if out of memory
+ * @note RAM bank and cartridge ROM are shared: a bank is copied when one of the
+ *       context write it first. Breakpoint, watchpoint, trace and rewind
+ *       history are not inherited.
+ * @note Reusing a context skip its allocation: fan out by recycling finished branch
+ * @note Both context can then run in different thread
+ */
+extern Emu_Context_t * Emu_Fork(Emu_Context_t * ctx, Emu_Context_t * fork);
+
+/**
+ * Reset the machine (the inserted cartridge is kept)
+ * @param ctx The emulator context
+ */
+extern void Emu_Reset(Emu_Context_t * ctx);
+
+/**
+ * Set the DMG state left by the boot ROM: start a cartridge at 0x0100 without boot ROM
+ * @param ctx The emulator context (reset, with the cartridge loaded)
+ */
+extern void Emu_SkipBoot(Emu_Context_t * ctx);
+
+/**
+ * Run the machine for a cycle budget, firing hardware event on time
+ * @param ctx The emulator context
+ * @param cycles The minimum number of cycle to execute
+ * @return The number of cycle executed
+ * @note Return early when the CPU stop before a breakpoint (Cpu.Break)
+ */
+extern uint64_t Emu_Run(Emu_Context_t * ctx, uint64_t cycles);
+
+/**
+ * Run one instruction then fire the due hardware event
+ * @param ctx The emulator context
+ * @return The number of cycle used for the instruction
+ */
+extern uint32_t Emu_Step(Emu_Context_t * ctx);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _EMU_H_ */
@@ -0,0 +1,157 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static uint8_t Interrupt_Read(Emu_Context_t * ctx, uint16_t addr);
+static void Interrupt_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+void Interrupt_Initialize(Emu_Context_t * ctx)
+{
+    Interrupt_Info_t * irq = &ctx->Interrupt;
+
+    irq->Enable  = 0;
+    irq->Request = 0;
+
+    Memory_MapIo(ctx, INTERRUPT_REG_IF, Interrupt_Read, Interrupt_Write);
+    Memory_MapIo(ctx, INTERRUPT_REG_IE, Interrupt_Read, Interrupt_Write);
+
+    Interrupt_Update(ctx);
+}
+
+
+void Interrupt_Request(Emu_Context_t * ctx, uint8_t source)
+{
+    ctx->Interrupt.Request |= source & INTERRUPT_ALL;
+    Interrupt_Update(ctx);
+}
+
+
+void Interrupt_Acknowledge(Emu_Context_t * ctx, uint8_t source)
+{
+    ctx->Interrupt.Request &= ~source;
+    Interrupt_Update(ctx);
+}
+
+
+uint8_t Interrupt_GetPending(Emu_Context_t const * ctx)
+{
+    return ctx->Interrupt.Enable & ctx->Interrupt.Request & INTERRUPT_ALL;
+}
+
+
+void Interrupt_Update(Emu_Context_t * ctx)
+{
+    Cpu_Info_t * cpu = &ctx->Cpu;
+    uint8_t word = 0;
+
+    /* Fold every reason to leave the block fast path in a single word */
+    if(cpu->Ime)
+    {
+        word |= Interrupt_GetPending(ctx);
+    }
+    if(cpu->ImeDelay)
+    {
+        word |= CPU_IRQ_EI;
+    }
+    if(cpu->Halted)
+    {
+        word |= CPU_IRQ_HALT;
+    }
+    if(cpu->BreakRequest)
+    {
+        word |= CPU_IRQ_BREAK;
+    }
+
+    cpu->Irq = word;
+}
+
+
+/**
+ * Read an interrupt register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @return The register value
+ */
+static uint8_t Interrupt_Read(Emu_Context_t * ctx, uint16_t addr)
+{
+    if(addr == INTERRUPT_REG_IF)
+    {
+        /* Unused upper bit read as 1 */
+        return ctx->Interrupt.Request | (uint8_t)~INTERRUPT_ALL;
+    }
+    return ctx->Interrupt.Enable;
+}
+
+
+/**
+ * Write an interrupt register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @param data The data to write
+ */
+static void Interrupt_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    if(addr == INTERRUPT_REG_IF)
+    {
+        ctx->Interrupt.Request = data & INTERRUPT_ALL;
+    }
+    else
+    {
+        ctx->Interrupt.Enable = data;
+    }
+
+    Interrupt_Update(ctx);
+}
@@ -0,0 +1,127 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _INTERRUPT_H_
+#define _INTERRUPT_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Interrupt request register */
+#define INTERRUPT_REG_IF    0xFF0F
+
+/** Interrupt enable register */
+#define INTERRUPT_REG_IE    0xFFFF
+
+/** Address of the first interrupt vector (one every 8 Byte by priority) */
+#define INTERRUPT_VECTOR    0x0040
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Interrupt source (IE/IF bit, lowest bit has the highest priority) */
+typedef enum tagInterrupt_Source_e
+{
+    INTERRUPT_VBLANK = 0x01,    /**< Vertical blank */
+    INTERRUPT_STAT   = 0x02,    /**< LCD status */
+    INTERRUPT_TIMER  = 0x04,    /**< Timer TIMA overflow */
+    INTERRUPT_SERIAL = 0x08,    /**< Serial transfer end */
+    INTERRUPT_JOYPAD = 0x10,    /**< Joypad input */
+    INTERRUPT_ALL    = 0x1F     /**< All source bitmap */
+} Interrupt_Source_e;
+
+/**
+ * Interrupt controller Info
+ * @note IME and HALT are CPU state, the CPU check word is derived from all of them
+ */
+typedef struct tagInterrupt_Info_t
+{
+    uint8_t Enable;     /**< Interrupt enable (IE) */
+    uint8_t Request;    /**< Interrupt request (IF) */
+} Interrupt_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Reset the interrupt controller and attach its register
+ * @param ctx The emulator context
+ */
+extern void Interrupt_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Request an interrupt (peripheral event)
+ * @param ctx The emulator context
+ * @param source The Interrupt_Source_e bitmap
+ */
+extern void Interrupt_Request(Emu_Context_t * ctx, uint8_t source);
+
+/**
+ * Clear an interrupt request (CPU dispatch)
+ * @param ctx The emulator context
+ * @param source The Interrupt_Source_e bitmap
+ */
+extern void Interrupt_Acknowledge(Emu_Context_t * ctx, uint8_t source);
+
+/**
+ * Get the requested and enabled interrupt, IME ignored (HALT exit)
+ * @param ctx The emulator context
+ * @return The Interrupt_Source_e bitmap
+ */
+extern uint8_t Interrupt_GetPending(Emu_Context_t const * ctx);
+
+/**
+ * Recompute the CPU interrupt check word
+ * @param ctx The emulator context
+ * @note Required after any change of IE, IF, IME, EI delay, HALT state or break request
+ */
+extern void Interrupt_Update(Emu_Context_t * ctx);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _INTERRUPT_H_ */
@@ -1,7 +1,19 @@
+#include <string.h>
 #include <Debugger.h>
+#include <Batch.h>
+#include <Tile.h>
 
 int main(int argc, char const *argv[])
 {
+    /* Host specific decoder must be selected before any emulator thread */
+    Tile_Initialize();
+
+    /* Headless multi-instance mode */
+    if((argc >= 2) && (strcmp(argv[1], "--batch") == 0))
+    {
+        return Batch_Run(argc - 2, &argv[2]);
+    }
+
     Debugger_RunShell(argc, argv);
 
     return 0;
@@ -27,20 +27,19 @@
 /******************************************************/
 
 #include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <errno.h>
-#include <Memory.h>
-#include <Debugger.h>
+#include <Emu.h>
 
 
 /******************************************************/
 /* Macro                                              */
 /******************************************************/
 
-/** 16 bit addressable memory table */
-#define MEMORY_TABLE_SIZE   0x00010000
 
 
 /******************************************************/
@@ -52,13 +51,27 @@
 /* Prototype                                          */
 /******************************************************/
 
+static uint8_t Memory_ReadOpen(Emu_Context_t * ctx, uint16_t addr);
+static void Memory_WriteIgnore(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static uint8_t Memory_ReadIo(Emu_Context_t * ctx, uint16_t addr);
+static void Memory_WriteIo(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static void Memory_WriteBoot(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static uint8_t Memory_ReadWatch(Emu_Context_t * ctx, uint16_t addr);
+static void Memory_WriteWatch(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static void Memory_CheckWatch(Emu_Context_t * ctx, uint16_t addr, uint8_t data, uint8_t kind);
+static void Memory_UpdatePage(Emu_Context_t * ctx, int page);
+static void Memory_MapPage(Emu_Context_t * ctx, int page, uint8_t const * read, uint8_t * write,
+                           Memory_ReadHandler_t readHandler, Memory_WriteHandler_t writeHandler, uint8_t bank);
+static void Memory_WriteMapped(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static void Memory_WriteShared(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static bool Memory_IsShared(Memory_Info_t const * mem, int page);
+static void Memory_SetBank(Emu_Context_t * ctx, int bank, Memory_Bank_t * data);
+
 
 /******************************************************/
 /* Variable                                           */
 /******************************************************/
 
-/** 16 bit memory table */
-static uint8_t Memory_Table[MEMORY_TABLE_SIZE];
 
 
 /******************************************************/
@@ -68,23 +81,230 @@ static uint8_t Memory_Table[MEMORY_TABLE_SIZE];
 /**
  * Initialize Memory
  */
-void Memory_Initialize(void)
+int Memory_Initialize(Emu_Context_t * ctx)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+
+    memset(mem->Boot, 0, sizeof(mem->Boot));
+    memset(mem->Oam,  0, sizeof(mem->Oam));
+    memset(mem->Io,   0, sizeof(mem->Io));
+    memset(mem->IoRead,  0, sizeof(mem->IoRead));
+    memset(mem->IoWrite, 0, sizeof(mem->IoWrite));
+    mem->BootEnabled = false;
+    mem->WatchHit.Kind = MEMORY_WATCH_NONE;
+    mem->WatchEnabled = true;
+
+    /* Start from an unmapped space: no page refer to a bank */
+    Memory_Map(ctx, 0x0000, MEMORY_TABLE_SIZE, NULL, NULL, NULL, NULL);
+
+    if((Memory_AllocateBank(ctx, MEMORY_BANK_VRAM) != 0) || (Memory_AllocateBank(ctx, MEMORY_BANK_WRAM) != 0))
+    {
+        return -1;
+    }
+
+    /* Cartridge ROM and RAM are mapped by the cartridge */
+
+    /* Plain RAM */
+    Memory_MapBank(ctx, 0x8000, MEMORY_VRAM_SIZE, MEMORY_BANK_VRAM, NULL);
+    Memory_MapBank(ctx, 0xC000, MEMORY_WRAM_SIZE, MEMORY_BANK_WRAM, NULL);
+
+    /* Echo RAM: 0xE000-0xFDFF mirror 0xC000-0xDDFF */
+    Memory_MapBank(ctx, 0xE000, 0x1E00, MEMORY_BANK_WRAM, NULL);
+
+    /* OAM and the unusable area share a page */
+    Memory_Map(ctx, 0xFE00, MEMORY_PAGE_SIZE, mem->Oam, mem->Oam, NULL, NULL);
+
+    /* I/O register, high RAM and IE */
+    Memory_Map(ctx, 0xFF00, MEMORY_PAGE_SIZE, NULL, NULL, Memory_ReadIo, Memory_WriteIo);
+    Memory_MapIo(ctx, MEMORY_REG_BOOT, NULL, Memory_WriteBoot);
+
+    return 0;
+}
+
+
+void Memory_Finalize(Emu_Context_t * ctx)
+{
+    for(int i=0; i<MEMORY_BANK_COUNT; i++)
+    {
+        Memory_ReleaseBank(ctx, i);
+    }
+}
+
+
+void Memory_Map(Emu_Context_t * ctx, uint16_t addr, uint32_t size, uint8_t const * read, uint8_t * write,
+                Memory_ReadHandler_t readHandler, Memory_WriteHandler_t writeHandler)
+{
+    int const first = addr / MEMORY_PAGE_SIZE;
+    int const count = size / MEMORY_PAGE_SIZE;
+
+    assert((addr % MEMORY_PAGE_SIZE) == 0);
+    assert((size % MEMORY_PAGE_SIZE) == 0);
+    assert(first + count <= MEMORY_PAGE_COUNT);
+
+    for(int i=0; i<count; i++)
+    {
+        Memory_MapPage(ctx, first + i,
+                       (read  != NULL) ? read  + i * MEMORY_PAGE_SIZE : NULL,
+                       (write != NULL) ? write + i * MEMORY_PAGE_SIZE : NULL,
+                       readHandler, writeHandler, MEMORY_BANK_NONE);
+    }
+}
+
+
+void Memory_MapBank(Emu_Context_t * ctx, uint16_t addr, uint32_t size, int bank,
+                    Memory_WriteHandler_t writeHandler)
+{
+    int const first = addr / MEMORY_PAGE_SIZE;
+    int const count = size / MEMORY_PAGE_SIZE;
+    uint8_t * const data = ctx->Memory.Bank[bank]->Data;
+
+    assert((addr % MEMORY_PAGE_SIZE) == 0);
+    assert((size % MEMORY_PAGE_SIZE) == 0);
+    assert(size <= MEMORY_BANK_SIZE);
+    assert(first + count <= MEMORY_PAGE_COUNT);
+
+    for(int i=0; i<count; i++)
+    {
+        uint8_t * const page = data + i * MEMORY_PAGE_SIZE;
+        Memory_MapPage(ctx, first + i, page, (writeHandler == NULL) ? page : NULL, NULL, writeHandler, bank);
+    }
+}
+
+
+int Memory_AllocateBank(Emu_Context_t * ctx, int bank)
+{
+    Memory_Bank_t * data = ctx->Memory.Bank[bank];
+
+    /* Clear an own bank in place */
+    if((data != NULL) && (__atomic_load_n(&data->Ref, __ATOMIC_ACQUIRE) == 1))
+    {
+        memset(data->Data, 0, sizeof(data->Data));
+        return 0;
+    }
+
+    data = calloc(1, sizeof(Memory_Bank_t));
+    if(data == NULL)
+    {
+        DEBUGGER_ERROR("Memory Error: out of memory\n");
+        return -1;
+    }
+    data->Ref = 1;
+    Memory_SetBank(ctx, bank, data);
+
+    return 0;
+}
+
+
+void Memory_ReleaseBank(Emu_Context_t * ctx, int bank)
+{
+    Memory_SetBank(ctx, bank, NULL);
+}
+
+
+uint8_t * Memory_GetBank(Emu_Context_t * ctx, int bank)
+{
+    Memory_Bank_t * const shared = ctx->Memory.Bank[bank];
+    if(__atomic_load_n(&shared->Ref, __ATOMIC_ACQUIRE) == 1)
+    {
+        return shared->Data;
+    }
+
+    /* Copy on write: the other context keep the shared one */
+    Memory_Bank_t * data = malloc(sizeof(Memory_Bank_t));
+    if(data == NULL)
+    {
+        DEBUGGER_ERROR("Memory Error: out of memory\n");
+        return NULL;
+    }
+    data->Ref = 1;
+    memcpy(data->Data, shared->Data, sizeof(data->Data));
+    Memory_SetBank(ctx, bank, data);
+
+    return data->Data;
+}
+
+
+void Memory_Share(Emu_Context_t * fork, Emu_Context_t * ctx)
+{
+    Memory_Info_t * mem = &fork->Memory;
+    Memory_Info_t const * src = &ctx->Memory;
+
+    memcpy(mem->Boot, src->Boot, sizeof(mem->Boot));
+    memcpy(mem->Oam,  src->Oam,  sizeof(mem->Oam));
+    memcpy(mem->Io,   src->Io,   sizeof(mem->Io));
+    mem->BootEnabled = src->BootEnabled;
+
+    for(int i=0; i<MEMORY_BANK_COUNT; i++)
+    {
+        /* A recycled fork may already share the bank: it keep its reference */
+        Memory_Bank_t * const data = src->Bank[i];
+        if((data != NULL) && (mem->Bank[i] != data))
+        {
+            __atomic_add_fetch(&data->Ref, 1, __ATOMIC_RELAXED);
+        }
+
+        /* Both context now write through the copy-on-write handler */
+        Memory_SetBank(fork, i, data);
+        Memory_SetBank(ctx, i, data);
+    }
+}
+
+
+void Memory_MapIo(Emu_Context_t * ctx, uint16_t addr,
+                  Memory_ReadHandler_t readHandler, Memory_WriteHandler_t writeHandler)
+{
+    assert(addr >= 0xFF00);
+
+    ctx->Memory.IoRead[addr % MEMORY_PAGE_SIZE]  = readHandler;
+    ctx->Memory.IoWrite[addr % MEMORY_PAGE_SIZE] = writeHandler;
+}
+
+
+int Memory_SetWatch(Emu_Context_t * ctx, uint16_t addr, uint8_t kind, uint16_t value)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+
+    if((mem->WatchCount == MEMORY_WATCH_COUNT) || ((kind & MEMORY_WATCH_ACCESS) == 0))
+    {
+        return -1;
+    }
+
+    Memory_Watch_t * watch = &mem->Watch[mem->WatchCount ++];
+    watch->Addr  = addr;
+    watch->Value = value;
+    watch->Kind  = kind & MEMORY_WATCH_ACCESS;
+
+    /* Redirect the watched access of the page */
+    mem->WatchPage[addr / MEMORY_PAGE_SIZE] |= watch->Kind;
+    Memory_UpdatePage(ctx, addr / MEMORY_PAGE_SIZE);
+
+    return 0;
+}
+
+
+void Memory_ClearWatch(Emu_Context_t * ctx)
 {
-    for(int i=0; i<MEMORY_TABLE_SIZE; i++)
+    Memory_Info_t * mem = &ctx->Memory;
+
+    for(int i=0; i<mem->WatchCount; i++)
     {
-        Memory_Table[i] = 0;
+        mem->WatchPage[mem->Watch[i].Addr / MEMORY_PAGE_SIZE] = MEMORY_WATCH_NONE;
+        Memory_UpdatePage(ctx, mem->Watch[i].Addr / MEMORY_PAGE_SIZE);
     }
+
+    mem->WatchCount = 0;
+    mem->WatchHit.Kind = MEMORY_WATCH_NONE;
 }
 
 
-void Memory_LoadFile(char const * file, uint16_t addr)
+int Memory_LoadFile(Emu_Context_t * ctx, char const * file, uint16_t addr)
 {
     /* Open file */
     FILE *pFile = fopen(file, "r");
     if(pFile == NULL)
     {
         DEBUGGER_ERROR("LoadFile Error: %s\n", strerror(errno));
-        return;
+        return -1;
     }
 
     /* Fill file data to the memory at the specified address */
@@ -98,24 +318,412 @@ void Memory_LoadFile(char const * file, uint16_t addr)
             break;
         }
 
-        Memory_Table[i] = c;
+        uint8_t * page = ctx->Memory.Write[i / MEMORY_PAGE_SIZE];
+        if(page != NULL)
+        {
+            page[i % MEMORY_PAGE_SIZE] = c;
+        }
+        else
+        {
+            ctx->Memory.WriteHandler[i / MEMORY_PAGE_SIZE](ctx, i, c);
+        }
+    }
+
+    fclose(pFile);
+
+    /* Drop instruction decoded from the previous content */
+    Cpu_FlushCache(ctx);
+
+    return 0;
+}
+
+
+int Memory_LoadBoot(Emu_Context_t * ctx, char const * file)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+
+    FILE *pFile = fopen(file, "rb");
+    if(pFile == NULL)
+    {
+        DEBUGGER_ERROR("LoadBoot Error: %s\n", strerror(errno));
+        return -1;
     }
 
+    memset(mem->Boot, 0, sizeof(mem->Boot));
+    size_t const size = fread(mem->Boot, 1, sizeof(mem->Boot), pFile);
     fclose(pFile);
+    if(size == 0)
+    {
+        return -1;
+    }
+
+    /* Overlay the cartridge header page */
+    mem->BootEnabled = true;
+    Cartridge_MapRom(ctx);
+
+    return 0;
+}
+
+
+void Memory_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    TRACE_ACCESS(ctx, TRACE_KIND_WRITE, addr, data);
+
+    /* Fast path: plain RAM */
+    uint8_t * page = ctx->Memory.Write[addr / MEMORY_PAGE_SIZE];
+    if(page != NULL)
+    {
+        page[addr % MEMORY_PAGE_SIZE] = data;
+        Cpu_InvalidateCache(ctx, addr);
+        return;
+    }
+
+    ctx->Memory.WriteHandler[addr / MEMORY_PAGE_SIZE](ctx, addr, data);
 }
 
 
-void Memory_Write(uint16_t addr, uint8_t data)
+uint8_t Memory_Read(Emu_Context_t * ctx, uint16_t addr)
 {
-    DEBUGGER_TRACE("Write 0x%04X: 0x%02X\n", addr, data);
-    Memory_Table[addr] = data;
+    /* Fast path: plain RAM and ROM */
+    uint8_t const * page = ctx->Memory.Read[addr / MEMORY_PAGE_SIZE];
+    uint8_t const data = (page != NULL) ? page[addr % MEMORY_PAGE_SIZE]
+                                        : ctx->Memory.ReadHandler[addr / MEMORY_PAGE_SIZE](ctx, addr);
+
+    TRACE_ACCESS(ctx, TRACE_KIND_READ, addr, data);
+    return data;
 }
 
 
-uint8_t Memory_Read(uint16_t addr)
+/**
+ * Read an unmapped address
+ * @param ctx The emulator context
+ * @param addr The address to read
+ * @return The open bus value
+ */
+static uint8_t Memory_ReadOpen(Emu_Context_t * ctx, uint16_t addr)
 {
-    DEBUGGER_TRACE("Read 0x%04X: 0x%02X\n", addr, Memory_Table[addr]);
-    return Memory_Table[addr];
+    /* Unused parameter */
+    (void) ctx;
+    (void) addr;
+
+    return 0xFF;
 }
 
 
+/**
+ * Write an unmapped or read only address
+ * @param ctx The emulator context
+ * @param addr The address to write
+ * @param data The data to write
+ */
+static void Memory_WriteIgnore(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    /* Unused parameter (DEBUGGER_TRACE may be compiled out) */
+    (void) ctx;
+    (void) addr;
+    (void) data;
+
+    DEBUGGER_TRACE("Ignored write 0x%04X: 0x%02X\n", addr, data);
+}
+
+
+/**
+ * Read the I/O page
+ * @param ctx The emulator context
+ * @param addr The address to read (0xFF00-0xFFFF)
+ * @return The register value
+ */
+static uint8_t Memory_ReadIo(Emu_Context_t * ctx, uint16_t addr)
+{
+    Memory_ReadHandler_t const handler = ctx->Memory.IoRead[addr % MEMORY_PAGE_SIZE];
+    if(handler != NULL)
+    {
+        return handler(ctx, addr);
+    }
+
+    return ctx->Memory.Io[addr % MEMORY_PAGE_SIZE];
+}
+
+
+/**
+ * Write the I/O page
+ * @param ctx The emulator context
+ * @param addr The address to write (0xFF00-0xFFFF)
+ * @param data The data to write
+ */
+static void Memory_WriteIo(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Memory_WriteHandler_t const handler = ctx->Memory.IoWrite[addr % MEMORY_PAGE_SIZE];
+    if(handler != NULL)
+    {
+        handler(ctx, addr, data);
+        return;
+    }
+
+    ctx->Memory.Io[addr % MEMORY_PAGE_SIZE] = data;
+
+    /* High RAM can hold code (OAM DMA routine) */
+    Cpu_InvalidateCache(ctx, addr);
+}
+
+
+/**
+ * Write the boot ROM disable register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @param data The data to write
+ */
+static void Memory_WriteBoot(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+
+    mem->Io[addr % MEMORY_PAGE_SIZE] = data;
+
+    /* Unmap the boot ROM for good */
+    if((data != 0) && mem->BootEnabled)
+    {
+        mem->BootEnabled = false;
+        Cartridge_MapRom(ctx);
+    }
+}
+
+
+/**
+ * Apply the mapping of a page to the page table
+ * @param ctx The emulator context
+ * @param page The page index
+ */
+static void Memory_UpdatePage(Emu_Context_t * ctx, int page)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+    uint8_t const watch = mem->WatchPage[page];
+
+    /* A watched access always take the handler path */
+    if(watch & MEMORY_WATCH_READ)
+    {
+        mem->Read[page] = NULL;
+        mem->ReadHandler[page] = Memory_ReadWatch;
+    }
+    else
+    {
+        mem->Read[page] = mem->MapRead[page];
+        mem->ReadHandler[page] = mem->MapReadHandler[page];
+    }
+
+    if(watch & MEMORY_WATCH_WRITE)
+    {
+        mem->Write[page] = NULL;
+        mem->WriteHandler[page] = Memory_WriteWatch;
+    }
+    else if(Memory_IsShared(mem, page))
+    {
+        mem->Write[page] = NULL;
+        mem->WriteHandler[page] = Memory_WriteShared;
+    }
+    else
+    {
+        mem->Write[page] = mem->MapWrite[page];
+        mem->WriteHandler[page] = mem->MapWriteHandler[page];
+    }
+}
+
+
+/**
+ * Read a page with a read watchpoint
+ * @param ctx The emulator context
+ * @param addr The address to read
+ * @return The read data
+ */
+static uint8_t Memory_ReadWatch(Emu_Context_t * ctx, uint16_t addr)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+    uint8_t const * page = mem->MapRead[addr / MEMORY_PAGE_SIZE];
+    uint8_t const data = (page != NULL) ? page[addr % MEMORY_PAGE_SIZE]
+                                        : mem->MapReadHandler[addr / MEMORY_PAGE_SIZE](ctx, addr);
+
+    Memory_CheckWatch(ctx, addr, data, MEMORY_WATCH_READ);
+    return data;
+}
+
+
+/**
+ * Write a page with a write watchpoint
+ * @param ctx The emulator context
+ * @param addr The address to write
+ * @param data The data to write
+ */
+static void Memory_WriteWatch(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Memory_Info_t const * mem = &ctx->Memory;
+
+    Memory_CheckWatch(ctx, addr, data, MEMORY_WATCH_WRITE);
+
+    if(Memory_IsShared(mem, addr / MEMORY_PAGE_SIZE))
+    {
+        Memory_WriteShared(ctx, addr, data);
+        return;
+    }
+
+    Memory_WriteMapped(ctx, addr, data);
+}
+
+
+/**
+ * Stop the CPU if an access match a watchpoint
+ * @param ctx The emulator context
+ * @param addr The accessed address
+ * @param data The accessed data
+ * @param kind The Memory_Watch_e access
+ */
+static void Memory_CheckWatch(Emu_Context_t * ctx, uint16_t addr, uint8_t data, uint8_t kind)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+
+    if(!mem->WatchEnabled)
+    {
+        return;
+    }
+
+    for(int i=0; i<mem->WatchCount; i++)
+    {
+        Memory_Watch_t const * watch = &mem->Watch[i];
+        if((watch->Addr == addr) && (watch->Kind & kind) &&
+           ((watch->Value == MEMORY_WATCH_ANY) || (watch->Value == data)))
+        {
+            mem->WatchHit.Addr  = addr;
+            mem->WatchHit.Value = data;
+            mem->WatchHit.Kind  = kind;
+            Cpu_RequestBreak(ctx);
+            return;
+        }
+    }
+}
+
+
+/**
+ * Set the mapping of a page
+ * @param ctx The emulator context
+ * @param page The page index
+ * @param read The host memory for read, NULL to use readHandler
+ * @param write The host memory for write, NULL to use writeHandler
+ * @param readHandler The read handler (NULL: open bus)
+ * @param writeHandler The write handler (NULL: ignored)
+ * @param bank The bank holding the host memory (MEMORY_BANK_NONE: none)
+ */
+static void Memory_MapPage(Emu_Context_t * ctx, int page, uint8_t const * read, uint8_t * write,
+                           Memory_ReadHandler_t readHandler, Memory_WriteHandler_t writeHandler, uint8_t bank)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+
+    mem->MapRead[page]  = read;
+    mem->MapWrite[page] = write;
+    mem->MapReadHandler[page]  = (readHandler  != NULL) ? readHandler  : Memory_ReadOpen;
+    mem->MapWriteHandler[page] = (writeHandler != NULL) ? writeHandler : Memory_WriteIgnore;
+    mem->MapBank[page] = bank;
+    Memory_UpdatePage(ctx, page);
+}
+
+
+/**
+ * Write through the page mapping
+ * @param ctx The emulator context
+ * @param addr The address to write
+ * @param data The data to write
+ */
+static void Memory_WriteMapped(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Memory_Info_t const * mem = &ctx->Memory;
+
+    uint8_t * page = mem->MapWrite[addr / MEMORY_PAGE_SIZE];
+    if(page != NULL)
+    {
+        page[addr % MEMORY_PAGE_SIZE] = data;
+        Cpu_InvalidateCache(ctx, addr);
+        return;
+    }
+
+    mem->MapWriteHandler[addr / MEMORY_PAGE_SIZE](ctx, addr, data);
+}
+
+
+/**
+ * Write a page of a shared bank: take a private copy of the bank first
+ * @param ctx The emulator context
+ * @param addr The address to write
+ * @param data The data to write
+ */
+static void Memory_WriteShared(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+    int const bank = mem->MapBank[addr / MEMORY_PAGE_SIZE];
+    Memory_Bank_t * const shared = mem->Bank[bank];
+
+    if(Memory_GetBank(ctx, bank) == NULL)
+    {
+        return;
+    }
+
+    /* The other context released it first: the bank is ours without copy */
+    if(mem->Bank[bank] == shared)
+    {
+        Memory_SetBank(ctx, bank, shared);
+    }
+
+    Memory_WriteMapped(ctx, addr, data);
+}
+
+
+/**
+ * Check if a page is held by a bank shared with another context
+ * @param mem The memory info
+ * @param page The page index
+ * @return true if a write must copy the bank first
+ */
+static bool Memory_IsShared(Memory_Info_t const * mem, int page)
+{
+    uint8_t const bank = mem->MapBank[page];
+
+    return (bank != MEMORY_BANK_NONE) && (__atomic_load_n(&mem->Bank[bank]->Ref, __ATOMIC_ACQUIRE) != 1);
+}
+
+
+/**
+ * Replace the host memory of a bank and move the pages mapping it
+ * @param ctx The emulator context
+ * @param bank The bank index
+ * @param data The new host memory (NULL: the pages are unmapped)
+ * @note The previous host memory is released, unless it is the same
+ */
+static void Memory_SetBank(Emu_Context_t * ctx, int bank, Memory_Bank_t * data)
+{
+    Memory_Info_t * mem = &ctx->Memory;
+    Memory_Bank_t * const previous = mem->Bank[bank];
+
+    mem->Bank[bank] = data;
+    for(int page=0; page<MEMORY_PAGE_COUNT; page++)
+    {
+        if(mem->MapBank[page] != bank)
+        {
+            continue;
+        }
+
+        if(data == NULL)
+        {
+            Memory_MapPage(ctx, page, NULL, NULL, NULL, NULL, MEMORY_BANK_NONE);
+            continue;
+        }
+
+        ptrdiff_t const offset = mem->MapRead[page] - previous->Data;
+        mem->MapRead[page] = data->Data + offset;
+        if(mem->MapWrite[page] != NULL)
+        {
+            mem->MapWrite[page] = data->Data + offset;
+        }
+        Memory_UpdatePage(ctx, page);
+    }
+
+    if((previous != NULL) && (previous != data) && (__atomic_sub_fetch(&previous->Ref, 1, __ATOMIC_ACQ_REL) == 0))
+    {
+        free(previous);
+    }
+}
@@ -2,25 +2,26 @@
  * GameBoyPlay - Simple Gameboy emulator written in C.
  * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
  *
- * Permission is hereby granted, free of charge, to any person obtaining a copy 
- * of this software and associated documentation files (the "Software"), to deal 
- * in the Software without restriction, including without limitation the rights 
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
- * copies of the Software, and to permit persons to whom the Software is 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
  * furnished to do so, subject to the following conditions:
  *
- * The above copyright notice and this permission notice shall be included in 
+ * The above copyright notice and this permission notice shall be included in
  * all copies or substantial portions of the Software.
  *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
- * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
  * DEALINGS IN THE SOFTWARE.
  */
 
+
 #ifndef _MEMORY_H_
 #define _MEMORY_H_
 
@@ -29,6 +30,7 @@
 /* Include                                            */
 /******************************************************/
 
+#include <stdbool.h>
 #include <stdint.h>
 
 
@@ -36,11 +38,142 @@
 /* Macro                                              */
 /******************************************************/
 
+/** 16 bit addressable memory space size */
+#define MEMORY_TABLE_SIZE   0x00010000
+
+/** Memory page size (256 byte: page index is the address high byte) */
+#define MEMORY_PAGE_SIZE    0x0100
+
+/** Number of memory page */
+#define MEMORY_PAGE_COUNT   (MEMORY_TABLE_SIZE / MEMORY_PAGE_SIZE)
+
+/** Boot ROM overlay size */
+#define MEMORY_BOOT_SIZE    0x0100
+
+/** Video RAM size */
+#define MEMORY_VRAM_SIZE    0x2000
+
+/** Work RAM size */
+#define MEMORY_WRAM_SIZE    0x2000
+
+/** Copy-on-write bank size */
+#define MEMORY_BANK_SIZE    0x2000
+
+/** Video RAM bank */
+#define MEMORY_BANK_VRAM    0
+
+/** Work RAM bank */
+#define MEMORY_BANK_WRAM    1
+
+/** First external RAM bank */
+#define MEMORY_BANK_EXTERNAL 2
+
+/** Number of bank: VRAM, WRAM and 16 external RAM bank (128 KiB) */
+#define MEMORY_BANK_COUNT   (MEMORY_BANK_EXTERNAL + 16)
+
+/** Page not backed by a bank */
+#define MEMORY_BANK_NONE    0xFF
+
+/**
+ * Get the host memory of a bank for read
+ * @param ctx The emulator context
+ * @param bank The bank index
+ * @note Write through Memory_GetBank: the bank may be shared
+ */
+#define MEMORY_BANK(ctx, bank)  ((uint8_t const *)(ctx)->Memory.Bank[bank]->Data)
+
+/** Boot ROM disable register */
+#define MEMORY_REG_BOOT     0xFF50
+
+/** Max number of watchpoint */
+#define MEMORY_WATCH_COUNT  16
+
+/** Watchpoint value matching any data */
+#define MEMORY_WATCH_ANY    0x0100
+
 
 /******************************************************/
 /* Type                                               */
 /******************************************************/
 
+/**
+ * Read callback of a page without host memory
+ * @param ctx The emulator context
+ * @param addr The address to read
+ * @return The read data
+ */
+typedef uint8_t (*Memory_ReadHandler_t)(struct tagEmu_Context_t * ctx, uint16_t addr);
+
+/**
+ * Write callback of a page without host memory
+ * @param ctx The emulator context
+ * @param addr The address to write
+ * @param data The data to write
+ */
+typedef void (*Memory_WriteHandler_t)(struct tagEmu_Context_t * ctx, uint16_t addr, uint8_t data);
+
+/** Watched access kind */
+typedef enum tagMemory_Watch_e
+{
+    MEMORY_WATCH_NONE   = 0x00, /**< No access */
+    MEMORY_WATCH_READ   = 0x01, /**< Read access */
+    MEMORY_WATCH_WRITE  = 0x02, /**< Write access */
+    MEMORY_WATCH_ACCESS = 0x03  /**< Read or write access */
+} Memory_Watch_e;
+
+/** Watchpoint */
+typedef struct tagMemory_Watch_t
+{
+    uint16_t Addr;      /**< Watched address */
+    uint16_t Value;     /**< Data to match (MEMORY_WATCH_ANY: any) */
+    uint8_t Kind;       /**< Memory_Watch_e watched access */
+} Memory_Watch_t;
+
+/**
+ * Host memory of a RAM bank, shared by forked context until one write it
+ * @note Only a bank referenced once can be written
+ */
+typedef struct tagMemory_Bank_t
+{
+    uint32_t Ref;                       /**< Number of context using the bank (atomic) */
+    uint8_t Data[MEMORY_BANK_SIZE];     /**< Content */
+} Memory_Bank_t;
+
+/**
+ * Memory Info
+ * @note A page with a host pointer is accessed directly, otherwise through its handler
+ * @note The page table is the page mapping, except for a page with a watchpoint
+ *       whose watched access is redirected to the watch handler, and for a page of
+ *       a shared bank whose write is redirected to the copy-on-write handler
+ */
+typedef struct tagMemory_Info_t
+{
+    uint8_t const * Read[MEMORY_PAGE_COUNT];                /**< Host memory of each page for read (NULL: handler) */
+    uint8_t * Write[MEMORY_PAGE_COUNT];                     /**< Host memory of each page for write (NULL: handler) */
+    Memory_ReadHandler_t ReadHandler[MEMORY_PAGE_COUNT];    /**< Read handler of each page */
+    Memory_WriteHandler_t WriteHandler[MEMORY_PAGE_COUNT];  /**< Write handler of each page */
+    uint8_t const * MapRead[MEMORY_PAGE_COUNT];             /**< Mapped host memory for read */
+    uint8_t * MapWrite[MEMORY_PAGE_COUNT];                  /**< Mapped host memory for write */
+    Memory_ReadHandler_t MapReadHandler[MEMORY_PAGE_COUNT]; /**< Mapped read handler */
+    Memory_WriteHandler_t MapWriteHandler[MEMORY_PAGE_COUNT]; /**< Mapped write handler */
+    uint8_t MapBank[MEMORY_PAGE_COUNT];                     /**< Bank holding the host memory of each page (MEMORY_BANK_NONE: none) */
+    Memory_Bank_t * Bank[MEMORY_BANK_COUNT];                /**< Copy-on-write RAM bank (NULL: not allocated) */
+    uint8_t WatchPage[MEMORY_PAGE_COUNT];                   /**< Memory_Watch_e access watched in each page */
+    Memory_Watch_t Watch[MEMORY_WATCH_COUNT];               /**< Watchpoint list (kept on reset) */
+    int WatchCount;                                         /**< Watchpoint count */
+    Memory_Watch_t WatchHit;                                /**< Last watchpoint hit, Value is the data (Kind: none) */
+    bool WatchEnabled;                                      /**< Watchpoint are checked (cleared for debugger access) */
+    uint8_t Boot[MEMORY_BOOT_SIZE];                         /**< Boot ROM overlay (0x0000-0x00FF) */
+    uint8_t Oam[MEMORY_PAGE_SIZE];                          /**< Sprite attribute table (0xFE00-0xFEFF) */
+    uint8_t Io[MEMORY_PAGE_SIZE];                           /**< I/O register, high RAM and IE (0xFF00-0xFFFF) */
+    Memory_ReadHandler_t IoRead[MEMORY_PAGE_SIZE];          /**< Read handler of each I/O register (NULL: Io value) */
+    Memory_WriteHandler_t IoWrite[MEMORY_PAGE_SIZE];        /**< Write handler of each I/O register (NULL: Io value) */
+    bool BootEnabled;                                       /**< Boot ROM overlay mapped */
+} Memory_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
 
 /******************************************************/
 /* Prototype                                          */
@@ -48,27 +181,135 @@
 
 /**
  * Initialize Memory
+ * @param ctx The emulator context
+ * @return 0 if successful, otherwise -1
+ * @note VRAM is bank MEMORY_BANK_VRAM, WRAM (0xC000-0xDFFF, echo 0xE000-0xFDFF) is MEMORY_BANK_WRAM
+ */
+extern int Memory_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Release all bank
+ * @param ctx The emulator context
+ */
+extern void Memory_Finalize(Emu_Context_t * ctx);
+
+/**
+ * Map a page aligned address range
+ * @param ctx The emulator context
+ * @param addr The first address (page aligned)
+ * @param size The range size (page multiple)
+ * @param read The host memory for read, NULL to use readHandler
+ * @param write The host memory for write, NULL to use writeHandler
+ * @param readHandler The read handler (NULL: open bus)
+ * @param writeHandler The write handler (NULL: ignored)
+ */
+extern void Memory_Map(Emu_Context_t * ctx, uint16_t addr, uint32_t size, uint8_t const * read, uint8_t * write,
+                       Memory_ReadHandler_t readHandler, Memory_WriteHandler_t writeHandler);
+
+/**
+ * Map a bank on a page aligned address range
+ * @param ctx The emulator context
+ * @param addr The first address (page aligned)
+ * @param size The range size (page multiple, at most MEMORY_BANK_SIZE)
+ * @param bank The bank index, its host memory is read directly
+ * @param writeHandler The write handler, NULL to write the host memory directly
+ * @note The pages follow the bank when a write makes a private copy of it
  */
-extern void Memory_Initialize(void);
+extern void Memory_MapBank(Emu_Context_t * ctx, uint16_t addr, uint32_t size, int bank,
+                           Memory_WriteHandler_t writeHandler);
+
+/**
+ * Give a bank a cleared host memory of its own
+ * @param ctx The emulator context
+ * @param bank The bank index
+ * @return 0 if successful, otherwise -1
+ */
+extern int Memory_AllocateBank(Emu_Context_t * ctx, int bank);
+
+/**
+ * Release a bank
+ * @param ctx The emulator context
+ * @param bank The bank index (must not be mapped anymore)
+ */
+extern void Memory_ReleaseBank(Emu_Context_t * ctx, int bank);
+
+/**
+ * Get the host memory of a bank for write
+ * @param ctx The emulator context
+ * @param bank The bank index
+ * @return The host memory, a shared bank is copied first (NULL if out of memory)
+ */
+extern uint8_t * Memory_GetBank(Emu_Context_t * ctx, int bank);
+
+/**
+ * Share the memory of a context with a fork
+ * @param fork The emulator context receiving the memory
+ * @param ctx The emulator context to fork
+ * @note Every bank become copy-on-write in both context, the other memory is copied.
+ *       The cartridge must map its bank again (Cartridge_Share).
+ */
+extern void Memory_Share(Emu_Context_t * fork, Emu_Context_t * ctx);
+
+/**
+ * Attach a peripheral to an I/O register
+ * @param ctx The emulator context
+ * @param addr The register address (0xFF00-0xFFFF)
+ * @param readHandler The read handler (NULL: read the Io value)
+ * @param writeHandler The write handler (NULL: store to the Io value)
+ */
+extern void Memory_MapIo(Emu_Context_t * ctx, uint16_t addr,
+                         Memory_ReadHandler_t readHandler, Memory_WriteHandler_t writeHandler);
+
+/**
+ * Set a watchpoint, the CPU stop after the instruction doing the access
+ * @param ctx The emulator context
+ * @param addr The watched address
+ * @param kind The Memory_Watch_e watched access
+ * @param value The data to match, MEMORY_WATCH_ANY for any data
+ * @return 0 if successful, otherwise -1
+ * @note Only the page of the address leave the direct access path
+ * @note The instruction fetch of the decoder is a read access
+ */
+extern int Memory_SetWatch(Emu_Context_t * ctx, uint16_t addr, uint8_t kind, uint16_t value);
+
+/**
+ * Remove all watchpoint
+ * @param ctx The emulator context
+ */
+extern void Memory_ClearWatch(Emu_Context_t * ctx);
 
 /**
  * Load binary file
+ * @param ctx The emulator context
  * @param file The binary file name
+ * @param addr The load address
+ * @return 0 if successful, otherwise -1
+ * @note The data goes through the write mapping: use Cartridge_Load for ROM
  */
-extern void Memory_LoadFile(char const * file, uint16_t addr);
+extern int Memory_LoadFile(Emu_Context_t * ctx, char const * file, uint16_t addr);
+
+/**
+ * Load a boot ROM and map it over the cartridge until 0xFF50 is written
+ * @param ctx The emulator context
+ * @param file The boot ROM file name
+ * @return 0 if successful, otherwise -1
+ */
+extern int Memory_LoadBoot(Emu_Context_t * ctx, char const * file);
 
 /**
  * Write Memory Address
+ * @param ctx The emulator context
  * @param addr The address to write
  * @param data The data to write to addr
  */
-extern void Memory_Write(uint16_t addr, uint8_t data);
+extern void Memory_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
 
 /**
  * Read Memory Address
+ * @param ctx The emulator context
  * @param addr The address to read
  */
-extern uint8_t Memory_Read(uint16_t addr);
+extern uint8_t Memory_Read(Emu_Context_t * ctx, uint16_t addr);
 
 
 /******************************************************/
@@ -82,4 +323,3 @@ extern uint8_t Memory_Read(uint16_t addr);
 
 
 #endif /* _MEMORY_H_ */
-
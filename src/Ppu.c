@@ -0,0 +1,705 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <Emu.h>
+#include <Tile.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Number of cycle of the sprite attribute scan */
+#define PPU_OAM_CYCLE           80
+
+/** Number of cycle of the pixel transfer */
+#define PPU_TRANSFER_CYCLE      172
+
+/** Number of cycle of the horizontal blank */
+#define PPU_HBLANK_CYCLE        (PPU_LINE_CYCLE - PPU_OAM_CYCLE - PPU_TRANSFER_CYCLE)
+
+/** LCDC: background and window enable */
+#define PPU_LCDC_BG_ENABLE      0x01
+
+/** LCDC: sprite enable */
+#define PPU_LCDC_OBJ_ENABLE     0x02
+
+/** LCDC: 8x16 sprite */
+#define PPU_LCDC_OBJ_SIZE       0x04
+
+/** LCDC: background tile map at 0x9C00 */
+#define PPU_LCDC_BG_MAP         0x08
+
+/** LCDC: tile data at 0x8000 (unsigned index) */
+#define PPU_LCDC_TILE_DATA      0x10
+
+/** LCDC: window enable */
+#define PPU_LCDC_WIN_ENABLE     0x20
+
+/** LCDC: window tile map at 0x9C00 */
+#define PPU_LCDC_WIN_MAP        0x40
+
+/** LCDC: LCD enable */
+#define PPU_LCDC_LCD_ENABLE     0x80
+
+/** STAT: first mode interrupt source bit (HBLANK, VBLANK then OAM) */
+#define PPU_STAT_MODE_SOURCE    0x08
+
+/** STAT: line compare interrupt source */
+#define PPU_STAT_LYC_SOURCE     0x40
+
+/** STAT: line compare match flag */
+#define PPU_STAT_LYC_MATCH      0x04
+
+/** STAT: writable bit */
+#define PPU_STAT_WRITE_MASK     0x78
+
+/** Tile map offsets in VRAM */
+#define PPU_VRAM_MAP_LOW        0x1800
+#define PPU_VRAM_MAP_HIGH       0x1C00
+
+/** Video RAM address */
+#define PPU_VRAM_BASE           0x8000
+
+/** Size of the tile data area in VRAM */
+#define PPU_VRAM_TILE_SIZE      (PPU_TILE_COUNT * PPU_TILE_SIZE)
+
+/** Signed tile data base offset in VRAM */
+#define PPU_VRAM_TILE_SIGNED    0x1000
+
+/** Size of a tile in byte (8 row of 2 bitplane) */
+#define PPU_TILE_SIZE           16
+
+/** Number of tile per tile map row */
+#define PPU_MAP_WIDTH           32
+
+/** Number of sprite in OAM */
+#define PPU_SPRITE_COUNT        40
+
+/** Maximum number of sprite on one line */
+#define PPU_SPRITE_LINE_MAX     10
+
+/** Size of the sprite attribute table copied by an OAM DMA */
+#define PPU_DMA_SIZE            (PPU_SPRITE_COUNT * 4)
+
+/** OAM sprite attribute: behind background color 1-3 */
+#define PPU_ATTR_PRIORITY       0x80
+
+/** OAM sprite attribute: vertical flip */
+#define PPU_ATTR_YFLIP          0x40
+
+/** OAM sprite attribute: horizontal flip */
+#define PPU_ATTR_XFLIP          0x20
+
+/** OAM sprite attribute: palette */
+#define PPU_ATTR_PALETTE        0x10
+
+/** Line buffer margin so a whole tile row can be written at any X */
+#define PPU_LINE_MARGIN         8
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static uint8_t Ppu_Read(Emu_Context_t * ctx, uint16_t addr);
+static void Ppu_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static void Ppu_WriteDma(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static void Ppu_Event(Emu_Context_t * ctx, uint64_t deadline);
+static void Ppu_UpdateStat(Emu_Context_t * ctx);
+static void Ppu_StartFrame(Emu_Context_t * ctx);
+static void Ppu_RenderLine(Emu_Context_t * ctx);
+static void Ppu_WriteVram(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static uint8_t const * Ppu_GetTileRow(Emu_Context_t * ctx, uint16_t tile, int row);
+static void Ppu_RenderTileRow(Emu_Context_t * ctx, uint8_t * line, int x, uint16_t map, uint8_t y);
+static void Ppu_RenderSprite(Emu_Context_t * ctx, uint8_t const * color, uint8_t * frame);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+void Ppu_Initialize(Emu_Context_t * ctx)
+{
+    /* The render interval is a host setting */
+    uint32_t const interval = ctx->Ppu.RenderInterval;
+    memset(&ctx->Ppu, 0, sizeof(ctx->Ppu));
+    ctx->Ppu.RenderInterval = interval;
+    Ppu_FlushTileCache(ctx);
+
+    Scheduler_Cancel(ctx, SCHEDULER_EVENT_PPU);
+
+    /* Tile data write go through the PPU to keep the decoded cache, read stay direct */
+    Memory_MapBank(ctx, PPU_VRAM_BASE, PPU_VRAM_TILE_SIZE, MEMORY_BANK_VRAM, Ppu_WriteVram);
+
+    /* The OAM DMA register keep its value in the I/O page */
+    for(uint16_t addr = PPU_REG_LCDC; addr <= PPU_REG_WX; addr++)
+    {
+        if(addr != PPU_REG_DMA)
+        {
+            Memory_MapIo(ctx, addr, Ppu_Read, Ppu_Write);
+        }
+    }
+    Memory_MapIo(ctx, PPU_REG_DMA, NULL, Ppu_WriteDma);
+}
+
+
+void Ppu_Restore(Emu_Context_t * ctx, uint64_t deadline)
+{
+    Ppu_FlushTileCache(ctx);
+
+    Scheduler_Cancel(ctx, SCHEDULER_EVENT_PPU);
+    if(deadline != SCHEDULER_NEVER)
+    {
+        Scheduler_Schedule(ctx, SCHEDULER_EVENT_PPU, deadline, Ppu_Event);
+    }
+}
+
+
+void Ppu_SetRenderInterval(Emu_Context_t * ctx, uint32_t interval)
+{
+    ctx->Ppu.RenderInterval = interval;
+}
+
+
+void Ppu_FlushTileCache(Emu_Context_t * ctx)
+{
+    memset(ctx->Ppu.TileDirty, 0xFF, sizeof(ctx->Ppu.TileDirty));
+}
+
+
+uint8_t const * Ppu_GetFrame(Emu_Context_t const * ctx)
+{
+    return &ctx->Ppu.Frame[0][0];
+}
+
+
+uint64_t Ppu_GetFrameCount(Emu_Context_t const * ctx)
+{
+    return ctx->Ppu.FrameCount;
+}
+
+
+void Ppu_RenderFrame(Emu_Context_t * ctx)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+    uint8_t const ly = ppu->Ly;
+    uint8_t const windowLine = ppu->WindowLine;
+
+    ppu->WindowLine = 0;
+    for(int y=0; y<PPU_SCREEN_HEIGHT; y++)
+    {
+        ppu->Ly = y;
+        Ppu_RenderLine(ctx);
+    }
+
+    ppu->Ly = ly;
+    ppu->WindowLine = windowLine;
+}
+
+
+int Ppu_SaveFrame(Emu_Context_t const * ctx, char const * file)
+{
+    FILE * pFile = fopen(file, "wb");
+    if(pFile == NULL)
+    {
+        DEBUGGER_ERROR("Ppu Error: %s: %s\n", file, strerror(errno));
+        return -1;
+    }
+
+    /* Binary graymap: shade 0 is white */
+    uint8_t pixel[PPU_SCREEN_WIDTH];
+    fprintf(pFile, "P5\n%d %d\n255\n", PPU_SCREEN_WIDTH, PPU_SCREEN_HEIGHT);
+    for(int y=0; y<PPU_SCREEN_HEIGHT; y++)
+    {
+        for(int x=0; x<PPU_SCREEN_WIDTH; x++)
+        {
+            pixel[x] = 255 - ctx->Ppu.Frame[y][x] * 85;
+        }
+        fwrite(pixel, 1, sizeof(pixel), pFile);
+    }
+
+    if(fclose(pFile) != 0)
+    {
+        DEBUGGER_ERROR("Ppu Error: %s: %s\n", file, strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+
+/**
+ * Read a PPU register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @return The register value
+ */
+static uint8_t Ppu_Read(Emu_Context_t * ctx, uint16_t addr)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+
+    switch(addr)
+    {
+        case PPU_REG_LCDC:
+            return ppu->Lcdc;
+        case PPU_REG_STAT:
+            return 0x80 | ppu->Stat | ((ppu->Ly == ppu->Lyc) ? PPU_STAT_LYC_MATCH : 0) | ppu->Mode;
+        case PPU_REG_SCY:
+            return ppu->Scy;
+        case PPU_REG_SCX:
+            return ppu->Scx;
+        case PPU_REG_LY:
+            return ppu->Ly;
+        case PPU_REG_LYC:
+            return ppu->Lyc;
+        case PPU_REG_BGP:
+            return ppu->Bgp;
+        case PPU_REG_OBP0:
+            return ppu->Obp[0];
+        case PPU_REG_OBP1:
+            return ppu->Obp[1];
+        case PPU_REG_WY:
+            return ppu->Wy;
+        default:
+            return ppu->Wx;
+    }
+}
+
+
+/**
+ * Write a PPU register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @param data The data to write
+ */
+static void Ppu_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+
+    switch(addr)
+    {
+        case PPU_REG_LCDC:
+            if((data & ~ppu->Lcdc) & PPU_LCDC_LCD_ENABLE)
+            {
+                /* LCD on: the first line starts now */
+                ppu->Ly = 0;
+                ppu->Mode = PPU_MODE_OAM;
+                Ppu_StartFrame(ctx);
+                Scheduler_Schedule(ctx, SCHEDULER_EVENT_PPU, ctx->Cpu.Cycle + PPU_OAM_CYCLE, Ppu_Event);
+            }
+            else if((ppu->Lcdc & ~data) & PPU_LCDC_LCD_ENABLE)
+            {
+                /* LCD off: the PPU stops at line 0 */
+                ppu->Ly = 0;
+                ppu->Mode = PPU_MODE_HBLANK;
+                Scheduler_Cancel(ctx, SCHEDULER_EVENT_PPU);
+            }
+            ppu->Lcdc = data;
+            break;
+        case PPU_REG_STAT:
+            ppu->Stat = data & PPU_STAT_WRITE_MASK;
+            break;
+        case PPU_REG_SCY:
+            ppu->Scy = data;
+            break;
+        case PPU_REG_SCX:
+            ppu->Scx = data;
+            break;
+        case PPU_REG_LY:
+            /* Read only */
+            break;
+        case PPU_REG_LYC:
+            ppu->Lyc = data;
+            break;
+        case PPU_REG_BGP:
+            ppu->Bgp = data;
+            break;
+        case PPU_REG_OBP0:
+            ppu->Obp[0] = data;
+            break;
+        case PPU_REG_OBP1:
+            ppu->Obp[1] = data;
+            break;
+        case PPU_REG_WY:
+            ppu->Wy = data;
+            break;
+        default:
+            ppu->Wx = data;
+            break;
+    }
+
+    Ppu_UpdateStat(ctx);
+}
+
+
+/**
+ * Write the OAM DMA register: copy 0xXX00-0xXX9F to the sprite attribute table
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @param data The source address high Byte
+ * @note The copy is done at once, the CPU is not restricted to high RAM during the 160 us transfer
+ */
+static void Ppu_WriteDma(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    ctx->Memory.Io[addr % MEMORY_PAGE_SIZE] = data;
+
+    uint16_t const source = (uint16_t)data << 8;
+    for(uint16_t i=0; i<PPU_DMA_SIZE; i++)
+    {
+        ctx->Memory.Oam[i] = Memory_Read(ctx, source + i);
+    }
+}
+
+
+/**
+ * Write the VRAM tile data
+ * @param ctx The emulator context
+ * @param addr The address to write (0x8000-0x97FF)
+ * @param data The data to write
+ */
+static void Ppu_WriteVram(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    uint16_t const offset = addr - PPU_VRAM_BASE;
+
+    /* A shared bank is copied before the write reach the handler */
+    uint8_t * const vram = ctx->Memory.Bank[MEMORY_BANK_VRAM]->Data;
+
+    /* Tile upload often rewrite the same data */
+    if(vram[offset] == data)
+    {
+        return;
+    }
+
+    vram[offset] = data;
+
+    uint16_t const tile = offset / PPU_TILE_SIZE;
+    ctx->Ppu.TileDirty[tile / 64] |= 1ULL << (tile % 64);
+
+    /* VRAM can hold code */
+    Cpu_InvalidateCache(ctx, addr);
+}
+
+
+/**
+ * Get a decoded tile row, decoding the tile if it was written since last use
+ * @param ctx The emulator context
+ * @param tile The tile number (0 - PPU_TILE_COUNT-1)
+ * @param row The row in the tile
+ * @return The TILE_ROW_WIDTH color index
+ */
+static uint8_t const * Ppu_GetTileRow(Emu_Context_t * ctx, uint16_t tile, int row)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+    uint64_t const bit = 1ULL << (tile % 64);
+
+    if(ppu->TileDirty[tile / 64] & bit)
+    {
+        uint8_t const * data = &MEMORY_BANK(ctx, MEMORY_BANK_VRAM)[tile * PPU_TILE_SIZE];
+        for(int i=0; i<TILE_ROW_COUNT; i++)
+        {
+            Tile_DecodeRow(data[i * 2], data[i * 2 + 1], ppu->Tile[tile][i]);
+        }
+        ppu->TileDirty[tile / 64] &= ~bit;
+    }
+
+    return ppu->Tile[tile][row];
+}
+
+
+/**
+ * Mode transition event
+ * @param ctx The emulator context
+ * @param deadline The transition cycle
+ * @note The next event is scheduled from the deadline so a late dispatch does not drift
+ */
+static void Ppu_Event(Emu_Context_t * ctx, uint64_t deadline)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+    uint32_t next;
+
+    switch(ppu->Mode)
+    {
+        case PPU_MODE_OAM:
+            ppu->Mode = PPU_MODE_TRANSFER;
+            next = PPU_TRANSFER_CYCLE;
+            break;
+
+        case PPU_MODE_TRANSFER:
+            /* The whole line is rendered at the end of the transfer */
+            if(ppu->Render)
+            {
+                Ppu_RenderLine(ctx);
+            }
+            ppu->Mode = PPU_MODE_HBLANK;
+            next = PPU_HBLANK_CYCLE;
+            break;
+
+        case PPU_MODE_HBLANK:
+            ppu->Ly++;
+            if(ppu->Ly == PPU_SCREEN_HEIGHT)
+            {
+                ppu->FrameCount++;
+                ppu->Mode = PPU_MODE_VBLANK;
+                Interrupt_Request(ctx, INTERRUPT_VBLANK);
+                next = PPU_LINE_CYCLE;
+            }
+            else
+            {
+                ppu->Mode = PPU_MODE_OAM;
+                next = PPU_OAM_CYCLE;
+            }
+            break;
+
+        default:
+            ppu->Ly++;
+            if(ppu->Ly == PPU_LINE_COUNT)
+            {
+                ppu->Ly = 0;
+                ppu->Mode = PPU_MODE_OAM;
+                Ppu_StartFrame(ctx);
+                next = PPU_OAM_CYCLE;
+            }
+            else
+            {
+                next = PPU_LINE_CYCLE;
+            }
+            break;
+    }
+
+    Ppu_UpdateStat(ctx);
+    Scheduler_Schedule(ctx, SCHEDULER_EVENT_PPU, deadline + next, Ppu_Event);
+}
+
+
+/**
+ * Start a new frame at line 0
+ * @param ctx The emulator context
+ */
+static void Ppu_StartFrame(Emu_Context_t * ctx)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+
+    ppu->WindowLine = 0;
+    ppu->Render = (ppu->RenderInterval != PPU_RENDER_NONE) && ((ppu->FrameCount % ppu->RenderInterval) == 0);
+}
+
+
+/**
+ * Request the LCD status interrupt on a rising edge of its source
+ * @param ctx The emulator context
+ */
+static void Ppu_UpdateStat(Emu_Context_t * ctx)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+    bool line = false;
+
+    if(ppu->Lcdc & PPU_LCDC_LCD_ENABLE)
+    {
+        line = ((ppu->Stat & PPU_STAT_LYC_SOURCE) && (ppu->Ly == ppu->Lyc)) ||
+               ((ppu->Mode != PPU_MODE_TRANSFER) && (ppu->Stat & (PPU_STAT_MODE_SOURCE << ppu->Mode)));
+    }
+
+    if(line && !ppu->StatLine)
+    {
+        Interrupt_Request(ctx, INTERRUPT_STAT);
+    }
+    ppu->StatLine = line;
+}
+
+
+/**
+ * Render the current line to the framebuffer
+ * @param ctx The emulator context
+ */
+static void Ppu_RenderLine(Emu_Context_t * ctx)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+    uint8_t line[PPU_LINE_MARGIN + PPU_SCREEN_WIDTH + PPU_LINE_MARGIN];
+    uint8_t * const color = line + PPU_LINE_MARGIN;
+    uint8_t * const frame = ppu->Frame[ppu->Ly];
+
+    if(ppu->Lcdc & PPU_LCDC_BG_ENABLE)
+    {
+        /* Background wrap around the 256x256 tile map */
+        uint16_t const bgMap = (ppu->Lcdc & PPU_LCDC_BG_MAP) ? PPU_VRAM_MAP_HIGH : PPU_VRAM_MAP_LOW;
+        uint8_t const y = ppu->Ly + ppu->Scy;
+        int column = ppu->Scx / 8;
+        for(int x = -(ppu->Scx % 8); x < PPU_SCREEN_WIDTH; x += 8)
+        {
+            Ppu_RenderTileRow(ctx, color, x, bgMap + (y / 8) * PPU_MAP_WIDTH + column, y);
+            column = (column + 1) % PPU_MAP_WIDTH;
+        }
+
+        /* Window cover the background from its position to the right edge */
+        int const wx = ppu->Wx - 7;
+        if((ppu->Lcdc & PPU_LCDC_WIN_ENABLE) && (ppu->Ly >= ppu->Wy) && (wx < PPU_SCREEN_WIDTH))
+        {
+            uint16_t const winMap = (ppu->Lcdc & PPU_LCDC_WIN_MAP) ? PPU_VRAM_MAP_HIGH : PPU_VRAM_MAP_LOW;
+            uint8_t const wy = ppu->WindowLine++;
+            column = 0;
+            for(int x = wx; x < PPU_SCREEN_WIDTH; x += 8)
+            {
+                Ppu_RenderTileRow(ctx, color, x, winMap + (wy / 8) * PPU_MAP_WIDTH + column, wy);
+                column++;
+            }
+        }
+    }
+    else
+    {
+        memset(color, 0, PPU_SCREEN_WIDTH);
+    }
+
+    for(int x=0; x<PPU_SCREEN_WIDTH; x++)
+    {
+        frame[x] = (ppu->Bgp >> (color[x] * 2)) & 0x03;
+    }
+
+    if(ppu->Lcdc & PPU_LCDC_OBJ_ENABLE)
+    {
+        Ppu_RenderSprite(ctx, color, frame);
+    }
+}
+
+
+/**
+ * Decode one row of a background or window tile to the line buffer
+ * @param ctx The emulator context
+ * @param line The color index line buffer (PPU_LINE_MARGIN byte margin each side)
+ * @param x The first pixel position (-7 to PPU_SCREEN_WIDTH - 1)
+ * @param map The VRAM offset of the tile map entry
+ * @param y The line in the tile map (only the row within the tile is used)
+ */
+static void Ppu_RenderTileRow(Emu_Context_t * ctx, uint8_t * line, int x, uint16_t map, uint8_t y)
+{
+    uint8_t const index = MEMORY_BANK(ctx, MEMORY_BANK_VRAM)[map];
+
+    /* 0x8000 addressing use unsigned index, 0x8800 signed index around 0x9000 */
+    uint16_t tile;
+    if(ctx->Ppu.Lcdc & PPU_LCDC_TILE_DATA)
+    {
+        tile = index;
+    }
+    else
+    {
+        tile = PPU_VRAM_TILE_SIGNED / PPU_TILE_SIZE + (int8_t)index;
+    }
+
+    memcpy(line + x, Ppu_GetTileRow(ctx, tile, y % TILE_ROW_COUNT), TILE_ROW_WIDTH);
+}
+
+
+/**
+ * Draw the sprite of the current line over the background
+ * @param ctx The emulator context
+ * @param color The background color index of the line
+ * @param frame The framebuffer line
+ */
+static void Ppu_RenderSprite(Emu_Context_t * ctx, uint8_t const * color, uint8_t * frame)
+{
+    Ppu_Info_t * ppu = &ctx->Ppu;
+    uint8_t const * oam = ctx->Memory.Oam;
+    int const height = (ppu->Lcdc & PPU_LCDC_OBJ_SIZE) ? 16 : 8;
+
+    /* Select the first 10 sprite of the line in OAM order */
+    uint8_t sprite[PPU_SPRITE_LINE_MAX];
+    int count = 0;
+    for(int i=0; (i < PPU_SPRITE_COUNT) && (count < PPU_SPRITE_LINE_MAX); i++)
+    {
+        int const row = ppu->Ly + 16 - oam[i * 4];
+        if((row >= 0) && (row < height))
+        {
+            sprite[count++] = i;
+        }
+    }
+
+    /* Lower X has priority, OAM order break tie: stable insertion sort */
+    for(int i=1; i<count; i++)
+    {
+        uint8_t const cur = sprite[i];
+        int j = i;
+        while((j > 0) && (oam[sprite[j - 1] * 4 + 1] > oam[cur * 4 + 1]))
+        {
+            sprite[j] = sprite[j - 1];
+            j--;
+        }
+        sprite[j] = cur;
+    }
+
+    /* The highest priority opaque pixel win, even when hidden by the background */
+    bool owned[PPU_SCREEN_WIDTH] = {false};
+    for(int i=0; i<count; i++)
+    {
+        uint8_t const * attr = &oam[sprite[i] * 4];
+        uint8_t const flag = attr[3];
+        uint8_t const palette = ppu->Obp[(flag & PPU_ATTR_PALETTE) ? 1 : 0];
+
+        int row = ppu->Ly + 16 - attr[0];
+        if(flag & PPU_ATTR_YFLIP)
+        {
+            row = height - 1 - row;
+        }
+
+        /* A 8x16 sprite use an even and odd tile pair */
+        uint8_t const tile = (height == 16) ? (attr[2] & 0xFE) : attr[2];
+        uint8_t const * pixel = Ppu_GetTileRow(ctx, tile + row / TILE_ROW_COUNT, row % TILE_ROW_COUNT);
+
+        int const x = attr[1] - 8;
+        for(int p=0; p<TILE_ROW_WIDTH; p++)
+        {
+            int const px = x + ((flag & PPU_ATTR_XFLIP) ? (7 - p) : p);
+            if((px < 0) || (px >= PPU_SCREEN_WIDTH) || (pixel[p] == 0) || owned[px])
+            {
+                continue;
+            }
+
+            owned[px] = true;
+            if(((flag & PPU_ATTR_PRIORITY) == 0) || (color[px] == 0))
+            {
+                frame[px] = (palette >> (pixel[p] * 2)) & 0x03;
+            }
+        }
+    }
+}
+
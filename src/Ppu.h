@@ -0,0 +1,222 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _PPU_H_
+#define _PPU_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <Tile.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Screen width in pixel */
+#define PPU_SCREEN_WIDTH    160
+
+/** Screen height in pixel (visible line) */
+#define PPU_SCREEN_HEIGHT   144
+
+/** Number of line per frame (visible and vertical blank) */
+#define PPU_LINE_COUNT      154
+
+/** Number of cycle per line */
+#define PPU_LINE_CYCLE      456
+
+/** Number of cycle per frame */
+#define PPU_FRAME_CYCLE     (PPU_LINE_CYCLE * PPU_LINE_COUNT)
+
+/** Number of tile in VRAM tile data (0x8000-0x97FF) */
+#define PPU_TILE_COUNT      384
+
+/** LCD control register */
+#define PPU_REG_LCDC        0xFF40
+
+/** LCD status register */
+#define PPU_REG_STAT        0xFF41
+
+/** Background scroll Y register */
+#define PPU_REG_SCY         0xFF42
+
+/** Background scroll X register */
+#define PPU_REG_SCX         0xFF43
+
+/** Current line register */
+#define PPU_REG_LY          0xFF44
+
+/** Line compare register */
+#define PPU_REG_LYC         0xFF45
+
+/** OAM DMA source register (source address high Byte) */
+#define PPU_REG_DMA         0xFF46
+
+/** Background palette register */
+#define PPU_REG_BGP         0xFF47
+
+/** Sprite palette 0 register */
+#define PPU_REG_OBP0        0xFF48
+
+/** Sprite palette 1 register */
+#define PPU_REG_OBP1        0xFF49
+
+/** Window Y position register */
+#define PPU_REG_WY          0xFF4A
+
+/** Window X position (+7) register */
+#define PPU_REG_WX          0xFF4B
+
+/** Render interval: render every frame */
+#define PPU_RENDER_ALL      1
+
+/** Render interval: never render, timing and interrupt only */
+#define PPU_RENDER_NONE     0
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** PPU mode (STAT bit 0-1) */
+typedef enum tagPpu_Mode_e
+{
+    PPU_MODE_HBLANK = 0,    /**< Horizontal blank */
+    PPU_MODE_VBLANK,        /**< Vertical blank */
+    PPU_MODE_OAM,           /**< Sprite attribute scan */
+    PPU_MODE_TRANSFER       /**< Pixel transfer */
+} Ppu_Mode_e;
+
+/**
+ * PPU Info
+ * @note Each line is rendered in one pass when its pixel transfer ends
+ */
+typedef struct tagPpu_Info_t
+{
+    uint8_t Lcdc;           /**< LCD control */
+    uint8_t Stat;           /**< LCD status interrupt source (bit 3-6) */
+    uint8_t Scy;            /**< Background scroll Y */
+    uint8_t Scx;            /**< Background scroll X */
+    uint8_t Ly;             /**< Current line */
+    uint8_t Lyc;            /**< Line compare */
+    uint8_t Bgp;            /**< Background palette */
+    uint8_t Obp[2];         /**< Sprite palette */
+    uint8_t Wy;             /**< Window Y position */
+    uint8_t Wx;             /**< Window X position (+7) */
+    Ppu_Mode_e Mode;        /**< Current mode */
+    uint8_t WindowLine;     /**< Window internal line counter */
+    bool StatLine;          /**< LCD status interrupt line level */
+    uint64_t FrameCount;    /**< Number of frame completed */
+    uint32_t RenderInterval;/**< Render one frame every RenderInterval (0: none), kept on reset */
+    bool Render;            /**< Current frame is rendered */
+    uint64_t TileDirty[PPU_TILE_COUNT / 64];                            /**< Tile to decode again before use */
+    uint8_t Tile[PPU_TILE_COUNT][TILE_ROW_COUNT][TILE_ROW_WIDTH];       /**< Decoded tile cache (color index) */
+    uint8_t Frame[PPU_SCREEN_HEIGHT][PPU_SCREEN_WIDTH]; /**< Shade (0: white - 3: black) of each pixel */
+} Ppu_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Reset the PPU and attach its register
+ * @param ctx The emulator context
+ */
+extern void Ppu_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Resume a restored PPU state
+ * @param ctx The emulator context
+ * @param deadline The cycle of the next mode transition (SCHEDULER_NEVER: LCD off)
+ * @note The decoded tile cache is dropped
+ */
+extern void Ppu_Restore(Emu_Context_t * ctx, uint64_t deadline);
+
+/**
+ * Get the framebuffer
+ * @param ctx The emulator context
+ * @return PPU_SCREEN_HEIGHT line of PPU_SCREEN_WIDTH shade (0: white - 3: black)
+ * @note Line are updated as they are rendered: read it after Ppu_GetFrameCount changed
+ */
+extern uint8_t const * Ppu_GetFrame(Emu_Context_t const * ctx);
+
+/**
+ * Get the number of frame completed since reset
+ * @param ctx The emulator context
+ * @return The number of frame (incremented when vertical blank starts)
+ */
+extern uint64_t Ppu_GetFrameCount(Emu_Context_t const * ctx);
+
+/**
+ * Select which frame go through the pixel pipeline
+ * @param ctx The emulator context
+ * @param interval Render the frame whose number is a multiple of interval (PPU_RENDER_NONE: none)
+ * @note Timing, LY, STAT and interrupt are unchanged; the framebuffer keep the last rendered frame.
+ *       Take effect at the next frame.
+ */
+extern void Ppu_SetRenderInterval(Emu_Context_t * ctx, uint32_t interval);
+
+/**
+ * Drop the decoded tile cache
+ * @param ctx The emulator context
+ * @note Needed only when VRAM is modified without Memory_Write
+ */
+extern void Ppu_FlushTileCache(Emu_Context_t * ctx);
+
+/**
+ * Render all the visible line with the current register
+ * @param ctx The emulator context
+ * @note Timing and interrupt are not affected: for benchmark and debug
+ */
+extern void Ppu_RenderFrame(Emu_Context_t * ctx);
+
+/**
+ * Save the framebuffer to a PGM image
+ * @param ctx The emulator context
+ * @param file The image file name
+ * @return 0 if successful, otherwise -1
+ */
+extern int Ppu_SaveFrame(Emu_Context_t const * ctx, char const * file);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _PPU_H_ */
@@ -0,0 +1,422 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Emu.h>
+#include <Rewind.h>
+#include <State.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Round a size up to the allocation alignment */
+#define REWIND_ALIGN(size)      (((size) + 7) & ~(size_t)7)
+
+/** Longest run of a token */
+#define REWIND_RUN_MAX          0x80
+
+/** First literal token (below: run of zero) */
+#define REWIND_TOKEN_LITERAL    0x80
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static int Rewind_Allocate(Emu_Context_t * ctx);
+static size_t Rewind_GetMapSize(size_t size);
+static size_t Rewind_Encode(uint8_t * out, uint8_t const * prev, uint8_t const * next, size_t size);
+static uint8_t * Rewind_EncodePage(uint8_t * out, uint8_t const * prev, uint8_t const * next, size_t size);
+static void Rewind_Apply(uint8_t * image, uint8_t const * delta, size_t size);
+static void Rewind_Push(Rewind_Info_t * rw, uint64_t cycle, uint64_t frame, size_t size);
+static void Rewind_Pop(Rewind_Info_t * rw);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+int Rewind_Start(Emu_Context_t * ctx, uint32_t interval, size_t budget)
+{
+    Rewind_Info_t * rw = &ctx->Rewind;
+
+    Rewind_Stop(ctx);
+    if(interval == 0)
+    {
+        return 0;
+    }
+
+    rw->Interval = interval;
+    rw->Budget = budget;
+    if(Rewind_Allocate(ctx) != 0)
+    {
+        Rewind_Stop(ctx);
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void Rewind_Stop(Emu_Context_t * ctx)
+{
+    Rewind_Info_t * rw = &ctx->Rewind;
+
+    free(rw->Memory);
+    memset(rw, 0, sizeof(*rw));
+}
+
+
+void Rewind_Clear(Emu_Context_t * ctx)
+{
+    Rewind_Info_t * rw = &ctx->Rewind;
+
+    rw->Captured   = false;
+    rw->EntryFirst = 0;
+    rw->EntryCount = 0;
+    rw->RingHead   = 0;
+    rw->RingUsed   = 0;
+}
+
+
+void Rewind_Update(Emu_Context_t * ctx)
+{
+    Rewind_Info_t * rw = &ctx->Rewind;
+
+    if((rw->Interval == 0) ||
+       (rw->Captured && (ctx->Cpu.Cycle - rw->ImageCycle < (uint64_t)rw->Interval * PPU_FRAME_CYCLE)))
+    {
+        return;
+    }
+
+    /* Another cartridge change the savestate size */
+    if(State_GetSize(ctx) != rw->ImageSize)
+    {
+        if(Rewind_Allocate(ctx) != 0)
+        {
+            Rewind_Stop(ctx);
+            return;
+        }
+    }
+
+    State_Save(ctx, rw->Next, rw->ImageSize);
+    if(rw->Captured)
+    {
+        /* The previous snapshot become a delta against the new one */
+        size_t const size = Rewind_Encode(rw->Delta, rw->Image, rw->Next, rw->ImageSize);
+        Rewind_Push(rw, rw->ImageCycle, rw->ImageFrame, size);
+    }
+
+    uint8_t * const image = rw->Image;
+    rw->Image      = rw->Next;
+    rw->Next       = image;
+    rw->ImageCycle = ctx->Cpu.Cycle;
+    rw->ImageFrame = Ppu_GetFrameCount(ctx);
+    rw->Captured   = true;
+}
+
+
+int Rewind_Back(Emu_Context_t * ctx, uint64_t frames)
+{
+    Rewind_Info_t * rw = &ctx->Rewind;
+
+    if(!rw->Captured)
+    {
+        DEBUGGER_ERROR("Rewind Error: no snapshot\n");
+        return -1;
+    }
+
+    uint64_t const back = frames * PPU_FRAME_CYCLE;
+    uint64_t const target = (ctx->Cpu.Cycle > back) ? (ctx->Cpu.Cycle - back) : 0;
+
+    /* Walk back from the newest snapshot, undoing one delta at a time */
+    while((rw->ImageCycle > target) && (rw->EntryCount != 0))
+    {
+        Rewind_Entry_t const * entry = &rw->Entry[(rw->EntryFirst + rw->EntryCount - 1) % REWIND_ENTRY_COUNT];
+        size_t const tail = rw->RingSize - entry->Offset;
+        if(entry->Size > tail)
+        {
+            memcpy(rw->Delta, rw->Ring + entry->Offset, tail);
+            memcpy(rw->Delta + tail, rw->Ring, entry->Size - tail);
+        }
+        else
+        {
+            memcpy(rw->Delta, rw->Ring + entry->Offset, entry->Size);
+        }
+
+        Rewind_Apply(rw->Image, rw->Delta, rw->ImageSize);
+        rw->ImageCycle = entry->Cycle;
+        rw->ImageFrame = entry->Frame;
+        Rewind_Pop(rw);
+    }
+
+    return State_Load(ctx, rw->Image, rw->ImageSize);
+}
+
+
+/**
+ * Carve the snapshot buffer and the history from the budget
+ * @param ctx The emulator context
+ * @return 0 if successful, otherwise -1
+ */
+static int Rewind_Allocate(Emu_Context_t * ctx)
+{
+    Rewind_Info_t * rw = &ctx->Rewind;
+
+    size_t const size = State_GetSize(ctx);
+    size_t const deltaSize = REWIND_ALIGN(Rewind_GetMapSize(size) + 2 * size);
+    size_t const fixed = REWIND_ALIGN(REWIND_ENTRY_COUNT * sizeof(Rewind_Entry_t))
+                       + 2 * REWIND_ALIGN(size) + deltaSize;
+
+    /* The ring must hold at least one delta */
+    if(rw->Budget < fixed + deltaSize)
+    {
+        DEBUGGER_ERROR("Rewind Error: budget too small (%zu KiB at least)\n", (fixed + deltaSize + 1023) / 1024);
+        return -1;
+    }
+
+    free(rw->Memory);
+    rw->Memory = malloc(rw->Budget);
+    if(rw->Memory == NULL)
+    {
+        DEBUGGER_ERROR("Rewind Error: out of memory\n");
+        return -1;
+    }
+
+    uint8_t * data = rw->Memory;
+    rw->Entry = (Rewind_Entry_t *)data;
+    data += REWIND_ALIGN(REWIND_ENTRY_COUNT * sizeof(Rewind_Entry_t));
+    rw->Image = data;
+    data += REWIND_ALIGN(size);
+    rw->Next = data;
+    data += REWIND_ALIGN(size);
+    rw->Delta = data;
+    data += deltaSize;
+    rw->Ring = data;
+    rw->RingSize = rw->Budget - fixed;
+    if(rw->RingSize > UINT32_MAX)
+    {
+        rw->RingSize = UINT32_MAX;
+    }
+    rw->ImageSize = size;
+
+    Rewind_Clear(ctx);
+    return 0;
+}
+
+/**
+ * Get the size of the dirty page bitmap heading a delta
+ * @param size The savestate size
+ * @return The bitmap size
+ */
+static size_t Rewind_GetMapSize(size_t size)
+{
+    size_t const pageCount = (size + REWIND_PAGE_SIZE - 1) / REWIND_PAGE_SIZE;
+    return (pageCount + 7) / 8;
+}
+
+/**
+ * Encode the delta from a snapshot to the previous one
+ * @param out The delta (Rewind_GetMapSize + 2 * size byte at most)
+ * @param prev The previous snapshot
+ * @param next The new snapshot
+ * @param size The savestate size
+ * @return The delta size
+ * @note Dirty page bitmap, then each dirty page XOR run-length encoded
+ */
+static size_t Rewind_Encode(uint8_t * out, uint8_t const * prev, uint8_t const * next, size_t size)
+{
+    uint8_t * const map = out;
+    size_t const mapSize = Rewind_GetMapSize(size);
+    memset(map, 0, mapSize);
+    out += mapSize;
+
+    for(size_t offset=0; offset<size; offset+=REWIND_PAGE_SIZE)
+    {
+        size_t const length = (size - offset < REWIND_PAGE_SIZE) ? (size - offset) : REWIND_PAGE_SIZE;
+        if(memcmp(prev + offset, next + offset, length) != 0)
+        {
+            size_t const page = offset / REWIND_PAGE_SIZE;
+            map[page / 8] |= 1 << (page % 8);
+            out = Rewind_EncodePage(out, prev + offset, next + offset, length);
+        }
+    }
+
+    return out - map;
+}
+
+/**
+ * Run-length encode the XOR of a page
+ * @param out The encoded page (2 * size byte at most)
+ * @param prev The page in the previous snapshot
+ * @param next The page in the new snapshot
+ * @param size The page size
+ * @return The end of the encoded page
+ * @note Token below REWIND_TOKEN_LITERAL: run of token + 1 zero,
+ *       otherwise token - REWIND_TOKEN_LITERAL + 1 literal byte follow
+ */
+static uint8_t * Rewind_EncodePage(uint8_t * out, uint8_t const * prev, uint8_t const * next, size_t size)
+{
+    size_t i = 0;
+    while(i < size)
+    {
+        size_t n = 1;
+        if(prev[i] == next[i])
+        {
+            while((i + n < size) && (n < REWIND_RUN_MAX) && (prev[i + n] == next[i + n]))
+            {
+                n++;
+            }
+            *out++ = (uint8_t)(n - 1);
+        }
+        else
+        {
+            /* A single unchanged byte is cheaper inside the literal */
+            while((i + n < size) && (n < REWIND_RUN_MAX) &&
+                  ((prev[i + n] != next[i + n]) || ((i + n + 1 < size) && (prev[i + n + 1] != next[i + n + 1]))))
+            {
+                n++;
+            }
+            *out++ = (uint8_t)(REWIND_TOKEN_LITERAL + n - 1);
+            for(size_t k=0; k<n; k++)
+            {
+                *out++ = prev[i + k] ^ next[i + k];
+            }
+        }
+        i += n;
+    }
+
+    return out;
+}
+
+/**
+ * Apply a delta to a snapshot
+ * @param image The snapshot, replaced by the previous one
+ * @param delta The delta
+ * @param size The savestate size
+ */
+static void Rewind_Apply(uint8_t * image, uint8_t const * delta, size_t size)
+{
+    uint8_t const * const map = delta;
+    delta += Rewind_GetMapSize(size);
+
+    for(size_t offset=0; offset<size; offset+=REWIND_PAGE_SIZE)
+    {
+        size_t const page = offset / REWIND_PAGE_SIZE;
+        if((map[page / 8] & (1 << (page % 8))) == 0)
+        {
+            continue;
+        }
+
+        size_t const length = (size - offset < REWIND_PAGE_SIZE) ? (size - offset) : REWIND_PAGE_SIZE;
+        uint8_t * const data = image + offset;
+        size_t i = 0;
+        while(i < length)
+        {
+            uint8_t const token = *delta++;
+            if(token < REWIND_TOKEN_LITERAL)
+            {
+                i += token + 1;
+                continue;
+            }
+
+            for(size_t n=token - REWIND_TOKEN_LITERAL + 1; n>0; n--)
+            {
+                data[i++] ^= *delta++;
+            }
+        }
+    }
+}
+
+/**
+ * Append the encoded delta to the history, dropping the oldest to make room
+ * @param rw The rewind info
+ * @param cycle The CPU cycle of the snapshot
+ * @param frame The frame count of the snapshot
+ * @param size The delta size
+ */
+static void Rewind_Push(Rewind_Info_t * rw, uint64_t cycle, uint64_t frame, size_t size)
+{
+    while((rw->EntryCount == REWIND_ENTRY_COUNT) || (rw->RingSize - rw->RingUsed < size))
+    {
+        rw->RingUsed -= rw->Entry[rw->EntryFirst].Size;
+        rw->EntryFirst = (rw->EntryFirst + 1) % REWIND_ENTRY_COUNT;
+        rw->EntryCount--;
+    }
+
+    Rewind_Entry_t * entry = &rw->Entry[(rw->EntryFirst + rw->EntryCount) % REWIND_ENTRY_COUNT];
+    entry->Cycle  = cycle;
+    entry->Frame  = frame;
+    entry->Offset = (uint32_t)rw->RingHead;
+    entry->Size   = (uint32_t)size;
+
+    /* The delta may wrap around the end of the ring */
+    size_t const tail = rw->RingSize - rw->RingHead;
+    if(size > tail)
+    {
+        memcpy(rw->Ring + rw->RingHead, rw->Delta, tail);
+        memcpy(rw->Ring, rw->Delta + tail, size - tail);
+    }
+    else
+    {
+        memcpy(rw->Ring + rw->RingHead, rw->Delta, size);
+    }
+
+    rw->RingHead = (rw->RingHead + size) % rw->RingSize;
+    rw->RingUsed += size;
+    rw->EntryCount++;
+}
+
+/**
+ * Drop the newest delta from the history
+ * @param rw The rewind info
+ */
+static void Rewind_Pop(Rewind_Info_t * rw)
+{
+    rw->EntryCount--;
+
+    Rewind_Entry_t const * entry = &rw->Entry[(rw->EntryFirst + rw->EntryCount) % REWIND_ENTRY_COUNT];
+    rw->RingHead = entry->Offset;
+    rw->RingUsed -= entry->Size;
+}
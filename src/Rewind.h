@@ -0,0 +1,153 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _REWIND_H_
+#define _REWIND_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Max number of snapshot kept (the oldest is dropped first) */
+#define REWIND_ENTRY_COUNT      4096
+
+/** Savestate page compared and compressed as a whole */
+#define REWIND_PAGE_SIZE        256
+
+/** Default number of frame between snapshot */
+#define REWIND_DEFAULT_INTERVAL 1
+
+/** Default memory budget (byte) */
+#define REWIND_DEFAULT_BUDGET   (4 << 20)
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Snapshot older than the newest one, stored as a delta in the ring */
+typedef struct tagRewind_Entry_t
+{
+    uint64_t Cycle;         /**< CPU cycle of the snapshot */
+    uint64_t Frame;         /**< Frame count of the snapshot */
+    uint32_t Offset;        /**< Delta offset in the ring */
+    uint32_t Size;          /**< Delta size */
+} Rewind_Entry_t;
+
+/**
+ * Rewind Info
+ * @note The newest snapshot is a full savestate, each older one is the
+ *       XOR of its dirty page with the next snapshot, run-length encoded
+ * @note Every buffer is carved from a single allocation of Budget byte
+ */
+typedef struct tagRewind_Info_t
+{
+    uint32_t Interval;          /**< Number of frame between snapshot (0: disabled) */
+    size_t Budget;              /**< Memory budget */
+    uint8_t * Memory;           /**< Budget allocation */
+    uint8_t * Image;            /**< Newest snapshot */
+    uint8_t * Next;             /**< Snapshot being captured */
+    uint8_t * Delta;            /**< Delta being encoded or applied */
+    size_t ImageSize;           /**< Savestate size */
+    uint64_t ImageCycle;        /**< CPU cycle of the newest snapshot */
+    uint64_t ImageFrame;        /**< Frame count of the newest snapshot */
+    bool Captured;              /**< Newest snapshot is valid */
+    Rewind_Entry_t * Entry;     /**< Entry ring of REWIND_ENTRY_COUNT, oldest first */
+    uint32_t EntryFirst;        /**< Oldest entry */
+    uint32_t EntryCount;        /**< Number of entry */
+    uint8_t * Ring;             /**< Delta ring */
+    size_t RingSize;            /**< Delta ring size */
+    size_t RingHead;            /**< End of the newest delta */
+    size_t RingUsed;            /**< Byte used by the delta */
+} Rewind_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Start recording snapshot (the previous history is dropped)
+ * @param ctx The emulator context
+ * @param interval The number of frame between snapshot
+ * @param budget The memory budget (byte), history included
+ * @return 0 if successful, otherwise -1 (recording is stopped)
+ * @note A frame is PPU_FRAME_CYCLE cycle, even while the LCD is off
+ */
+extern int Rewind_Start(Emu_Context_t * ctx, uint32_t interval, size_t budget);
+
+/**
+ * Stop recording and release the history
+ * @param ctx The emulator context
+ */
+extern void Rewind_Stop(Emu_Context_t * ctx);
+
+/**
+ * Drop the history (the machine jumped to another timeline)
+ * @param ctx The emulator context
+ */
+extern void Rewind_Clear(Emu_Context_t * ctx);
+
+/**
+ * Take a snapshot if the interval is elapsed
+ * @param ctx The emulator context
+ * @note Call it between instruction or run slice
+ */
+extern void Rewind_Update(Emu_Context_t * ctx);
+
+/**
+ * Restore the newest snapshot at least a number of frame old
+ * @param ctx The emulator context
+ * @param frames The number of frame to go back
+ * @return 0 if successful, otherwise -1 (no snapshot)
+ * @note Land on the oldest snapshot if the history is too short.
+ *       The newer snapshot are dropped.
+ */
+extern int Rewind_Back(Emu_Context_t * ctx, uint64_t frames);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _REWIND_H_ */
@@ -0,0 +1,241 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <assert.h>
+#include <stdint.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static void Scheduler_Swap(Scheduler_Info_t * sched, int a, int b);
+static void Scheduler_SiftUp(Scheduler_Info_t * sched, int index);
+static void Scheduler_SiftDown(Scheduler_Info_t * sched, int index);
+static void Scheduler_Remove(Scheduler_Info_t * sched, int index);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+void Scheduler_Initialize(Emu_Context_t * ctx)
+{
+    Scheduler_Info_t * sched = &ctx->Scheduler;
+
+    for(int i=0; i<SCHEDULER_EVENT_COUNT; i++)
+    {
+        sched->Deadline[i] = SCHEDULER_NEVER;
+        sched->Callback[i] = NULL;
+    }
+    sched->Count = 0;
+}
+
+
+void Scheduler_Schedule(Emu_Context_t * ctx, Scheduler_Event_e event, uint64_t deadline,
+                        Scheduler_Callback_t callback)
+{
+    Scheduler_Info_t * sched = &ctx->Scheduler;
+
+    assert(event < SCHEDULER_EVENT_COUNT);
+
+    sched->Callback[event] = callback;
+
+    /* A write inside Cpu_Run can start an event due before the end of its budget */
+    if(deadline < ctx->Cpu.End)
+    {
+        ctx->Cpu.End = deadline;
+    }
+
+    /* Already pending: move it */
+    if(sched->Deadline[event] != SCHEDULER_NEVER)
+    {
+        uint64_t const previous = sched->Deadline[event];
+        sched->Deadline[event] = deadline;
+        if(deadline < previous)
+        {
+            Scheduler_SiftUp(sched, sched->Position[event]);
+        }
+        else
+        {
+            Scheduler_SiftDown(sched, sched->Position[event]);
+        }
+        return;
+    }
+
+    sched->Deadline[event] = deadline;
+    sched->Heap[sched->Count] = event;
+    sched->Position[event] = sched->Count;
+    sched->Count ++;
+    Scheduler_SiftUp(sched, sched->Count - 1);
+}
+
+
+void Scheduler_Cancel(Emu_Context_t * ctx, Scheduler_Event_e event)
+{
+    Scheduler_Info_t * sched = &ctx->Scheduler;
+
+    if(sched->Deadline[event] != SCHEDULER_NEVER)
+    {
+        Scheduler_Remove(sched, sched->Position[event]);
+    }
+}
+
+
+void Scheduler_Dispatch(Emu_Context_t * ctx)
+{
+    Scheduler_Info_t * sched = &ctx->Scheduler;
+
+    /* A callback may schedule again, even an already due event */
+    while((sched->Count != 0) && (sched->Deadline[sched->Heap[0]] <= ctx->Cpu.Cycle))
+    {
+        int const event = sched->Heap[0];
+        uint64_t const deadline = sched->Deadline[event];
+
+        Scheduler_Remove(sched, 0);
+        sched->Callback[event](ctx, deadline);
+    }
+}
+
+
+/**
+ * Swap two heap entry
+ * @param sched The scheduler
+ * @param a The first heap index
+ * @param b The second heap index
+ */
+static void Scheduler_Swap(Scheduler_Info_t * sched, int a, int b)
+{
+    uint8_t const event = sched->Heap[a];
+
+    sched->Heap[a] = sched->Heap[b];
+    sched->Heap[b] = event;
+    sched->Position[sched->Heap[a]] = a;
+    sched->Position[sched->Heap[b]] = b;
+}
+
+
+/**
+ * Move an entry toward the root while it is earlier than its parent
+ * @param sched The scheduler
+ * @param index The heap index
+ */
+static void Scheduler_SiftUp(Scheduler_Info_t * sched, int index)
+{
+    while(index > 0)
+    {
+        int const parent = (index - 1) / 2;
+        if(sched->Deadline[sched->Heap[parent]] <= sched->Deadline[sched->Heap[index]])
+        {
+            break;
+        }
+
+        Scheduler_Swap(sched, index, parent);
+        index = parent;
+    }
+}
+
+
+/**
+ * Move an entry toward the leaves while it is later than a child
+ * @param sched The scheduler
+ * @param index The heap index
+ */
+static void Scheduler_SiftDown(Scheduler_Info_t * sched, int index)
+{
+    for(;;)
+    {
+        int const left = 2 * index + 1;
+        int const right = left + 1;
+        int earliest = index;
+
+        if((left < sched->Count) && (sched->Deadline[sched->Heap[left]] < sched->Deadline[sched->Heap[earliest]]))
+        {
+            earliest = left;
+        }
+        if((right < sched->Count) && (sched->Deadline[sched->Heap[right]] < sched->Deadline[sched->Heap[earliest]]))
+        {
+            earliest = right;
+        }
+        if(earliest == index)
+        {
+            break;
+        }
+
+        Scheduler_Swap(sched, index, earliest);
+        index = earliest;
+    }
+}
+
+
+/**
+ * Remove a heap entry
+ * @param sched The scheduler
+ * @param index The heap index
+ */
+static void Scheduler_Remove(Scheduler_Info_t * sched, int index)
+{
+    int const event = sched->Heap[index];
+    int const last = sched->Count - 1;
+
+    if(index != last)
+    {
+        Scheduler_Swap(sched, index, last);
+    }
+    sched->Count --;
+    sched->Deadline[event] = SCHEDULER_NEVER;
+
+    if(index < sched->Count)
+    {
+        Scheduler_SiftUp(sched, index);
+        Scheduler_SiftDown(sched, index);
+    }
+}
+
+
+uint64_t Scheduler_GetDeadline(Emu_Context_t const * ctx)
+{
+    return (ctx->Scheduler.Count == 0) ? SCHEDULER_NEVER : ctx->Scheduler.Deadline[ctx->Scheduler.Heap[0]];
+}
@@ -0,0 +1,130 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Deadline of an event not scheduled */
+#define SCHEDULER_NEVER     UINT64_MAX
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Hardware event (at most one pending occurrence each) */
+typedef enum tagScheduler_Event_e
+{
+    SCHEDULER_EVENT_TIMER,      /**< Timer TIMA overflow */
+    SCHEDULER_EVENT_PPU,        /**< PPU mode change */
+    SCHEDULER_EVENT_COUNT       /**< Number of event */
+} Scheduler_Event_e;
+
+/**
+ * Event callback
+ * @param ctx The emulator context
+ * @param deadline The cycle the event was due (CPU cycle may be a few instruction later)
+ */
+typedef void (*Scheduler_Callback_t)(struct tagEmu_Context_t * ctx, uint64_t deadline);
+
+/**
+ * Scheduler Info: binary min-heap of pending event keyed on their deadline
+ */
+typedef struct tagScheduler_Info_t
+{
+    uint64_t Deadline[SCHEDULER_EVENT_COUNT];               /**< Deadline of each event */
+    Scheduler_Callback_t Callback[SCHEDULER_EVENT_COUNT];   /**< Callback of each event */
+    uint8_t Heap[SCHEDULER_EVENT_COUNT];                    /**< Pending event, earliest first */
+    uint8_t Position[SCHEDULER_EVENT_COUNT];                /**< Heap index of each pending event */
+    int Count;                                              /**< Number of pending event */
+} Scheduler_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Cancel all pending event
+ * @param ctx The emulator context
+ */
+extern void Scheduler_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Schedule (or reschedule) an event
+ * @param ctx The emulator context
+ * @param event The event id
+ * @param deadline The absolute CPU cycle to fire the event
+ * @param callback The callback to fire
+ */
+extern void Scheduler_Schedule(Emu_Context_t * ctx, Scheduler_Event_e event, uint64_t deadline,
+                               Scheduler_Callback_t callback);
+
+/**
+ * Cancel a pending event
+ * @param ctx The emulator context
+ * @param event The event id
+ */
+extern void Scheduler_Cancel(Emu_Context_t * ctx, Scheduler_Event_e event);
+
+/**
+ * Fire all the event due at the current CPU cycle
+ * @param ctx The emulator context
+ */
+extern void Scheduler_Dispatch(Emu_Context_t * ctx);
+
+/**
+ * Get the deadline of the next event
+ * @param ctx The emulator context
+ * @return The next deadline, SCHEDULER_NEVER if no event is pending
+ */
+extern uint64_t Scheduler_GetDeadline(Emu_Context_t const * ctx);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _SCHEDULER_H_ */
@@ -0,0 +1,585 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <Emu.h>
+#include <State.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Chunk of a savestate, in file order */
+typedef enum tagState_ChunkName_e
+{
+    STATE_CHUNK_CPU = 0,    /**< CPU register and interrupt master enable */
+    STATE_CHUNK_INTERRUPT,  /**< Interrupt enable and request */
+    STATE_CHUNK_MEMORY,     /**< Internal RAM, I/O register and boot ROM */
+    STATE_CHUNK_CARTRIDGE,  /**< Bank controller */
+    STATE_CHUNK_CARTRIDGE_RAM, /**< External RAM (all bank) */
+    STATE_CHUNK_TIMER,      /**< Divider and timer */
+    STATE_CHUNK_PPU,        /**< LCD controller */
+    STATE_CHUNK_FRAME,      /**< Framebuffer */
+    STATE_CHUNK_COUNT       /**< Number of chunk */
+} State_ChunkName_e;
+
+/** CPU chunk */
+typedef struct tagState_Cpu_t
+{
+    uint64_t Cycle;                 /**< Number of cycle executed */
+    uint64_t IdleCycle;             /**< Number of cycle fast-forwarded */
+    uint16_t Reg[CPU_REG_NUM];      /**< Register (F is up to date) */
+    uint8_t  Halted;                /**< HALT state */
+    uint8_t  Ime;                   /**< Interrupt master enable */
+    uint8_t  ImeDelay;              /**< IME set after the next instruction */
+    uint8_t  Locked;                /**< Hung by an illegal opcode */
+} State_Cpu_t;
+
+/** Interrupt chunk */
+typedef struct tagState_Interrupt_t
+{
+    uint8_t  Enable;                /**< IE register */
+    uint8_t  Request;               /**< IF register */
+} State_Interrupt_t;
+
+/** Memory chunk */
+typedef struct tagState_Memory_t
+{
+    uint8_t  Boot[MEMORY_BOOT_SIZE];    /**< Boot ROM overlay */
+    uint8_t  Vram[MEMORY_VRAM_SIZE];    /**< Video RAM */
+    uint8_t  Wram[MEMORY_WRAM_SIZE];    /**< Work RAM */
+    uint8_t  Oam[MEMORY_PAGE_SIZE];     /**< Sprite attribute table */
+    uint8_t  Io[MEMORY_PAGE_SIZE];      /**< I/O register and high RAM */
+    uint8_t  BootEnabled;               /**< Boot ROM overlay mapped */
+    uint8_t  Reserved[7];               /**< Padding */
+} State_Memory_t;
+
+/** Cartridge chunk (the content is identified by its size and bank controller) */
+typedef struct tagState_Cartridge_t
+{
+    uint64_t RomSize;               /**< ROM size */
+    uint64_t RamSize;               /**< External RAM size */
+    uint16_t RomBank;               /**< ROM bank register */
+    uint8_t  Mbc;                   /**< Cartridge_Mbc_e bank controller */
+    uint8_t  RamBank;               /**< RAM bank register */
+    uint8_t  Mode;                  /**< MBC1 banking mode */
+    uint8_t  RamEnabled;            /**< External RAM access enabled */
+    uint8_t  Reserved[2];           /**< Padding */
+} State_Cartridge_t;
+
+/** Timer chunk */
+typedef struct tagState_Timer_t
+{
+    uint64_t DivBase;               /**< CPU cycle of the last DIV reset */
+    uint64_t TimaBase;              /**< CPU cycle TIMA was last synchronized */
+    uint8_t  Tima;                  /**< TIMA value at TimaBase */
+    uint8_t  Tma;                   /**< Timer modulo */
+    uint8_t  Tac;                   /**< Timer control */
+    uint8_t  Reserved[5];           /**< Padding */
+} State_Timer_t;
+
+/** PPU chunk */
+typedef struct tagState_Ppu_t
+{
+    uint64_t FrameCount;            /**< Number of frame completed */
+    uint64_t Deadline;              /**< Cycle of the next mode transition (SCHEDULER_NEVER: LCD off) */
+    uint8_t  Lcdc;                  /**< LCD control */
+    uint8_t  Stat;                  /**< LCD status interrupt source */
+    uint8_t  Scy;                   /**< Background scroll Y */
+    uint8_t  Scx;                   /**< Background scroll X */
+    uint8_t  Ly;                    /**< Current line */
+    uint8_t  Lyc;                   /**< Line compare */
+    uint8_t  Bgp;                   /**< Background palette */
+    uint8_t  Obp[2];                /**< Sprite palette */
+    uint8_t  Wy;                    /**< Window Y position */
+    uint8_t  Wx;                    /**< Window X position (+7) */
+    uint8_t  Mode;                  /**< Ppu_Mode_e current mode */
+    uint8_t  WindowLine;            /**< Window internal line counter */
+    uint8_t  StatLine;              /**< LCD status interrupt line level */
+    uint8_t  Render;                /**< Current frame is rendered */
+    uint8_t  Reserved[1];           /**< Padding */
+} State_Ppu_t;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static size_t State_GetChunkSize(Emu_Context_t const * ctx, State_ChunkName_e chunk);
+static uint8_t * State_PutChunk(uint8_t * out, State_ChunkName_e chunk, void const * data, size_t size);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+/** Id of each chunk */
+static char const State_ChunkId[STATE_CHUNK_COUNT][4] =
+{
+    {'C', 'P', 'U', ' '},
+    {'I', 'R', 'Q', ' '},
+    {'M', 'E', 'M', ' '},
+    {'C', 'A', 'R', 'T'},
+    {'C', 'R', 'A', 'M'},
+    {'T', 'I', 'M', 'R'},
+    {'P', 'P', 'U', ' '},
+    {'F', 'R', 'A', 'M'}
+};
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+size_t State_GetSize(Emu_Context_t const * ctx)
+{
+    size_t size = sizeof(State_Header_t);
+
+    for(int i=0; i<STATE_CHUNK_COUNT; i++)
+    {
+        size += sizeof(State_Chunk_t) + State_GetChunkSize(ctx, i);
+    }
+
+    return size;
+}
+
+
+size_t State_Save(Emu_Context_t * ctx, void * buffer, size_t size)
+{
+    size_t const total = State_GetSize(ctx);
+    if(size < total)
+    {
+        return 0;
+    }
+
+    State_Header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.Magic, STATE_FILE_MAGIC, sizeof(STATE_FILE_MAGIC));
+    header.Version = STATE_FILE_VERSION;
+    header.Size = (uint32_t)total;
+    memcpy(buffer, &header, sizeof(header));
+    uint8_t * out = (uint8_t *)buffer + sizeof(header);
+
+    /* Lazy flag are not part of the format */
+    Cpu_SyncFlag(ctx);
+
+    State_Cpu_t cpu;
+    memset(&cpu, 0, sizeof(cpu));
+    cpu.Cycle     = ctx->Cpu.Cycle;
+    cpu.IdleCycle = ctx->Cpu.IdleCycle;
+    for(int i=0; i<CPU_REG_NUM; i++)
+    {
+        cpu.Reg[i] = CPU_REG16(ctx, i)->UWord;
+    }
+    cpu.Halted    = ctx->Cpu.Halted;
+    cpu.Locked    = ctx->Cpu.Locked;
+    cpu.Ime       = ctx->Cpu.Ime;
+    cpu.ImeDelay  = ctx->Cpu.ImeDelay;
+    out = State_PutChunk(out, STATE_CHUNK_CPU, &cpu, sizeof(cpu));
+
+    State_Interrupt_t irq;
+    irq.Enable  = ctx->Interrupt.Enable;
+    irq.Request = ctx->Interrupt.Request;
+    out = State_PutChunk(out, STATE_CHUNK_INTERRUPT, &irq, sizeof(irq));
+
+    /* Byte only chunk: filled in place */
+    Memory_Info_t const * mem = &ctx->Memory;
+    State_Memory_t * memory = (State_Memory_t *)(out + sizeof(State_Chunk_t));
+    out = State_PutChunk(out, STATE_CHUNK_MEMORY, NULL, sizeof(State_Memory_t));
+    memcpy(memory->Boot, mem->Boot, sizeof(memory->Boot));
+    memcpy(memory->Vram, MEMORY_BANK(ctx, MEMORY_BANK_VRAM), sizeof(memory->Vram));
+    memcpy(memory->Wram, MEMORY_BANK(ctx, MEMORY_BANK_WRAM), sizeof(memory->Wram));
+    memcpy(memory->Oam,  mem->Oam,  sizeof(memory->Oam));
+    memcpy(memory->Io,   mem->Io,   sizeof(memory->Io));
+    memset(memory->Reserved, 0, sizeof(memory->Reserved));
+    memory->BootEnabled = mem->BootEnabled;
+
+    Cartridge_Info_t const * cart = &ctx->Cartridge;
+    State_Cartridge_t cartridge;
+    memset(&cartridge, 0, sizeof(cartridge));
+    cartridge.RomSize    = cart->RomSize;
+    cartridge.RamSize    = cart->RamSize;
+    cartridge.RomBank    = cart->RomBank;
+    cartridge.Mbc        = cart->Mbc;
+    cartridge.RamBank    = cart->RamBank;
+    cartridge.Mode       = cart->Mode;
+    cartridge.RamEnabled = cart->RamEnabled;
+    out = State_PutChunk(out, STATE_CHUNK_CARTRIDGE, &cartridge, sizeof(cartridge));
+    uint8_t * ram = State_PutChunk(out, STATE_CHUNK_CARTRIDGE_RAM, NULL, cart->RamSize) - cart->RamSize;
+    for(size_t i=0; i<cart->RamSize / CARTRIDGE_RAM_BANK_SIZE; i++)
+    {
+        memcpy(ram + i * CARTRIDGE_RAM_BANK_SIZE, MEMORY_BANK(ctx, MEMORY_BANK_EXTERNAL + i), CARTRIDGE_RAM_BANK_SIZE);
+    }
+    out = ram + cart->RamSize;
+
+    State_Timer_t timer;
+    memset(&timer, 0, sizeof(timer));
+    timer.DivBase  = ctx->Timer.DivBase;
+    timer.TimaBase = ctx->Timer.TimaBase;
+    timer.Tima     = ctx->Timer.Tima;
+    timer.Tma      = ctx->Timer.Tma;
+    timer.Tac      = ctx->Timer.Tac;
+    out = State_PutChunk(out, STATE_CHUNK_TIMER, &timer, sizeof(timer));
+
+    Ppu_Info_t const * lcd = &ctx->Ppu;
+    State_Ppu_t ppu;
+    memset(&ppu, 0, sizeof(ppu));
+    ppu.FrameCount = lcd->FrameCount;
+    ppu.Deadline   = ctx->Scheduler.Deadline[SCHEDULER_EVENT_PPU];
+    ppu.Lcdc       = lcd->Lcdc;
+    ppu.Stat       = lcd->Stat;
+    ppu.Scy        = lcd->Scy;
+    ppu.Scx        = lcd->Scx;
+    ppu.Ly         = lcd->Ly;
+    ppu.Lyc        = lcd->Lyc;
+    ppu.Bgp        = lcd->Bgp;
+    ppu.Obp[0]     = lcd->Obp[0];
+    ppu.Obp[1]     = lcd->Obp[1];
+    ppu.Wy         = lcd->Wy;
+    ppu.Wx         = lcd->Wx;
+    ppu.Mode       = lcd->Mode;
+    ppu.WindowLine = lcd->WindowLine;
+    ppu.StatLine   = lcd->StatLine;
+    ppu.Render     = lcd->Render;
+    out = State_PutChunk(out, STATE_CHUNK_PPU, &ppu, sizeof(ppu));
+    out = State_PutChunk(out, STATE_CHUNK_FRAME, lcd->Frame, sizeof(lcd->Frame));
+
+    return total;
+}
+
+
+int State_Load(Emu_Context_t * ctx, void const * buffer, size_t size)
+{
+    uint8_t const * const data = buffer;
+
+    State_Header_t header;
+    if(size < sizeof(header))
+    {
+        DEBUGGER_ERROR("State Error: not a savestate\n");
+        return -1;
+    }
+    memcpy(&header, data, sizeof(header));
+    if((memcmp(header.Magic, STATE_FILE_MAGIC, sizeof(STATE_FILE_MAGIC)) != 0) || (header.Size > size))
+    {
+        DEBUGGER_ERROR("State Error: not a savestate\n");
+        return -1;
+    }
+    if(header.Version != STATE_FILE_VERSION)
+    {
+        DEBUGGER_ERROR("State Error: version %u not supported\n", (unsigned)header.Version);
+        return -1;
+    }
+
+    /* Locate and check every chunk before touching the machine */
+    uint8_t const * payload[STATE_CHUNK_COUNT] = {NULL};
+    size_t offset = sizeof(header);
+    while(offset + sizeof(State_Chunk_t) <= header.Size)
+    {
+        State_Chunk_t chunk;
+        memcpy(&chunk, data + offset, sizeof(chunk));
+        offset += sizeof(chunk);
+        if(chunk.Size > header.Size - offset)
+        {
+            DEBUGGER_ERROR("State Error: truncated chunk %.4s\n", chunk.Id);
+            return -1;
+        }
+
+        for(int i=0; i<STATE_CHUNK_COUNT; i++)
+        {
+            if(memcmp(chunk.Id, State_ChunkId[i], sizeof(chunk.Id)) == 0)
+            {
+                if(chunk.Size != State_GetChunkSize(ctx, i))
+                {
+                    DEBUGGER_ERROR("State Error: chunk %.4s size mismatch\n", chunk.Id);
+                    return -1;
+                }
+                payload[i] = data + offset;
+            }
+        }
+        offset += chunk.Size;
+    }
+    for(int i=0; i<STATE_CHUNK_COUNT; i++)
+    {
+        if(payload[i] == NULL)
+        {
+            DEBUGGER_ERROR("State Error: missing chunk %.4s\n", State_ChunkId[i]);
+            return -1;
+        }
+    }
+
+    /* The ROM is not saved: the same cartridge must be inserted */
+    Cartridge_Info_t * cart = &ctx->Cartridge;
+    State_Cartridge_t cartridge;
+    memcpy(&cartridge, payload[STATE_CHUNK_CARTRIDGE], sizeof(cartridge));
+    if((cartridge.RomSize != cart->RomSize) || (cartridge.RamSize != cart->RamSize) || (cartridge.Mbc != cart->Mbc))
+    {
+        DEBUGGER_ERROR("State Error: saved with another cartridge\n");
+        return -1;
+    }
+
+    /* A bank shared with a fork is copied before any change */
+    uint8_t * bank[MEMORY_BANK_COUNT];
+    int const bankCount = MEMORY_BANK_EXTERNAL + cart->RamSize / CARTRIDGE_RAM_BANK_SIZE;
+    for(int i=0; i<bankCount; i++)
+    {
+        bank[i] = Memory_GetBank(ctx, i);
+        if(bank[i] == NULL)
+        {
+            return -1;
+        }
+    }
+
+    State_Cpu_t cpu;
+    memcpy(&cpu, payload[STATE_CHUNK_CPU], sizeof(cpu));
+    for(int i=0; i<CPU_REG_NUM; i++)
+    {
+        CPU_REG16(ctx, i)->UWord = cpu.Reg[i];
+    }
+    ctx->Cpu.Flag.Op       = CPU_FLAG_OP_NONE;
+    ctx->Cpu.Cycle         = cpu.Cycle;
+    ctx->Cpu.IdleCycle     = cpu.IdleCycle;
+    ctx->Cpu.Halted        = cpu.Halted;
+    ctx->Cpu.Locked        = cpu.Locked;
+    ctx->Cpu.Ime           = cpu.Ime;
+    ctx->Cpu.ImeDelay      = cpu.ImeDelay;
+    ctx->Cpu.VolatileRead  = false;
+    ctx->Cpu.Break         = false;
+    ctx->Cpu.BreakRequest  = false;
+
+    State_Interrupt_t irq;
+    memcpy(&irq, payload[STATE_CHUNK_INTERRUPT], sizeof(irq));
+    ctx->Interrupt.Enable  = irq.Enable;
+    ctx->Interrupt.Request = irq.Request;
+
+    Memory_Info_t * mem = &ctx->Memory;
+    State_Memory_t const * memory = (State_Memory_t const *)payload[STATE_CHUNK_MEMORY];
+    memcpy(mem->Boot, memory->Boot, sizeof(mem->Boot));
+    memcpy(bank[MEMORY_BANK_VRAM], memory->Vram, sizeof(memory->Vram));
+    memcpy(bank[MEMORY_BANK_WRAM], memory->Wram, sizeof(memory->Wram));
+    memcpy(mem->Oam,  memory->Oam,  sizeof(mem->Oam));
+    memcpy(mem->Io,   memory->Io,   sizeof(mem->Io));
+    mem->BootEnabled   = (memory->BootEnabled != 0);
+    mem->WatchHit.Kind = MEMORY_WATCH_NONE;
+
+    cart->RomBank    = cartridge.RomBank;
+    cart->RamBank    = cartridge.RamBank;
+    cart->Mode       = cartridge.Mode;
+    cart->RamEnabled = (cartridge.RamEnabled != 0);
+    for(int i=MEMORY_BANK_EXTERNAL; i<bankCount; i++)
+    {
+        memcpy(bank[i], payload[STATE_CHUNK_CARTRIDGE_RAM] + (i - MEMORY_BANK_EXTERNAL) * CARTRIDGE_RAM_BANK_SIZE,
+               CARTRIDGE_RAM_BANK_SIZE);
+    }
+
+    /* The page table follow the bank register and the boot ROM overlay */
+    Cartridge_MapRom(ctx);
+    Cartridge_MapRam(ctx);
+
+    State_Timer_t timer;
+    memcpy(&timer, payload[STATE_CHUNK_TIMER], sizeof(timer));
+    ctx->Timer.DivBase  = timer.DivBase;
+    ctx->Timer.TimaBase = timer.TimaBase;
+    ctx->Timer.Tima     = timer.Tima;
+    ctx->Timer.Tma      = timer.Tma;
+    ctx->Timer.Tac      = timer.Tac;
+
+    Ppu_Info_t * lcd = &ctx->Ppu;
+    State_Ppu_t ppu;
+    memcpy(&ppu, payload[STATE_CHUNK_PPU], sizeof(ppu));
+    lcd->FrameCount = ppu.FrameCount;
+    lcd->Lcdc       = ppu.Lcdc;
+    lcd->Stat       = ppu.Stat;
+    lcd->Scy        = ppu.Scy;
+    lcd->Scx        = ppu.Scx;
+    lcd->Ly         = ppu.Ly;
+    lcd->Lyc        = ppu.Lyc;
+    lcd->Bgp        = ppu.Bgp;
+    lcd->Obp[0]     = ppu.Obp[0];
+    lcd->Obp[1]     = ppu.Obp[1];
+    lcd->Wy         = ppu.Wy;
+    lcd->Wx         = ppu.Wx;
+    lcd->Mode       = (Ppu_Mode_e)(ppu.Mode & 0x03);
+    lcd->WindowLine = ppu.WindowLine;
+    lcd->StatLine   = (ppu.StatLine != 0);
+    lcd->Render     = (ppu.Render != 0);
+    memcpy(lcd->Frame, payload[STATE_CHUNK_FRAME], sizeof(lcd->Frame));
+
+    /* Event callback are not saved: each peripheral schedule its own again */
+    Scheduler_Initialize(ctx);
+    Timer_Restore(ctx);
+    Ppu_Restore(ctx, ppu.Deadline);
+
+    Interrupt_Update(ctx);
+
+    /* Drop the instruction decoded from the previous content */
+    Cpu_FlushCache(ctx);
+
+    return 0;
+}
+
+
+int State_SaveFile(Emu_Context_t * ctx, char const * file)
+{
+    size_t const size = State_GetSize(ctx);
+    void * buffer = malloc(size);
+    if(buffer == NULL)
+    {
+        DEBUGGER_ERROR("State Error: out of memory\n");
+        return -1;
+    }
+    State_Save(ctx, buffer, size);
+
+    FILE * pFile = fopen(file, "wb");
+    if(pFile == NULL)
+    {
+        DEBUGGER_ERROR("State Error: %s: %s\n", file, strerror(errno));
+        free(buffer);
+        return -1;
+    }
+
+    size_t const written = fwrite(buffer, 1, size, pFile);
+    free(buffer);
+    if((fclose(pFile) != 0) || (written != size))
+    {
+        DEBUGGER_ERROR("State Error: %s: %s\n", file, strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+
+void * State_ReadFile(char const * file, size_t * size)
+{
+    FILE * pFile = fopen(file, "rb");
+    if(pFile == NULL)
+    {
+        DEBUGGER_ERROR("State Error: %s: %s\n", file, strerror(errno));
+        return NULL;
+    }
+
+    long length = -1;
+    if(fseek(pFile, 0, SEEK_END) == 0)
+    {
+        length = ftell(pFile);
+        rewind(pFile);
+    }
+
+    void * buffer = (length > 0) ? malloc(length) : NULL;
+    if((buffer == NULL) || (fread(buffer, 1, length, pFile) != (size_t)length))
+    {
+        DEBUGGER_ERROR("State Error: %s: cannot read\n", file);
+        free(buffer);
+        fclose(pFile);
+        return NULL;
+    }
+
+    fclose(pFile);
+    *size = length;
+    return buffer;
+}
+
+
+int State_LoadFile(Emu_Context_t * ctx, char const * file)
+{
+    size_t size;
+    void * buffer = State_ReadFile(file, &size);
+    if(buffer == NULL)
+    {
+        return -1;
+    }
+
+    int const status = State_Load(ctx, buffer, size);
+    free(buffer);
+
+    return status;
+}
+
+
+/**
+ * Get the payload size of a chunk
+ * @param ctx The emulator context
+ * @param chunk The chunk
+ * @return The payload size
+ */
+static size_t State_GetChunkSize(Emu_Context_t const * ctx, State_ChunkName_e chunk)
+{
+    switch(chunk)
+    {
+        case STATE_CHUNK_CPU:
+            return sizeof(State_Cpu_t);
+        case STATE_CHUNK_INTERRUPT:
+            return sizeof(State_Interrupt_t);
+        case STATE_CHUNK_MEMORY:
+            return sizeof(State_Memory_t);
+        case STATE_CHUNK_CARTRIDGE:
+            return sizeof(State_Cartridge_t);
+        case STATE_CHUNK_CARTRIDGE_RAM:
+            return ctx->Cartridge.RamSize;
+        case STATE_CHUNK_TIMER:
+            return sizeof(State_Timer_t);
+        case STATE_CHUNK_PPU:
+            return sizeof(State_Ppu_t);
+        default:
+            return sizeof(ctx->Ppu.Frame);
+    }
+}
+
+
+/**
+ * Write a chunk
+ * @param out The chunk position
+ * @param chunk The chunk
+ * @param data The payload, NULL to fill it later
+ * @param size The payload size
+ * @return The position after the chunk
+ */
+static uint8_t * State_PutChunk(uint8_t * out, State_ChunkName_e chunk, void const * data, size_t size)
+{
+    State_Chunk_t header;
+    memcpy(header.Id, State_ChunkId[chunk], sizeof(header.Id));
+    header.Size = (uint32_t)size;
+    memcpy(out, &header, sizeof(header));
+
+    if(data != NULL)
+    {
+        memcpy(out + sizeof(header), data, size);
+    }
+
+    return out + sizeof(header) + size;
+}
@@ -0,0 +1,135 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _STATE_H_
+#define _STATE_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Savestate magic */
+#define STATE_FILE_MAGIC    "GBSTATE"
+
+/** Savestate format version (a chunk layout change need a new version) */
+#define STATE_FILE_VERSION  1
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Savestate header (fixed size, written as is) */
+typedef struct tagState_Header_t
+{
+    char     Magic[8];      /**< STATE_FILE_MAGIC */
+    uint32_t Version;       /**< STATE_FILE_VERSION */
+    uint32_t Size;          /**< Savestate size, header included */
+} State_Header_t;
+
+/** Chunk header, followed by Size byte of payload */
+typedef struct tagState_Chunk_t
+{
+    char     Id[4];         /**< Chunk id (unknown id are skipped) */
+    uint32_t Size;          /**< Payload size */
+} State_Chunk_t;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Get the size of a savestate of the machine
+ * @param ctx The emulator context
+ * @return The savestate size (depend on the cartridge RAM size)
+ */
+extern size_t State_GetSize(Emu_Context_t const * ctx);
+
+/**
+ * Save the machine state to a buffer
+ * @param ctx The emulator context
+ * @param buffer The savestate buffer
+ * @param size The buffer size
+ * @return The savestate size, 0 if the buffer is too small
+ * @note The cartridge ROM, breakpoint, watchpoint and host setting are not saved
+ */
+extern size_t State_Save(Emu_Context_t * ctx, void * buffer, size_t size);
+
+/**
+ * Restore the machine state from a buffer
+ * @param ctx The emulator context
+ * @param buffer The savestate
+ * @param size The savestate size
+ * @return 0 if successful, otherwise -1 (the machine is unchanged)
+ * @note The cartridge the state was saved with must be inserted
+ */
+extern int State_Load(Emu_Context_t * ctx, void const * buffer, size_t size);
+
+/**
+ * Save the machine state to a file
+ * @param ctx The emulator context
+ * @param file The savestate file name
+ * @return 0 if successful, otherwise -1
+ */
+extern int State_SaveFile(Emu_Context_t * ctx, char const * file);
+
+/**
+ * Read a savestate file
+ * @param file The savestate file name
+ * @param size The savestate size
+ * @return The savestate (free it), NULL if the file cannot be read
+ * @note Read a checkpoint once, then State_Load it in any number of context
+ */
+extern void * State_ReadFile(char const * file, size_t * size);
+
+/**
+ * Restore the machine state from a file
+ * @param ctx The emulator context
+ * @param file The savestate file name
+ * @return 0 if successful, otherwise -1
+ */
+extern int State_LoadFile(Emu_Context_t * ctx, char const * file);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _STATE_H_ */
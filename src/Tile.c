@@ -0,0 +1,241 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <Tile.h>
+
+/* SIMD decoder are built with a target attribute and selected at run time */
+#if defined(__GNUC__) && defined(__x86_64__)
+#  define TILE_X86
+#  include <immintrin.h>
+#endif
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static void Tile_DecodeScalar(uint8_t low, uint8_t high, uint8_t * pixel);
+static void Tile_DecodeTable(uint8_t low, uint8_t high, uint8_t * pixel);
+#if defined(TILE_X86)
+static void Tile_DecodeSse2(uint8_t low, uint8_t high, uint8_t * pixel);
+static void Tile_DecodeBmi2(uint8_t low, uint8_t high, uint8_t * pixel);
+#endif
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+Tile_Decoder_t Tile_DecodeRow = Tile_DecodeScalar;
+
+/** Decoder in use */
+static Tile_Kernel_e Tile_Kernel = TILE_KERNEL_SCALAR;
+
+/** Bitplane byte spread to one 0/1 byte per pixel */
+static uint8_t Tile_Spread[256][TILE_ROW_WIDTH];
+
+/** Decoder of each kernel (NULL: not built for this host) */
+static Tile_Decoder_t const Tile_Decoder[TILE_KERNEL_COUNT] =
+{
+    Tile_DecodeScalar,
+    Tile_DecodeTable,
+#if defined(TILE_X86)
+    Tile_DecodeSse2,
+    Tile_DecodeBmi2
+#else
+    NULL,
+    NULL
+#endif
+};
+
+/** Kernel by order of preference: pdep is microcoded on AMD before Zen 3, SSE2 is fast everywhere */
+static Tile_Kernel_e const Tile_Rank[TILE_KERNEL_COUNT] =
+{
+    TILE_KERNEL_SSE2,
+    TILE_KERNEL_BMI2,
+    TILE_KERNEL_TABLE,
+    TILE_KERNEL_SCALAR
+};
+
+/** Name of each kernel */
+static char const * const Tile_Name[TILE_KERNEL_COUNT] =
+{
+    "scalar",
+    "table",
+    "sse2",
+    "bmi2"
+};
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+void Tile_Initialize(void)
+{
+    for(int value=0; value<256; value++)
+    {
+        for(int i=0; i<TILE_ROW_WIDTH; i++)
+        {
+            Tile_Spread[value][i] = (value >> (7 - i)) & 0x01;
+        }
+    }
+
+    for(int i=0; i<TILE_KERNEL_COUNT; i++)
+    {
+        if(Tile_SetKernel(Tile_Rank[i]) == 0)
+        {
+            break;
+        }
+    }
+}
+
+
+bool Tile_IsSupported(Tile_Kernel_e kernel)
+{
+    if((kernel >= TILE_KERNEL_COUNT) || (Tile_Decoder[kernel] == NULL))
+    {
+        return false;
+    }
+
+#if defined(TILE_X86)
+    __builtin_cpu_init();
+    if(kernel == TILE_KERNEL_SSE2)
+    {
+        return __builtin_cpu_supports("sse2");
+    }
+    if(kernel == TILE_KERNEL_BMI2)
+    {
+        return __builtin_cpu_supports("bmi2");
+    }
+#endif
+
+    return true;
+}
+
+
+int Tile_SetKernel(Tile_Kernel_e kernel)
+{
+    if(!Tile_IsSupported(kernel))
+    {
+        return -1;
+    }
+
+    Tile_Kernel = kernel;
+    Tile_DecodeRow = Tile_Decoder[kernel];
+    return 0;
+}
+
+
+Tile_Kernel_e Tile_GetKernel(void)
+{
+    return Tile_Kernel;
+}
+
+
+char const * Tile_GetName(Tile_Kernel_e kernel)
+{
+    return (kernel < TILE_KERNEL_COUNT) ? Tile_Name[kernel] : "unknown";
+}
+
+
+/**
+ * Decode a tile row one bit at a time
+ */
+static void Tile_DecodeScalar(uint8_t low, uint8_t high, uint8_t * pixel)
+{
+    for(int i=0; i<TILE_ROW_WIDTH; i++)
+    {
+        int const bit = 7 - i;
+        pixel[i] = ((low >> bit) & 0x01) | (((high >> bit) << 1) & 0x02);
+    }
+}
+
+
+/**
+ * Decode a tile row with two spread table lookup merged in a 64 bit word
+ */
+static void Tile_DecodeTable(uint8_t low, uint8_t high, uint8_t * pixel)
+{
+    uint64_t l, h;
+    memcpy(&l, Tile_Spread[low], sizeof(l));
+    memcpy(&h, Tile_Spread[high], sizeof(h));
+
+    /* Each byte is 0 or 1: the shift never cross a byte */
+    l |= h << 1;
+    memcpy(pixel, &l, sizeof(l));
+}
+
+
+#if defined(TILE_X86)
+
+/**
+ * Decode a tile row by testing each bit of the broadcast bitplane
+ */
+__attribute__((target("sse2")))
+static void Tile_DecodeSse2(uint8_t low, uint8_t high, uint8_t * pixel)
+{
+    /* Lane 0-7 hold the low bitplane, lane 8-15 the high one */
+    __m128i const plane = _mm_unpacklo_epi64(_mm_set1_epi8((char)low), _mm_set1_epi8((char)high));
+    __m128i const mask  = _mm_set_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80,
+                                       0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80);
+    __m128i const value = _mm_set_epi8(2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1);
+
+    __m128i const set = _mm_cmpeq_epi8(_mm_and_si128(plane, mask), mask);
+    __m128i const bit = _mm_and_si128(set, value);
+    _mm_storel_epi64((__m128i *)pixel, _mm_or_si128(bit, _mm_srli_si128(bit, 8)));
+}
+
+
+/**
+ * Decode a tile row by depositing each bitplane bit in its own byte
+ */
+__attribute__((target("bmi2")))
+static void Tile_DecodeBmi2(uint8_t low, uint8_t high, uint8_t * pixel)
+{
+    /* Bit n land in byte n: swap so the leftmost pixel (bit 7) come first */
+    uint64_t const value = _pdep_u64(low, 0x0101010101010101ULL) | _pdep_u64(high, 0x0202020202020202ULL);
+    uint64_t const row = __builtin_bswap64(value);
+    memcpy(pixel, &row, sizeof(row));
+}
+
+#endif /* TILE_X86 */
@@ -0,0 +1,122 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _TILE_H_
+#define _TILE_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Number of pixel in a tile row */
+#define TILE_ROW_WIDTH      8
+
+/** Number of row in a tile */
+#define TILE_ROW_COUNT      8
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/**
+ * 2 bit per pixel row decoder
+ * @param low The low bitplane byte
+ * @param high The high bitplane byte
+ * @param pixel The TILE_ROW_WIDTH color index (leftmost pixel is bit 7)
+ */
+typedef void (*Tile_Decoder_t)(uint8_t low, uint8_t high, uint8_t * pixel);
+
+/** Row decoder implementation */
+typedef enum tagTile_Kernel_e
+{
+    TILE_KERNEL_SCALAR = 0,     /**< Bit by bit loop */
+    TILE_KERNEL_TABLE,          /**< 256 entry spread table */
+    TILE_KERNEL_SSE2,           /**< SSE2 bit test (x86) */
+    TILE_KERNEL_BMI2,           /**< BMI2 parallel bit deposit (x86) */
+    TILE_KERNEL_COUNT
+} Tile_Kernel_e;
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Select the preferred decoder supported by the host (SSE2 first, BMI2 pdep is slow on early Zen)
+ * @note Call once before starting thread; the scalar decoder is used until then
+ */
+extern void Tile_Initialize(void);
+
+/**
+ * Check if the host support a decoder
+ * @param kernel The decoder
+ * @return true if the decoder can be used
+ */
+extern bool Tile_IsSupported(Tile_Kernel_e kernel);
+
+/**
+ * Force a decoder
+ * @param kernel The decoder
+ * @return 0 if successful, -1 if the host does not support it
+ */
+extern int Tile_SetKernel(Tile_Kernel_e kernel);
+
+/**
+ * Get the decoder in use
+ * @return The decoder
+ */
+extern Tile_Kernel_e Tile_GetKernel(void);
+
+/**
+ * Get a decoder name
+ * @param kernel The decoder
+ * @return The decoder name
+ */
+extern char const * Tile_GetName(Tile_Kernel_e kernel);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+/** Decode a tile row with the selected decoder */
+extern Tile_Decoder_t Tile_DecodeRow;
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _TILE_H_ */
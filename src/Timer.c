@@ -0,0 +1,228 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** TAC timer enable bit */
+#define TIMER_TAC_ENABLE    0x04
+
+/** TAC clock select mask */
+#define TIMER_TAC_CLOCK     0x03
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static uint8_t Timer_Read(Emu_Context_t * ctx, uint16_t addr);
+static void Timer_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data);
+static void Timer_Sync(Emu_Context_t * ctx);
+static void Timer_Schedule(Emu_Context_t * ctx);
+static void Timer_Overflow(Emu_Context_t * ctx, uint64_t deadline);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+/** Number of cycle per TIMA increment for each TAC clock select */
+static uint32_t const Timer_Period[] = {1024, 16, 64, 256};
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+void Timer_Initialize(Emu_Context_t * ctx)
+{
+    Timer_Info_t * timer = &ctx->Timer;
+
+    timer->DivBase  = ctx->Cpu.Cycle;
+    timer->TimaBase = ctx->Cpu.Cycle;
+    timer->Tima = 0;
+    timer->Tma  = 0;
+    timer->Tac  = 0;
+
+    Scheduler_Cancel(ctx, SCHEDULER_EVENT_TIMER);
+
+    Memory_MapIo(ctx, TIMER_REG_DIV,  Timer_Read, Timer_Write);
+    Memory_MapIo(ctx, TIMER_REG_TIMA, Timer_Read, Timer_Write);
+    Memory_MapIo(ctx, TIMER_REG_TMA,  Timer_Read, Timer_Write);
+    Memory_MapIo(ctx, TIMER_REG_TAC,  Timer_Read, Timer_Write);
+}
+
+
+void Timer_Restore(Emu_Context_t * ctx)
+{
+    Timer_Schedule(ctx);
+}
+
+
+/**
+ * Read a timer register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @return The register value
+ */
+static uint8_t Timer_Read(Emu_Context_t * ctx, uint16_t addr)
+{
+    Timer_Info_t * timer = &ctx->Timer;
+
+    switch(addr)
+    {
+        case TIMER_REG_DIV:
+            /* DIV is the upper byte of a 16 bit counter running at CPU clock */
+            Cpu_NotifyVolatileRead(ctx);
+            return (uint8_t)((ctx->Cpu.Cycle - timer->DivBase) >> 8);
+        case TIMER_REG_TIMA:
+            /* TIMA change between overflow event */
+            Cpu_NotifyVolatileRead(ctx);
+            Timer_Sync(ctx);
+            return timer->Tima;
+        case TIMER_REG_TMA:
+            return timer->Tma;
+        default:
+            return timer->Tac | 0xF8;
+    }
+}
+
+
+/**
+ * Write a timer register
+ * @param ctx The emulator context
+ * @param addr The register address
+ * @param data The data to write
+ */
+static void Timer_Write(Emu_Context_t * ctx, uint16_t addr, uint8_t data)
+{
+    Timer_Info_t * timer = &ctx->Timer;
+
+    /* Account the increment done with the previous setting */
+    Timer_Sync(ctx);
+
+    switch(addr)
+    {
+        case TIMER_REG_DIV:
+            timer->DivBase = ctx->Cpu.Cycle;
+            break;
+        case TIMER_REG_TIMA:
+            timer->Tima = data;
+            break;
+        case TIMER_REG_TMA:
+            timer->Tma = data;
+            break;
+        default:
+            timer->Tac = data & (TIMER_TAC_ENABLE | TIMER_TAC_CLOCK);
+            break;
+    }
+
+    Timer_Schedule(ctx);
+}
+
+
+/**
+ * Bring TIMA up to the current CPU cycle
+ * @param ctx The emulator context
+ */
+static void Timer_Sync(Emu_Context_t * ctx)
+{
+    Timer_Info_t * timer = &ctx->Timer;
+    uint64_t const now = ctx->Cpu.Cycle;
+
+    if(timer->Tac & TIMER_TAC_ENABLE)
+    {
+        /* TIMA follows the selected DIV counter bit */
+        uint32_t const period = Timer_Period[timer->Tac & TIMER_TAC_CLOCK];
+        uint64_t ticks = (now - timer->DivBase) / period - (timer->TimaBase - timer->DivBase) / period;
+
+        /* Overflow reload TMA and request an interrupt */
+        while(ticks > 0)
+        {
+            uint32_t const room = 0x100 - timer->Tima;
+            if(ticks < room)
+            {
+                timer->Tima += ticks;
+                break;
+            }
+            ticks -= room;
+            timer->Tima = timer->Tma;
+            Interrupt_Request(ctx, INTERRUPT_TIMER);
+        }
+    }
+
+    timer->TimaBase = now;
+}
+
+
+/**
+ * Schedule the next TIMA overflow
+ * @param ctx The emulator context
+ */
+static void Timer_Schedule(Emu_Context_t * ctx)
+{
+    Timer_Info_t * timer = &ctx->Timer;
+
+    if((timer->Tac & TIMER_TAC_ENABLE) == 0)
+    {
+        Scheduler_Cancel(ctx, SCHEDULER_EVENT_TIMER);
+        return;
+    }
+
+    /* Overflow at the (0x100 - TIMA)th counter bit edge from now */
+    uint32_t const period = Timer_Period[timer->Tac & TIMER_TAC_CLOCK];
+    uint64_t const edge = (timer->TimaBase - timer->DivBase) / period + (0x100 - timer->Tima);
+    Scheduler_Schedule(ctx, SCHEDULER_EVENT_TIMER, timer->DivBase + edge * period, Timer_Overflow);
+}
+
+
+/**
+ * TIMA overflow event
+ * @param ctx The emulator context
+ * @param deadline The overflow cycle
+ */
+static void Timer_Overflow(Emu_Context_t * ctx, uint64_t deadline)
+{
+    /* Unused parameter */
+    (void) deadline;
+
+    Timer_Sync(ctx);
+    Timer_Schedule(ctx);
+}
@@ -0,0 +1,101 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _TIMER_H_
+#define _TIMER_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdint.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Divider register */
+#define TIMER_REG_DIV       0xFF04
+
+/** Timer counter register */
+#define TIMER_REG_TIMA      0xFF05
+
+/** Timer modulo register */
+#define TIMER_REG_TMA       0xFF06
+
+/** Timer control register */
+#define TIMER_REG_TAC       0xFF07
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/**
+ * Timer Info
+ * @note Counters are derived from the CPU cycle on access, never ticked
+ */
+typedef struct tagTimer_Info_t
+{
+    uint64_t DivBase;       /**< CPU cycle of the last DIV reset */
+    uint64_t TimaBase;      /**< CPU cycle TIMA was last synchronized */
+    uint8_t Tima;           /**< TIMA value at TimaBase */
+    uint8_t Tma;            /**< Timer modulo */
+    uint8_t Tac;            /**< Timer control */
+} Timer_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Reset the timer and attach its register
+ * @param ctx The emulator context
+ */
+extern void Timer_Initialize(Emu_Context_t * ctx);
+
+/**
+ * Schedule the next overflow of a restored timer state
+ * @param ctx The emulator context
+ */
+extern void Timer_Restore(Emu_Context_t * ctx);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _TIMER_H_ */
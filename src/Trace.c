@@ -0,0 +1,259 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/* Required for nanosleep */
+#define _POSIX_C_SOURCE 200809L
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <errno.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <Emu.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Number of record copied out of the ring buffer at once */
+#define TRACE_CHUNK_COUNT   1024
+
+/** Background writer polling period (ns) */
+#define TRACE_PERIOD        1000000
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static void * Trace_Writer(void * arg);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+int Trace_Start(Emu_Context_t * ctx, char const * file, bool background)
+{
+    Trace_Info_t * trace = &ctx->Trace;
+
+    /* Restart with the new file */
+    Trace_Stop(ctx);
+
+    trace->Buffer = malloc(TRACE_BUFFER_COUNT * sizeof(Trace_Record_t));
+    trace->File = fopen(file, "wb");
+    if((trace->Buffer == NULL) || (trace->File == NULL))
+    {
+        DEBUGGER_ERROR("Trace Error: %s: %s\n", file, strerror(errno));
+        free(trace->Buffer);
+        trace->Buffer = NULL;
+        if(trace->File != NULL)
+        {
+            fclose(trace->File);
+            trace->File = NULL;
+        }
+        return -1;
+    }
+
+    Trace_Header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.Magic, TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+    header.Version = TRACE_FILE_VERSION;
+    header.RecordSize = sizeof(Trace_Record_t);
+    fwrite(&header, sizeof(header), 1, trace->File);
+
+    trace->Head = 0;
+    trace->Tail = 0;
+    trace->Lost = 0;
+    trace->Stop = false;
+    pthread_mutex_init(&trace->Lock, NULL);
+
+    trace->Threaded = false;
+    if(background)
+    {
+        trace->Threaded = (pthread_create(&trace->Thread, NULL, Trace_Writer, ctx) == 0);
+        if(trace->Threaded == false)
+        {
+            DEBUGGER_WARNING("Trace Warning: no writer thread, flush on demand\n");
+        }
+    }
+
+    __atomic_store_n(&trace->Enabled, true, __ATOMIC_RELEASE);
+    return 0;
+}
+
+
+void Trace_Stop(Emu_Context_t * ctx)
+{
+    Trace_Info_t * trace = &ctx->Trace;
+
+    if(trace->File == NULL)
+    {
+        return;
+    }
+
+    trace->Enabled = false;
+
+    if(trace->Threaded)
+    {
+        __atomic_store_n(&trace->Stop, true, __ATOMIC_RELEASE);
+        pthread_join(trace->Thread, NULL);
+        trace->Threaded = false;
+    }
+
+    Trace_Flush(ctx);
+    if(trace->Lost != 0)
+    {
+        DEBUGGER_WARNING("Trace Warning: %" PRIu64 " record lost\n", trace->Lost);
+    }
+
+    fclose(trace->File);
+    trace->File = NULL;
+    free(trace->Buffer);
+    trace->Buffer = NULL;
+    pthread_mutex_destroy(&trace->Lock);
+}
+
+
+uint64_t Trace_Flush(Emu_Context_t * ctx)
+{
+    Trace_Record_t chunk[TRACE_CHUNK_COUNT];
+    Trace_Info_t * trace = &ctx->Trace;
+    uint64_t written = 0;
+
+    if(trace->File == NULL)
+    {
+        return 0;
+    }
+
+    pthread_mutex_lock(&trace->Lock);
+    for(;;)
+    {
+        uint64_t const head = __atomic_load_n(&trace->Head, __ATOMIC_ACQUIRE);
+        uint64_t tail = trace->Tail;
+
+        /* Skip what the producer already overwrote */
+        if(head - tail > TRACE_BUFFER_COUNT)
+        {
+            trace->Lost += head - tail - TRACE_BUFFER_COUNT;
+            tail = head - TRACE_BUFFER_COUNT;
+        }
+        if(tail == head)
+        {
+            trace->Tail = tail;
+            break;
+        }
+
+        /* Copy a chunk out of the ring */
+        uint64_t count = head - tail;
+        if(count > TRACE_CHUNK_COUNT)
+        {
+            count = TRACE_CHUNK_COUNT;
+        }
+        for(uint64_t i=0; i<count; i++)
+        {
+            chunk[i] = trace->Buffer[(tail + i) & (TRACE_BUFFER_COUNT - 1)];
+        }
+
+        /* Drop the record overwritten during the copy (one more for the slot being written) */
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint64_t const after = __atomic_load_n(&trace->Head, __ATOMIC_RELAXED);
+        uint64_t skip = 0;
+        if(after + 1 > tail + TRACE_BUFFER_COUNT)
+        {
+            skip = after + 1 - TRACE_BUFFER_COUNT - tail;
+            skip = (skip > count) ? count : skip;
+            trace->Lost += skip;
+        }
+
+        fwrite(&chunk[skip], sizeof(Trace_Record_t), count - skip, trace->File);
+        written += count - skip;
+        trace->Tail = tail + count;
+    }
+    fflush(trace->File);
+    pthread_mutex_unlock(&trace->Lock);
+
+    return written;
+}
+
+
+void Trace_Record(Emu_Context_t * ctx, Trace_Kind_e kind, uint16_t addr, uint8_t value)
+{
+    Trace_Info_t * trace = &ctx->Trace;
+    uint64_t const head = trace->Head;
+
+    Trace_Record_t * record = &trace->Buffer[head & (TRACE_BUFFER_COUNT - 1)];
+    record->Cycle = ctx->Cpu.Cycle;     /* Not advanced inside a block */
+    record->Pc    = CPU_REG16(ctx, CPU_R_PC)->UWord;
+    record->Addr  = addr;
+    record->Value = value;
+    record->Kind  = kind;
+    record->Reserved[0] = 0;
+    record->Reserved[1] = 0;
+
+    /* Publish the record to the writer */
+    __atomic_store_n(&trace->Head, head + 1, __ATOMIC_RELEASE);
+}
+
+
+/**
+ * Background writer: periodically drain the ring buffer
+ * @param arg The emulator context
+ * @return NULL
+ */
+static void * Trace_Writer(void * arg)
+{
+    Emu_Context_t * ctx = arg;
+    struct timespec const period = {0, TRACE_PERIOD};
+
+    while(__atomic_load_n(&ctx->Trace.Stop, __ATOMIC_ACQUIRE) == false)
+    {
+        if(Trace_Flush(ctx) == 0)
+        {
+            nanosleep(&period, NULL);
+        }
+    }
+
+    return NULL;
+}
@@ -0,0 +1,172 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Number of record in the ring buffer (power of 2) */
+#define TRACE_BUFFER_COUNT  0x00100000
+
+/** Trace file magic */
+#define TRACE_FILE_MAGIC    "GBTRACE"
+
+/** Trace file format version */
+#define TRACE_FILE_VERSION  1
+
+/**
+ * Record a memory access if tracing is enabled
+ * @note Compiled out with TRACE_DISABLED, otherwise a single test when off
+ * @param ctx The emulator context
+ * @param kind The Trace_Kind_e access kind
+ * @param addr The accessed address
+ * @param value The read or written value
+ */
+#if defined(TRACE_DISABLED)
+#  define TRACE_ACCESS(ctx, kind, addr, value)
+#else
+#  define TRACE_ACCESS(ctx, kind, addr, value) \
+    do{ if((ctx)->Trace.Enabled) { Trace_Record((ctx), (kind), (addr), (value)); } } while(0)
+#endif
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/** Traced access kind */
+typedef enum tagTrace_Kind_e
+{
+    TRACE_KIND_READ,    /**< Memory read */
+    TRACE_KIND_WRITE    /**< Memory write */
+} Trace_Kind_e;
+
+/**
+ * Trace record (fixed size, written as is to the trace file)
+ * @note Cycle has block granularity: Cpu_Run advance the counter after each
+ *       translated block, so every access of a block get the cycle it started
+ *       at (Cpu_Step: the cycle the instruction started at). Pc identify the
+ *       accessing instruction.
+ */
+typedef struct tagTrace_Record_t
+{
+    uint64_t Cycle;     /**< CPU cycle counter at the start of the executing block */
+    uint16_t Pc;        /**< PC register (address of the next instruction) */
+    uint16_t Addr;      /**< Accessed address */
+    uint8_t  Value;     /**< Read or written value */
+    uint8_t  Kind;      /**< Trace_Kind_e */
+    uint8_t  Reserved[2]; /**< Padding */
+} Trace_Record_t;
+
+/** Trace file header */
+typedef struct tagTrace_Header_t
+{
+    char     Magic[8];      /**< TRACE_FILE_MAGIC */
+    uint32_t Version;       /**< TRACE_FILE_VERSION */
+    uint32_t RecordSize;    /**< sizeof(Trace_Record_t) */
+} Trace_Header_t;
+
+/**
+ * Trace Info
+ * @note Single producer (emulation thread), consumer serialized by Lock
+ */
+typedef struct tagTrace_Info_t
+{
+    bool Enabled;               /**< Recording enabled */
+    Trace_Record_t * Buffer;    /**< Ring buffer of TRACE_BUFFER_COUNT record */
+    uint64_t Head;              /**< Number of record produced */
+    uint64_t Tail;              /**< Number of record consumed */
+    uint64_t Lost;              /**< Number of record overwritten before flush */
+    FILE * File;                /**< Output file */
+    pthread_mutex_t Lock;       /**< Consumer lock */
+    pthread_t Thread;           /**< Background writer */
+    bool Threaded;              /**< Background writer running */
+    bool Stop;                  /**< Background writer stop request */
+} Trace_Info_t;
+
+/* Emulator context is defined once all module type are known */
+#include <Emu.h>
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+/**
+ * Start recording memory access to a binary trace file
+ * @param ctx The emulator context
+ * @param file The trace file name
+ * @param background true to flush with a writer thread, false to flush on demand
+ * @return 0 if successful, otherwise -1
+ */
+extern int Trace_Start(Emu_Context_t * ctx, char const * file, bool background);
+
+/**
+ * Stop recording, flush and close the trace file
+ * @param ctx The emulator context
+ */
+extern void Trace_Stop(Emu_Context_t * ctx);
+
+/**
+ * Write the pending record to the trace file
+ * @param ctx The emulator context
+ * @return The number of record written
+ */
+extern uint64_t Trace_Flush(Emu_Context_t * ctx);
+
+/**
+ * Append a record to the ring buffer (overwrite the oldest if full)
+ * @param ctx The emulator context
+ * @param kind The Trace_Kind_e access kind
+ * @param addr The accessed address
+ * @param value The read or written value
+ */
+extern void Trace_Record(Emu_Context_t * ctx, Trace_Kind_e kind, uint16_t addr, uint8_t value);
+
+
+/******************************************************/
+/* Variable                                           */
+/******************************************************/
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+
+#endif /* _TRACE_H_ */
@@ -0,0 +1,177 @@
+/**
+ * GameBoyPlay - Simple Gameboy emulator written in C.
+ * Copyright (C) 2015 - Aurelien Tran <aurelien.tran@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * Generate the 8 bit ALU flag table of the CPU (src/CpuTable.h)
+ *
+ * The flag of an 8 bit addition or substraction only depend on the 9 bit raw
+ * result (Zero and Carry) and on the carry into bit 4 (Half Carry), which is
+ * bit 4 of (operand0 ^ operand1 ^ result) with or without carry in. The table
+ * are indexed by these 10 bit instead of the operand pair so they all fit in
+ * a few KB of cache.
+ *
+ * Usage: CpuTable > src/CpuTable.h
+ */
+
+
+/******************************************************/
+/* Include                                            */
+/******************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+/******************************************************/
+/* Macro                                              */
+/******************************************************/
+
+/** Flag bitmap (see Cpu_FlagName_e) */
+#define FLAG_Z  0x80
+#define FLAG_N  0x40
+#define FLAG_H  0x20
+#define FLAG_C  0x10
+
+/** Number of entry of the addition/substraction table (Half Carry, Carry, 8 bit result) */
+#define TABLE_ARITH_SIZE    0x400
+
+/** Number of entry of the table indexed by the 8 bit result */
+#define TABLE_RESULT_SIZE   0x100
+
+
+/******************************************************/
+/* Type                                               */
+/******************************************************/
+
+/**
+ * Flag value of a table entry
+ * @param index The table index
+ * @return The flag value
+ */
+typedef uint8_t (*Table_Callback_t)(uint32_t index);
+
+
+/******************************************************/
+/* Prototype                                          */
+/******************************************************/
+
+static void Table_Print(char const * name, char const * help, uint32_t size, Table_Callback_t callback);
+static uint8_t Table_FlagAdd(uint32_t index);
+static uint8_t Table_FlagSub(uint32_t index);
+static uint8_t Table_FlagInc(uint32_t index);
+static uint8_t Table_FlagDec(uint32_t index);
+static uint8_t Table_FlagAnd(uint32_t index);
+static uint8_t Table_FlagLogic(uint32_t index);
+
+
+/******************************************************/
+/* Function                                           */
+/******************************************************/
+
+int main(void)
+{
+    printf("/* Generated by tool/CpuTable.c, do not edit */\n\n");
+    printf("#ifndef _CPU_TABLE_H_\n");
+    printf("#define _CPU_TABLE_H_\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("/**\n");
+    printf(" * Addition/substraction flag table index\n");
+    printf(" * @param data0 The first operand\n");
+    printf(" * @param data1 The second operand (without carry)\n");
+    printf(" * @param result The raw result (carry/borrow out in bit 8)\n");
+    printf(" */\n");
+    printf("#define CPU_TABLE_INDEX(data0, data1, result) \\\n");
+    printf("    (((((data0) ^ (data1) ^ (result)) & 0x10) << 5) | ((result) & 0x1FF))\n\n");
+
+    Table_Print("Cpu_FlagAdd",   "ADD/ADC flag (Z0HC) indexed by CPU_TABLE_INDEX",   TABLE_ARITH_SIZE,  Table_FlagAdd);
+    Table_Print("Cpu_FlagSub",   "SUB/SBC/CP flag (Z1HC) indexed by CPU_TABLE_INDEX", TABLE_ARITH_SIZE, Table_FlagSub);
+    Table_Print("Cpu_FlagInc",   "INC flag (Z0H-) indexed by the result",            TABLE_RESULT_SIZE, Table_FlagInc);
+    Table_Print("Cpu_FlagDec",   "DEC flag (Z1H-) indexed by the result",            TABLE_RESULT_SIZE, Table_FlagDec);
+    Table_Print("Cpu_FlagAnd",   "AND flag (Z010) indexed by the result",            TABLE_RESULT_SIZE, Table_FlagAnd);
+    Table_Print("Cpu_FlagLogic", "XOR/OR flag (Z000) indexed by the result",         TABLE_RESULT_SIZE, Table_FlagLogic);
+
+    printf("#endif /* _CPU_TABLE_H_ */\n");
+    return 0;
+}
+
+
+/**
+ * Print a table as a constant array
+ * @param name The array name
+ * @param help The array documentation
+ * @param size The number of entry
+ * @param callback The entry value callback
+ */
+static void Table_Print(char const * name, char const * help, uint32_t size, Table_Callback_t callback)
+{
+    printf("/** %s */\n", help);
+    printf("static uint8_t const %s[0x%X] =\n{\n", name, size);
+    for(uint32_t i=0; i<size; i++)
+    {
+        printf("%s0x%02X%s", ((i % 16) == 0) ? "    " : "", callback(i),
+               (i == size - 1) ? "\n" : (((i % 16) == 15) ? ",\n" : ", "));
+    }
+    printf("};\n\n");
+}
+
+
+static uint8_t Table_FlagAdd(uint32_t index)
+{
+    return (((index & 0xFF) == 0x00) ? FLAG_Z : 0)
+         | (((index & 0x200) != 0) ? FLAG_H : 0)
+         | (((index & 0x100) != 0) ? FLAG_C : 0);
+}
+
+
+static uint8_t Table_FlagSub(uint32_t index)
+{
+    return Table_FlagAdd(index) | FLAG_N;
+}
+
+
+static uint8_t Table_FlagInc(uint32_t index)
+{
+    return ((index == 0x00) ? FLAG_Z : 0)
+         | (((index & 0x0F) == 0x00) ? FLAG_H : 0);
+}
+
+
+static uint8_t Table_FlagDec(uint32_t index)
+{
+    return ((index == 0x00) ? FLAG_Z : 0)
+         | FLAG_N
+         | (((index & 0x0F) == 0x0F) ? FLAG_H : 0);
+}
+
+
+static uint8_t Table_FlagAnd(uint32_t index)
+{
+    return ((index == 0x00) ? FLAG_Z : 0) | FLAG_H;
+}
+
+
+static uint8_t Table_FlagLogic(uint32_t index)
+{
+    return (index == 0x00) ? FLAG_Z : 0;
+}